@@ -33,6 +33,7 @@
 #include <media/stagefright/foundation/ABitReader.h>
 #include <system/graphics.h>
 #include <utils/Timers.h>
+#include <utils/Mutex.h>
 
 #if USING_MDP_PRE_PREOCESS
 
@@ -85,19 +86,7 @@ static void printBinary(uint8_t* ptrBS, int iLen) {
 }
 
 int32_t RemovePreventionByte(uint8_t* profile_tier_level, uint8_t size) {
-    int32_t pos = 0;
-    int32_t leftSize = size;
-
-    for (; pos < size - 2;) {
-        if (profile_tier_level[pos] == 0x00 && profile_tier_level[pos + 1] == 0x00 &&
-            profile_tier_level[pos + 2] == 0x03) {
-            memmove(profile_tier_level + pos + 2, profile_tier_level + pos + 3, size - (pos + 3));
-            pos += 2;
-            leftSize--;  // remove 1 0x03
-        } else {
-            pos++;
-        }
-    }
+    int32_t leftSize = RemovePreventionBytes(profile_tier_level, size);
 
     VT_LOGD("Size %d --> leftSize %d", size, leftSize);
     return leftSize;
@@ -321,8 +310,56 @@ int vilte_ion_va_mva(unsigned int ion_fd, unsigned long va, unsigned int size, u
     return 0;
 }
 
+// The service and the ion client are kept for the process,
+// only the frame buffers are mapped per call.
+static Mutex sMdpLock;
+static sp<IMms> sMmsService;
+static int sIonFd = -1;
+
+static bool getMdpHandles(sp<IMms>* service, int* ionFd) {
+    Mutex::Autolock autoLock(sMdpLock);
+
+    if (sMmsService == nullptr) {
+        sMmsService = IMms::tryGetService();
+
+        if (sMmsService == nullptr) {
+            ALOGE("cannot find IMms_service!");
+            return false;
+        }
+    }
+
+    if (sIonFd < 0) {
+        sIonFd = ion_open();
+
+        if (sIonFd < 0) {
+            ALOGE("ion_open(%d) fail\n", sIonFd);
+            return false;
+        }
+    }
+
+    *service = sMmsService;
+    *ionFd = sIonFd;
+    return true;
+}
+
+// looked up again on the next call
+static void resetMdpService() {
+    Mutex::Autolock autoLock(sMdpLock);
+    sMmsService = nullptr;
+}
+
 #endif
 
+static bool isSWRotateEnabled() {
+    char value[PROPERTY_VALUE_MAX];
+
+    if (property_get("vendor.vt.ro.sw", value, NULL)) {
+        return atoi(value) == 1;
+    }
+
+    return false;
+}
+
 int64_t rotateBuffer(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t* outFillLen) {
     int64_t startTimeUs = systemTime(SYSTEM_TIME_MONOTONIC) / 1000ll;
 
@@ -351,13 +388,20 @@ int64_t rotateBuffer(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t*
             tarBufWidth, tarBufHeight, OmxFormatToString(tarFormat), output, degree, ro_type,
             *outFillLen);
 
+    if (isSWRotateEnabled()) {
+        return RotateBufferSW(input, output, info, outFillLen);
+    }
+
 #ifdef USING_MDP_BY_HIDL
 
-    sp<IMms> IMms_service = IMms::tryGetService();
-    if (IMms_service == nullptr) {
-        ALOGE("cannot find IMms_service!");
-        return -1;
+    sp<IMms> IMms_service;
+    int ion_fd = -1;
+
+    if (!getMdpHandles(&IMms_service, &ion_fd)) {
+        VT_LOGW("MDP not available, rotate by cpu");
+        return RotateBufferSW(input, output, info, outFillLen);
     }
+
     HwMDPParam mpdParams;
     memset(&mpdParams, 0, sizeof(HwMDPParam));
 
@@ -519,12 +563,6 @@ int64_t rotateBuffer(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t*
     srcRoi.h = ROUND_2(srcHeight);
 
 #if USING_MDP_BY_HIDL
-    unsigned int ion_fd;
-    ion_fd = ion_open();
-    if (ion_fd < 0) {
-        ALOGE("ion_open(%d) fail\n", ion_fd);
-        return ion_fd;
-    }
     int src_ion_handle_tobe_free[srcNumPlanes];
     for (uint32_t i = 0; i < srcNumPlanes; i++) {
         uint32_t mva = 0;
@@ -664,9 +702,14 @@ int64_t rotateBuffer(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t*
     mpdParams.dst_rect.w = dstRoi.w;
     mpdParams.dst_rect.h = dstRoi.h;
     mpdParams.rotation = degree;
-    IMms_service->mdp_run(mpdParams);
+    auto mdpRet = IMms_service->mdp_run(mpdParams);
 
-    // free mva handle and close ion_fd
+    if (!mdpRet.isOk()) {
+        VT_LOGE("mdp_run fail: %s", mdpRet.description().c_str());
+        resetMdpService();
+    }
+
+    // free mva handle, ion_fd is kept
     for (uint32_t i = 0; i < srcNumPlanes; i++) {
         VT_LOGV("src  ion_free_handle(%d)  \n", src_ion_handle_tobe_free[i]);
         ion_free(ion_fd, src_ion_handle_tobe_free[i]);
@@ -676,7 +719,6 @@ int64_t rotateBuffer(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t*
         VT_LOGV("dst  ion_free_handle(%d)  \n", src_ion_handle_tobe_free[i]);
         ion_free(ion_fd, dst_ion_handle_tobe_free[i]);
     }
-    ion_close(ion_fd);
 #else
     bliterr = blitStream.setDstBuffer((void**)dstYUVbufArray, (unsigned int*)dstYUVbufSizeArray,
                                       tarNumPlanes);
@@ -742,9 +784,8 @@ int64_t rotateBuffer(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t*
 }
 #else
 int64_t rotateBuffer(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t* outFillLen) {
-    VT_LOGE("should not called !!!:input %p,output %p, info %p *outFillLen %d", input, output, info,
-            *outFillLen);
-    return -1;
+    // no MDP in this build
+    return RotateBufferSW(input, output, info, outFillLen);
 }
 
 #endif
@@ -923,7 +964,8 @@ sp<ABuffer> MakeAVCCodecSpecificData(const char* params, int32_t* profile, int32
             return NULL;
         }
 
-        int32_t leftSize = RemovePreventionByte(nal->data(), nal->size());
+        size_t leftSize = RemovePreventionBytes(nal->data(), nal->size());
+        VT_LOGD("Size %zu --> leftSize %zu", nal->size(), leftSize);
         nal->setRange(0, leftSize);
 
         if (nal->size() <= 0) {
@@ -1377,7 +1419,8 @@ sp<ABuffer> MakeHEVCCodecSpecificData(const char* params, int32_t* width, int32_
         printBinary(nal->data(), nal->size());
 
         sp<ABuffer> nalWoPreventionByte = ABuffer::CreateAsCopy(nal->data(), nal->size());
-        RemovePreventionByte(nalWoPreventionByte->data(), nalWoPreventionByte->size());
+        nalWoPreventionByte->setRange(
+                0, RemovePreventionBytes(nalWoPreventionByte->data(), nalWoPreventionByte->size()));
 
         if (nalWoPreventionByte == NULL) {
             VT_LOGI("params error 1 @ start %zu", start);
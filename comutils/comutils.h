@@ -48,6 +48,9 @@ struct MtkSPSInfo {
 };
 
 int64_t rotateBuffer(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t* outFillLen);
+// same contract as rotateBuffer on the CPU, for I420/YV12/NV21/RGBA input and
+// I420/YV12/NV21 output, the MTK block formats need MDP
+int64_t RotateBufferSW(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t* outFillLen);
 
 sp<ABuffer> MakeAVCCodecSpecificData(const char* params, int32_t* profile, int32_t* level,
                                      int32_t* width, int32_t* height, int32_t* sarWidth,
@@ -67,6 +70,15 @@ void MTKFindAVCSPSInfo(uint8_t* seqParamSet, size_t size, struct MtkSPSInfo* pSP
 sp<ABuffer> MakeHEVCCodecSpecificData(const char* params, int32_t* width, int32_t* height);
 int32_t RemovePreventionByte(uint8_t* profile_tier_level, uint8_t size);
 
+// Annex-B NAL scan, SSE2/NEON when available
+// first 0x00 0x00 0x01 in data, data + size if none
+const uint8_t* FindNALStartCode(const uint8_t* data, size_t size);
+// same contract as getNextNALUnit of stagefright avc_utils
+status_t GetNextNALUnit(const uint8_t** _data, size_t* _size, const uint8_t** nalStart,
+                        size_t* nalSize, bool startCodeFollows);
+// remove 0x03 of every 0x00 0x00 0x03 in place, return the size left
+size_t RemovePreventionBytes(uint8_t* data, size_t size);
+
 void FindHEVCWH(const sp<ABuffer>& seqParamSet, int32_t* width, int32_t* height);
 int32_t PixelForamt2ColorFomat(int32_t pixelFormat);
 int32_t getEncoderInPutFormat();
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils/Log.h>
+#undef LOG_TAG
+#define LOG_TAG "[VT][comutils]"
+#include "comutils.h"
+#include <errno.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace android {
+
+// first position of 0x00 0x00 x in data, data + size if none
+// start code is x = 0x01, emulation prevention is x = 0x03
+static const uint8_t* findZeroZeroByte(const uint8_t* data, size_t size, uint8_t x) {
+    const uint8_t* end = data + size;
+    const uint8_t* p = data;
+
+    if (size < 3) {
+        return end;
+    }
+
+#if defined(__SSE2__)
+    // 16 candidates per loop, each one needs the 2 bytes after it
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i third = _mm_set1_epi8((char)x);
+
+    while (end - p >= 18) {
+        __m128i b0 = _mm_loadu_si128((const __m128i*)p);
+        __m128i b1 = _mm_loadu_si128((const __m128i*)(p + 1));
+        __m128i b2 = _mm_loadu_si128((const __m128i*)(p + 2));
+        __m128i zeros = _mm_and_si128(_mm_cmpeq_epi8(b0, zero), _mm_cmpeq_epi8(b1, zero));
+        __m128i hit = _mm_and_si128(zeros, _mm_cmpeq_epi8(b2, third));
+        int mask = _mm_movemask_epi8(hit);
+
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+
+        p += 16;
+    }
+#elif defined(__ARM_NEON)
+    const uint8x16_t zero = vdupq_n_u8(0);
+    const uint8x16_t third = vdupq_n_u8(x);
+
+    while (end - p >= 18) {
+        uint8x16_t zeros = vandq_u8(vceqq_u8(vld1q_u8(p), zero), vceqq_u8(vld1q_u8(p + 1), zero));
+        uint8x16_t hit = vandq_u8(zeros, vceqq_u8(vld1q_u8(p + 2), third));
+#if defined(__aarch64__)
+        bool found = vmaxvq_u8(hit) != 0;
+#else
+        uint8x8_t half = vorr_u8(vget_low_u8(hit), vget_high_u8(hit));
+        bool found = vget_lane_u32(vreinterpret_u32_u8(vpmax_u8(half, half)), 0) != 0;
+#endif
+
+        if (found) {
+            // locate it in these 16 bytes
+            break;
+        }
+
+        p += 16;
+    }
+#endif
+
+    // scalar, p[2] decides: a match at p needs it to be x, at p + 1 or p + 2 to be 0
+    while (p + 2 < end) {
+        if (p[2] == 0) {
+            p++;
+        } else if (p[2] != x) {
+            p += 3;
+        } else if (p[0] == 0 && p[1] == 0) {
+            return p;
+        } else {
+            p += 3;
+        }
+    }
+
+    return end;
+}
+
+const uint8_t* FindNALStartCode(const uint8_t* data, size_t size) {
+    return findZeroZeroByte(data, size, 0x01);
+}
+
+// same contract as getNextNALUnit of stagefright avc_utils
+status_t GetNextNALUnit(const uint8_t** _data, size_t* _size, const uint8_t** nalStart,
+                        size_t* nalSize, bool startCodeFollows) {
+    const uint8_t* data = *_data;
+    size_t size = *_size;
+
+    *nalStart = NULL;
+    *nalSize = 0;
+
+    if (size < 3) {
+        return -EAGAIN;
+    }
+
+    // a valid start code is at least two 0x00 followed by 0x01
+    size_t offset = FindNALStartCode(data, size) - data;
+
+    if (offset == size) {
+        // keep the last 2 bytes, they may be the head of a start code
+        *_data = &data[size - 2];
+        *_size = 2;
+        return -EAGAIN;
+    }
+
+    size_t startOffset = offset + 3;
+    size_t nextOffset = FindNALStartCode(data + startOffset, size - startOffset) - data;
+    size_t endOffset = nextOffset;
+
+    if (nextOffset == size) {
+        if (!startCodeFollows) {
+            return -EAGAIN;
+        }
+    }
+
+    // trailing zero bytes belong to the next start code
+    while (endOffset > startOffset + 1 && data[endOffset - 1] == 0x00) {
+        --endOffset;
+    }
+
+    *nalStart = &data[startOffset];
+    *nalSize = endOffset - startOffset;
+
+    if (nextOffset + 4 < size) {
+        *_data = &data[nextOffset];
+        *_size = size - nextOffset;
+    } else {
+        *_data = NULL;
+        *_size = 0;
+    }
+
+    return OK;
+}
+
+size_t RemovePreventionBytes(uint8_t* data, size_t size) {
+    size_t readPos = 0;
+    size_t writePos = 0;
+
+    for (;;) {
+        const uint8_t* found = findZeroZeroByte(data + readPos, size - readPos, 0x03);
+        // keep the 2 zero bytes, drop the 0x03
+        size_t keep = found - (data + readPos);
+        bool last = (found == data + size);
+
+        if (!last) {
+            keep += 2;
+        }
+
+        if (writePos != readPos) {
+            memmove(data + writePos, data + readPos, keep);
+        }
+
+        writePos += keep;
+
+        if (last) {
+            break;
+        }
+
+        readPos += keep + 1;
+    }
+
+    return writePos;
+}
+
+}  // namespace android
@@ -0,0 +1,484 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils/Log.h>
+#undef LOG_TAG
+#define LOG_TAG "[VT][comutils]"
+#include "comutils.h"
+#include <OMX_IVCommon.h>
+#include <OMX_Video.h>
+#include <OMX_VideoExt.h>
+#include <cutils/properties.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utils/Timers.h>
+#include <utils/Trace.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// same layout as the MDP path of rotateBuffer
+#define ROUND_2(X) ((X + 0x1) & (~0x1))
+#define ROUND_16(X) ((X + 0xF) & (~0xF))
+
+namespace android {
+
+// 8 bit samples of one plane, step is the distance of 2 samples in a row
+struct Plane {
+    uint8_t* data;
+    int32_t stride;
+    int32_t step;
+};
+
+// Y, U, V of a 4:2:0 frame
+struct YUVFrame {
+    Plane plane[3];
+    uint32_t size;
+};
+
+static const int32_t kGatherTile = 32;
+static const uint8_t kBlackY = 16;
+static const uint8_t kBlackUV = 128;
+
+static bool setupYUVFrame(uint8_t* base, int32_t format, int32_t width, int32_t height,
+                          YUVFrame* frame) {
+    int32_t wStride = ROUND_16(width);
+    int32_t hStride = ROUND_16(height);
+    int32_t ySize = wStride * hStride;
+
+    frame->plane[0].data = base;
+    frame->plane[0].stride = wStride;
+    frame->plane[0].step = 1;
+
+    if (format == OMX_COLOR_FormatYUV420Planar) {
+        // I420
+        int32_t uvSize = ySize / 4;
+        frame->plane[1].data = base + ySize;
+        frame->plane[1].stride = wStride / 2;
+        frame->plane[1].step = 1;
+        frame->plane[2].data = base + ySize + uvSize;
+        frame->plane[2].stride = wStride / 2;
+        frame->plane[2].step = 1;
+        frame->size = ySize + 2 * uvSize;
+    } else if (format == OMX_MTK_COLOR_FormatYV12) {
+        // V before U, uv stride is 16 aligned too
+        int32_t uvStride = ROUND_16(wStride / 2);
+        int32_t uvSize = uvStride * (hStride / 2);
+        frame->plane[1].data = base + ySize + uvSize;
+        frame->plane[1].stride = uvStride;
+        frame->plane[1].step = 1;
+        frame->plane[2].data = base + ySize;
+        frame->plane[2].stride = uvStride;
+        frame->plane[2].step = 1;
+        frame->size = ySize + 2 * uvSize;
+    } else if (format == OMX_COLOR_FormatYUV420SemiPlanar) {
+        // NV21 as OmxColorToDpColor maps it, V U interleaved
+        frame->plane[1].data = base + ySize + 1;
+        frame->plane[1].stride = wStride;
+        frame->plane[1].step = 2;
+        frame->plane[2].data = base + ySize;
+        frame->plane[2].stride = wStride;
+        frame->plane[2].step = 2;
+        frame->size = ySize + ySize / 2;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+// BT.601 limited range, the profile the MDP path asks for.
+// Return the I420 buffer of frame, caller frees it.
+static uint8_t* convertRGBToI420(const uint8_t* rgb, int32_t format, int32_t width, int32_t height,
+                                 YUVFrame* frame) {
+    // RGBA is R G B A in memory, ARGB is the little endian word 0xAARRGGBB
+    int32_t r = 0, g = 1, b = 2;
+
+    if (format == OMX_COLOR_Format32bitARGB8888) {
+        r = 2;
+        b = 0;
+    }
+
+    int32_t w = ROUND_2(width);
+    int32_t h = ROUND_2(height);
+    int32_t rgbStride = ROUND_16(width) * 4;
+    uint8_t* yuv = (uint8_t*)malloc(w * h * 3 / 2);
+
+    if (yuv == NULL) {
+        return NULL;
+    }
+
+    frame->plane[0].data = yuv;
+    frame->plane[0].stride = w;
+    frame->plane[0].step = 1;
+    frame->plane[1].data = yuv + w * h;
+    frame->plane[1].stride = w / 2;
+    frame->plane[1].step = 1;
+    frame->plane[2].data = yuv + w * h + w * h / 4;
+    frame->plane[2].stride = w / 2;
+    frame->plane[2].step = 1;
+    frame->size = w * h * 3 / 2;
+
+    for (int32_t y = 0; y < h; y += 2) {
+        const uint8_t* s0 = rgb + y * rgbStride;
+        const uint8_t* s1 = s0 + rgbStride;
+        uint8_t* y0 = frame->plane[0].data + y * w;
+        uint8_t* y1 = y0 + w;
+        uint8_t* u = frame->plane[1].data + (y / 2) * (w / 2);
+        uint8_t* v = frame->plane[2].data + (y / 2) * (w / 2);
+
+        for (int32_t x = 0; x < w; x += 2) {
+            const uint8_t* p[4] = {s0 + x * 4, s0 + x * 4 + 4, s1 + x * 4, s1 + x * 4 + 4};
+            uint8_t* out[4] = {y0 + x, y0 + x + 1, y1 + x, y1 + x + 1};
+            int32_t sumR = 0, sumG = 0, sumB = 0;
+
+            for (int32_t i = 0; i < 4; i++) {
+                *out[i] = ((66 * p[i][r] + 129 * p[i][g] + 25 * p[i][b] + 128) >> 8) + 16;
+                sumR += p[i][r];
+                sumG += p[i][g];
+                sumB += p[i][b];
+            }
+
+            // sums of 4 samples, >> 10 instead of >> 8
+            u[x / 2] = ((-38 * sumR - 74 * sumG + 112 * sumB + 512) >> 10) + 128;
+            v[x / 2] = ((112 * sumR - 94 * sumG - 18 * sumB + 512) >> 10) + 128;
+        }
+    }
+
+    return yuv;
+}
+
+// dst[i][k] = src[k][i] of a 8x8 block, strides can be negative
+static inline void transpose8x8(const uint8_t* src, int32_t srcStride, uint8_t* dst,
+                                int32_t dstStride) {
+#if defined(__SSE2__)
+    __m128i r0 = _mm_loadl_epi64((const __m128i*)(src));
+    __m128i r1 = _mm_loadl_epi64((const __m128i*)(src + srcStride));
+    __m128i r2 = _mm_loadl_epi64((const __m128i*)(src + 2 * srcStride));
+    __m128i r3 = _mm_loadl_epi64((const __m128i*)(src + 3 * srcStride));
+    __m128i r4 = _mm_loadl_epi64((const __m128i*)(src + 4 * srcStride));
+    __m128i r5 = _mm_loadl_epi64((const __m128i*)(src + 5 * srcStride));
+    __m128i r6 = _mm_loadl_epi64((const __m128i*)(src + 6 * srcStride));
+    __m128i r7 = _mm_loadl_epi64((const __m128i*)(src + 7 * srcStride));
+
+    __m128i t0 = _mm_unpacklo_epi8(r0, r1);
+    __m128i t1 = _mm_unpacklo_epi8(r2, r3);
+    __m128i t2 = _mm_unpacklo_epi8(r4, r5);
+    __m128i t3 = _mm_unpacklo_epi8(r6, r7);
+
+    __m128i u0 = _mm_unpacklo_epi16(t0, t1);
+    __m128i u1 = _mm_unpackhi_epi16(t0, t1);
+    __m128i u2 = _mm_unpacklo_epi16(t2, t3);
+    __m128i u3 = _mm_unpackhi_epi16(t2, t3);
+
+    // columns 0 1, 2 3, 4 5, 6 7
+    __m128i c01 = _mm_unpacklo_epi32(u0, u2);
+    __m128i c23 = _mm_unpackhi_epi32(u0, u2);
+    __m128i c45 = _mm_unpacklo_epi32(u1, u3);
+    __m128i c67 = _mm_unpackhi_epi32(u1, u3);
+
+    _mm_storel_epi64((__m128i*)(dst), c01);
+    _mm_storel_epi64((__m128i*)(dst + dstStride), _mm_srli_si128(c01, 8));
+    _mm_storel_epi64((__m128i*)(dst + 2 * dstStride), c23);
+    _mm_storel_epi64((__m128i*)(dst + 3 * dstStride), _mm_srli_si128(c23, 8));
+    _mm_storel_epi64((__m128i*)(dst + 4 * dstStride), c45);
+    _mm_storel_epi64((__m128i*)(dst + 5 * dstStride), _mm_srli_si128(c45, 8));
+    _mm_storel_epi64((__m128i*)(dst + 6 * dstStride), c67);
+    _mm_storel_epi64((__m128i*)(dst + 7 * dstStride), _mm_srli_si128(c67, 8));
+#elif defined(__ARM_NEON)
+    uint8x8x2_t a = vtrn_u8(vld1_u8(src), vld1_u8(src + srcStride));
+    uint8x8x2_t b = vtrn_u8(vld1_u8(src + 2 * srcStride), vld1_u8(src + 3 * srcStride));
+    uint8x8x2_t c = vtrn_u8(vld1_u8(src + 4 * srcStride), vld1_u8(src + 5 * srcStride));
+    uint8x8x2_t d = vtrn_u8(vld1_u8(src + 6 * srcStride), vld1_u8(src + 7 * srcStride));
+
+    // even columns in val[0], odd columns in val[1]
+    uint16x4x2_t e = vtrn_u16(vreinterpret_u16_u8(a.val[0]), vreinterpret_u16_u8(b.val[0]));
+    uint16x4x2_t f = vtrn_u16(vreinterpret_u16_u8(a.val[1]), vreinterpret_u16_u8(b.val[1]));
+    uint16x4x2_t g = vtrn_u16(vreinterpret_u16_u8(c.val[0]), vreinterpret_u16_u8(d.val[0]));
+    uint16x4x2_t h = vtrn_u16(vreinterpret_u16_u8(c.val[1]), vreinterpret_u16_u8(d.val[1]));
+
+    // columns 0 4, 1 5, 2 6, 3 7
+    uint32x2x2_t c04 = vtrn_u32(vreinterpret_u32_u16(e.val[0]), vreinterpret_u32_u16(g.val[0]));
+    uint32x2x2_t c15 = vtrn_u32(vreinterpret_u32_u16(f.val[0]), vreinterpret_u32_u16(h.val[0]));
+    uint32x2x2_t c26 = vtrn_u32(vreinterpret_u32_u16(e.val[1]), vreinterpret_u32_u16(g.val[1]));
+    uint32x2x2_t c37 = vtrn_u32(vreinterpret_u32_u16(f.val[1]), vreinterpret_u32_u16(h.val[1]));
+
+    vst1_u8(dst, vreinterpret_u8_u32(c04.val[0]));
+    vst1_u8(dst + dstStride, vreinterpret_u8_u32(c15.val[0]));
+    vst1_u8(dst + 2 * dstStride, vreinterpret_u8_u32(c26.val[0]));
+    vst1_u8(dst + 3 * dstStride, vreinterpret_u8_u32(c37.val[0]));
+    vst1_u8(dst + 4 * dstStride, vreinterpret_u8_u32(c04.val[1]));
+    vst1_u8(dst + 5 * dstStride, vreinterpret_u8_u32(c15.val[1]));
+    vst1_u8(dst + 6 * dstStride, vreinterpret_u8_u32(c26.val[1]));
+    vst1_u8(dst + 7 * dstStride, vreinterpret_u8_u32(c37.val[1]));
+#else
+    for (int32_t i = 0; i < 8; i++) {
+        for (int32_t k = 0; k < 8; k++) {
+            dst[i * dstStride + k] = src[k * srcStride + i];
+        }
+    }
+#endif
+}
+
+// Sample (x, y) of the width x height dst is at src + rowOffset[y] + colOffset[x].
+// Rotation is clockwise as DpBlitStream::setRotate, scaling is nearest.
+static void buildOffsets(int32_t degree, const Plane& src, int32_t srcW, int32_t srcH,
+                         int32_t width, int32_t height, int32_t* rowOffset, int32_t* colOffset) {
+    bool transposed = (degree == 90 || degree == 270);
+    int32_t rotW = transposed ? srcH : srcW;
+    int32_t rotH = transposed ? srcW : srcH;
+
+    for (int32_t x = 0; x < width; x++) {
+        int32_t rx = (2 * x + 1) * rotW / (2 * width);
+
+        switch (degree) {
+            case 90:
+                colOffset[x] = (srcH - 1 - rx) * src.stride;
+                break;
+            case 180:
+                colOffset[x] = (srcW - 1 - rx) * src.step;
+                break;
+            case 270:
+                colOffset[x] = rx * src.stride;
+                break;
+            default:
+                colOffset[x] = rx * src.step;
+                break;
+        }
+    }
+
+    for (int32_t y = 0; y < height; y++) {
+        int32_t ry = (2 * y + 1) * rotH / (2 * height);
+
+        switch (degree) {
+            case 90:
+                rowOffset[y] = ry * src.step;
+                break;
+            case 180:
+                rowOffset[y] = (srcH - 1 - ry) * src.stride;
+                break;
+            case 270:
+                rowOffset[y] = (srcW - 1 - ry) * src.step;
+                break;
+            default:
+                rowOffset[y] = ry * src.stride;
+                break;
+        }
+    }
+}
+
+// tiled, a rotated dst row walks a src column
+static void gatherPlane(const Plane& src, const Plane& dst, const int32_t* rowOffset,
+                        const int32_t* colOffset, int32_t y0, int32_t y1, int32_t x0, int32_t x1) {
+    for (int32_t ty = y0; ty < y1; ty += kGatherTile) {
+        int32_t tyEnd = (ty + kGatherTile < y1) ? ty + kGatherTile : y1;
+
+        for (int32_t tx = x0; tx < x1; tx += kGatherTile) {
+            int32_t txEnd = (tx + kGatherTile < x1) ? tx + kGatherTile : x1;
+
+            for (int32_t y = ty; y < tyEnd; y++) {
+                const uint8_t* in = src.data + rowOffset[y];
+                uint8_t* out = dst.data + y * dst.stride;
+
+                for (int32_t x = tx; x < txEnd; x++) {
+                    out[x * dst.step] = in[colOffset[x]];
+                }
+            }
+        }
+    }
+}
+
+static void remapPlane(const Plane& src, const Plane& dst, int32_t width, int32_t height,
+                       const int32_t* rowOffset, const int32_t* colOffset, bool transposed,
+                       bool scaled) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    bool packed = (src.step == 1 && dst.step == 1);
+
+    if (!transposed && !scaled && packed && colOffset[width - 1] - colOffset[0] == width - 1) {
+        // 0 degree
+        for (int32_t y = 0; y < height; y++) {
+            memcpy(dst.data + y * dst.stride, src.data + rowOffset[y] + colOffset[0], width);
+        }
+
+        return;
+    }
+
+    int32_t blockW = 0;
+    int32_t blockH = 0;
+
+    if (transposed && !scaled && packed) {
+        blockW = width & ~7;
+        blockH = height & ~7;
+
+        for (int32_t y = 0; y < blockH; y += 8) {
+            // rowOffset goes up by 1 for 90 degree and down by 1 for 270 degree
+            bool ascending = rowOffset[y + 1] > rowOffset[y];
+            int32_t rowBase = ascending ? rowOffset[y] : rowOffset[y + 7];
+            uint8_t* out = dst.data + (ascending ? y : y + 7) * dst.stride;
+            int32_t outStride = ascending ? dst.stride : -dst.stride;
+
+            for (int32_t x = 0; x < blockW; x += 8) {
+                transpose8x8(src.data + rowBase + colOffset[x], colOffset[x + 1] - colOffset[x],
+                             out + x, outStride);
+            }
+        }
+    }
+
+    gatherPlane(src, dst, rowOffset, colOffset, 0, blockH, blockW, width);
+    gatherPlane(src, dst, rowOffset, colOffset, blockH, height, 0, width);
+}
+
+static void fillPlane(const Plane& plane, int32_t x, int32_t width, int32_t height, uint8_t value) {
+    for (int32_t y = 0; y < height; y++) {
+        uint8_t* out = plane.data + y * plane.stride + x * plane.step;
+
+        if (plane.step == 1) {
+            memset(out, value, width);
+        } else {
+            for (int32_t i = 0; i < width; i++) {
+                out[i * plane.step] = value;
+            }
+        }
+    }
+}
+
+int64_t RotateBufferSW(uint8_t* input, uint8_t* output, RotateInfo* info, int32_t* outFillLen) {
+    int64_t startTimeUs = systemTime(SYSTEM_TIME_MONOTONIC) / 1000ll;
+
+    int32_t srcWidth = info->mSrcWidth;
+    int32_t srcHeight = info->mSrcHeight;
+    int32_t tarWidth = info->mTargetWidth;
+    int32_t tarHeight = info->mTargetHeight;
+    int32_t degree = info->mRotateDegree;
+    int32_t srcFormat = info->mSrcColorFormat;
+    int32_t tarFormat = info->mTargetColorFormat;
+    int32_t ro_type = info->mRotateType;
+
+    ATRACE_CALL();
+    VT_LOGD("input %p,s-w %d,s-h %d,s-F %s, t-w %d,t-h %d,t-F %s,output %p, degree %d,ro_type %d",
+            input, srcWidth, srcHeight, OmxFormatToString(srcFormat), tarWidth, tarHeight,
+            OmxFormatToString(tarFormat), output, degree, ro_type);
+
+    char value[PROPERTY_VALUE_MAX];
+
+    if (property_get("vendor.vt.ro.degree", value, NULL)) {
+        degree = atoi(value);
+    }
+
+    if (degree != 0 && degree != 90 && degree != 180 && degree != 270) {
+        VT_LOGE("ERROR not supported degree %d", degree);
+        return -1;
+    }
+
+    YUVFrame src;
+    YUVFrame dst;
+    uint8_t* converted = NULL;
+
+    if (srcFormat == OMX_COLOR_Format32BitRGBA8888 || srcFormat == OMX_COLOR_Format32bitARGB8888) {
+        converted = convertRGBToI420(input, srcFormat, srcWidth, srcHeight, &src);
+
+        if (converted == NULL) {
+            VT_LOGE("no memory for %dx%d", srcWidth, srcHeight);
+            return -1;
+        }
+    } else if (!setupYUVFrame(input, srcFormat, srcWidth, srcHeight, &src)) {
+        // the MTK block formats are left to MDP
+        VT_LOGE("ERROR not supported color format: srcFormat(%s)", OmxFormatToString(srcFormat));
+        return -1;
+    }
+
+    if (!setupYUVFrame(output, tarFormat, tarWidth, tarHeight, &dst)) {
+        VT_LOGE("ERROR not supported color format: tarFormat(%s)", OmxFormatToString(tarFormat));
+        free(converted);
+        return -1;
+    }
+
+    *outFillLen = dst.size;
+
+    // same src and dst rect as the MDP path
+    int32_t srcX = 0;
+    int32_t srcW = ROUND_2(srcWidth);
+    int32_t srcH = ROUND_2(srcHeight);
+
+    if (ro_type == ROT_KEEP_RATIO_WITH_CROP) {
+        srcW = ROUND_2(srcHeight * srcHeight / srcWidth);
+        srcX = ROUND_2((srcWidth - srcW) / 2);
+    }
+
+    int32_t dstX = 0;
+    int32_t dstW = ROUND_2(tarWidth);
+    int32_t dstH = ROUND_2(tarHeight);
+
+    if (ro_type == ROT_KEEP_RATIO_WITH_BLACK_EDGE) {
+        dstW = ROUND_2(tarHeight * tarHeight / tarWidth);
+        dstX = ROUND_2((tarWidth - dstW) / 2);
+
+        // MDP leaves the edges alone, the CPU has no cache issue to fill them
+        for (int32_t i = 0; i < 3; i++) {
+            int32_t shift = (i == 0) ? 0 : 1;
+            uint8_t black = (i == 0) ? kBlackY : kBlackUV;
+            int32_t right = (dstX + dstW) >> shift;
+
+            fillPlane(dst.plane[i], 0, dstX >> shift, dstH >> shift, black);
+            fillPlane(dst.plane[i], right, (ROUND_2(tarWidth) >> shift) - right, dstH >> shift,
+                      black);
+        }
+    }
+
+    int32_t* offsets = (int32_t*)malloc((dstW + dstH) * sizeof(int32_t));
+
+    if (offsets == NULL) {
+        VT_LOGE("no memory for %dx%d", dstW, dstH);
+        free(converted);
+        return -1;
+    }
+
+    bool transposed = (degree == 90 || degree == 270);
+
+    for (int32_t i = 0; i < 3; i++) {
+        int32_t shift = (i == 0) ? 0 : 1;
+        int32_t width = dstW >> shift;
+        int32_t height = dstH >> shift;
+        int32_t rotW = (transposed ? srcH : srcW) >> shift;
+        int32_t rotH = (transposed ? srcW : srcH) >> shift;
+
+        Plane in = src.plane[i];
+        in.data += (srcX >> shift) * in.step;
+        Plane out = dst.plane[i];
+        out.data += (dstX >> shift) * out.step;
+
+        buildOffsets(degree, in, srcW >> shift, srcH >> shift, width, height, offsets,
+                     offsets + height);
+        remapPlane(in, out, width, height, offsets, offsets + height, transposed,
+                   rotW != width || rotH != height);
+    }
+
+    free(offsets);
+    free(converted);
+
+    int64_t endTimeUs = systemTime(SYSTEM_TIME_MONOTONIC) / 1000ll;
+    int64_t useTimeMs = (endTimeUs - startTimeUs) / 1000ll;
+    VT_LOGV("[profile]rotate by cpu use timeUs %lld us", (long long)(endTimeUs - startTimeUs));
+    return useTimeMs;
+}
+
+}  // namespace android
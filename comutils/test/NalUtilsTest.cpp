@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <media/stagefright/foundation/avc_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utils/Timers.h>
+#include <vector>
+
+#include "comutils.h"
+
+// libvcodec_cap, not in a header
+int32_t searchStartCode(int32_t startpos, unsigned long u4BSStartVA, unsigned long u4BSSize);
+
+namespace android {
+
+// the byte loop searchStartCode of vcodeccap used before FindNALStartCode
+static int32_t searchStartCodeByteLoop(int32_t startpos, unsigned long u4BSStartVA,
+                                       unsigned long u4BSSize) {
+    uint32_t pos = startpos;
+    char* pBSStartVA = (char*)u4BSStartVA;
+    for (; pos < u4BSSize - 5; pos++) {
+        if (pBSStartVA[pos] == 0x00 && pBSStartVA[pos + 1] == 0x00 && pBSStartVA[pos + 2] == 0x00 &&
+            pBSStartVA[pos + 3] == 0x01) {
+            return pos;
+        }
+    }
+    return 0;
+}
+
+// the byte loop removePreventionByte of vcodeccap and comutils used before RemovePreventionBytes
+static void removePreventionByteLoop(uint8_t* profile_tier_level, uint8_t size) {
+    int32_t pos = 0;
+    for (; pos < size - 2;) {
+        if (profile_tier_level[pos] == 0x00 && profile_tier_level[pos + 1] == 0x00 &&
+            profile_tier_level[pos + 2] == 0x03) {
+            memmove(profile_tier_level + pos + 2, profile_tier_level + pos + 3, size - (pos + 3));
+            pos += 2;
+        } else {
+            pos++;
+        }
+    }
+}
+
+// mostly 0x00, 0x01 and 0x03 so start codes, emulation prevention and their near misses
+// show up in short buffers
+static std::vector<uint8_t> makeRandomBytes(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        int r = rand() % 8;
+        data[i] = r < 4 ? 0x00 : r < 6 ? 0x01 : r < 7 ? 0x03 : rand() % 256;
+    }
+    return data;
+}
+
+// an access unit of NALs of nalSize bytes, no 0x00 0x00 inside a NAL
+static std::vector<uint8_t> makeAccessUnit(size_t size, size_t nalSize) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = rand() % 255 + 1;
+    }
+    for (size_t i = 0; i + 4 <= size; i += nalSize) {
+        data[i] = 0x00;
+        data[i + 1] = 0x00;
+        data[i + 2] = 0x00;
+        data[i + 3] = 0x01;
+    }
+    return data;
+}
+
+TEST(NalUtilsTest, GetNextNALUnitMatchesStagefright) {
+    srand(1);
+    for (int i = 0; i < 100000; i++) {
+        std::vector<uint8_t> data = makeRandomBytes(rand() % 128);
+
+        for (int startCodeFollows = 0; startCodeFollows < 2; startCodeFollows++) {
+            const uint8_t* refData = data.data();
+            size_t refSize = data.size();
+            const uint8_t* newData = data.data();
+            size_t newSize = data.size();
+
+            for (;;) {
+                const uint8_t* refNal;
+                size_t refNalSize;
+                const uint8_t* newNal;
+                size_t newNalSize;
+                status_t refErr =
+                        getNextNALUnit(&refData, &refSize, &refNal, &refNalSize, startCodeFollows);
+                status_t newErr =
+                        GetNextNALUnit(&newData, &newSize, &newNal, &newNalSize, startCodeFollows);
+
+                ASSERT_EQ(refErr, newErr) << "buffer " << i;
+                ASSERT_EQ(refNal, newNal) << "buffer " << i;
+                ASSERT_EQ(refNalSize, newNalSize) << "buffer " << i;
+                ASSERT_EQ(refData, newData) << "buffer " << i;
+                ASSERT_EQ(refSize, newSize) << "buffer " << i;
+
+                if (refErr != OK || refData == NULL) {
+                    break;
+                }
+            }
+        }
+    }
+}
+
+TEST(NalUtilsTest, SearchStartCodeMatchesByteLoop) {
+    srand(2);
+    for (int i = 0; i < 100000; i++) {
+        // the byte loop needs 5 bytes or more
+        std::vector<uint8_t> data = makeRandomBytes(5 + rand() % 128);
+        int32_t startpos = rand() % data.size();
+
+        ASSERT_EQ(searchStartCodeByteLoop(startpos, (unsigned long)data.data(), data.size()),
+                  searchStartCode(startpos, (unsigned long)data.data(), data.size()))
+                << "buffer " << i << " from " << startpos;
+    }
+}
+
+TEST(NalUtilsTest, RemovePreventionBytesMatchesByteLoop) {
+    srand(3);
+    for (int i = 0; i < 100000; i++) {
+        // the byte loop takes an uint8_t size
+        std::vector<uint8_t> data = makeRandomBytes(3 + rand() % 253);
+        std::vector<uint8_t> ref = data;
+
+        removePreventionByteLoop(ref.data(), ref.size());
+        size_t size = RemovePreventionBytes(data.data(), data.size());
+
+        ASSERT_LE(size, data.size());
+        ASSERT_EQ(0, memcmp(ref.data(), data.data(), size)) << "buffer " << i;
+    }
+}
+
+// GB/s of scanning an 8 MB access unit of 1400 byte NALs
+TEST(NalUtilsTest, ScanBenchmark) {
+    const size_t size = 8 * 1024 * 1024;
+    const int rounds = 10;
+    srand(4);
+    std::vector<uint8_t> data = makeAccessUnit(size, 1400);
+
+    size_t refNals = 0;
+    nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+    for (int round = 0; round < rounds; round++) {
+        const uint8_t* p = data.data();
+        size_t left = size;
+        const uint8_t* nal;
+        size_t nalSize;
+        while (getNextNALUnit(&p, &left, &nal, &nalSize, true) == OK) {
+            refNals++;
+        }
+    }
+    nsecs_t refNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+
+    size_t newNals = 0;
+    start = systemTime(SYSTEM_TIME_MONOTONIC);
+    for (int round = 0; round < rounds; round++) {
+        const uint8_t* p = data.data();
+        size_t left = size;
+        const uint8_t* nal;
+        size_t nalSize;
+        while (GetNextNALUnit(&p, &left, &nal, &nalSize, true) == OK) {
+            newNals++;
+        }
+    }
+    nsecs_t newNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+    EXPECT_EQ(refNals, newNals);
+
+    // searchStartCode walks the access unit one start code at a time
+    size_t refCodes = 0;
+    start = systemTime(SYSTEM_TIME_MONOTONIC);
+    for (int round = 0; round < rounds; round++) {
+        int32_t pos = 0;
+        while ((pos = searchStartCodeByteLoop(pos + 1, (unsigned long)data.data(), size)) > 0) {
+            refCodes++;
+        }
+    }
+    nsecs_t refSearchNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+
+    size_t newCodes = 0;
+    start = systemTime(SYSTEM_TIME_MONOTONIC);
+    for (int round = 0; round < rounds; round++) {
+        int32_t pos = 0;
+        while ((pos = searchStartCode(pos + 1, (unsigned long)data.data(), size)) > 0) {
+            newCodes++;
+        }
+    }
+    nsecs_t newSearchNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+    EXPECT_EQ(refCodes, newCodes);
+
+    double bytes = (double)size * rounds;
+    printf("getNextNALUnit %.2f GB/s, GetNextNALUnit %.2f GB/s\n", bytes / refNs, bytes / newNs);
+    printf("searchStartCode byte loop %.2f GB/s, searchStartCode %.2f GB/s\n",
+           bytes / refSearchNs, bytes / newSearchNs);
+}
+
+// GB/s of removing the emulation prevention of parameter sets, 255 bytes each
+TEST(NalUtilsTest, RemovePreventionBenchmark) {
+    const size_t size = 255;
+    const int rounds = 40000;
+    srand(5);
+    std::vector<uint8_t> data = makeAccessUnit(size, size);
+    for (size_t i = 8; i + 3 <= size; i += 24) {
+        data[i] = 0x00;
+        data[i + 1] = 0x00;
+        data[i + 2] = 0x03;
+    }
+
+    std::vector<uint8_t> ref(size);
+    nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+    for (int round = 0; round < rounds; round++) {
+        memcpy(ref.data(), data.data(), size);
+        removePreventionByteLoop(ref.data(), size);
+    }
+    nsecs_t refNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+
+    std::vector<uint8_t> out(size);
+    size_t left = 0;
+    start = systemTime(SYSTEM_TIME_MONOTONIC);
+    for (int round = 0; round < rounds; round++) {
+        memcpy(out.data(), data.data(), size);
+        left = RemovePreventionBytes(out.data(), size);
+    }
+    nsecs_t newNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+    EXPECT_EQ(0, memcmp(ref.data(), out.data(), left));
+
+    double bytes = (double)size * rounds;
+    printf("emulation prevention of %zu bytes: byte loop %.2f GB/s, RemovePreventionBytes %.2f "
+           "GB/s\n",
+           size, bytes / refNs, bytes / newNs);
+}
+
+}  // namespace android
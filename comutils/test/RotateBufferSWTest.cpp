@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <OMX_IVCommon.h>
+#include <OMX_Video.h>
+#include <OMX_VideoExt.h>
+#include <stdio.h>
+#include <utils/Timers.h>
+#include <vector>
+
+#include "comutils.h"
+
+#define ROUND_16(X) ((X + 0xF) & (~0xF))
+
+namespace android {
+
+// one plane of a 4:2:0 frame, in the layouts RotateBufferSW documents
+struct PlaneRef {
+    uint8_t* data;
+    int32_t stride;
+    int32_t step;
+};
+
+static size_t frameSize(int32_t format, int32_t width, int32_t height) {
+    int32_t wStride = ROUND_16(width);
+    int32_t ySize = wStride * ROUND_16(height);
+
+    if (format == OMX_MTK_COLOR_FormatYV12) {
+        return ySize + 2 * ROUND_16(wStride / 2) * (ROUND_16(height) / 2);
+    }
+    return ySize + ySize / 2;
+}
+
+static PlaneRef planeOf(uint8_t* base, int32_t format, int32_t width, int32_t height, int32_t i) {
+    int32_t wStride = ROUND_16(width);
+    int32_t ySize = wStride * ROUND_16(height);
+    PlaneRef plane = {base, wStride, 1};
+
+    if (i == 0) {
+        return plane;
+    }
+
+    if (format == OMX_COLOR_FormatYUV420Planar) {
+        plane.data = base + ySize + (i == 1 ? 0 : ySize / 4);
+        plane.stride = wStride / 2;
+    } else if (format == OMX_MTK_COLOR_FormatYV12) {
+        int32_t uvStride = ROUND_16(wStride / 2);
+        int32_t uvSize = uvStride * (ROUND_16(height) / 2);
+        plane.data = base + ySize + (i == 1 ? uvSize : 0);
+        plane.stride = uvStride;
+    } else {
+        // NV21, V U interleaved
+        plane.data = base + ySize + (i == 1 ? 1 : 0);
+        plane.step = 2;
+    }
+    return plane;
+}
+
+static uint8_t pattern(int32_t x, int32_t y, int32_t i) {
+    return (uint8_t)(x * 7 + y * 13 + i * 50);
+}
+
+static std::vector<uint8_t> makeFrame(int32_t format, int32_t width, int32_t height) {
+    std::vector<uint8_t> frame(frameSize(format, width, height));
+
+    for (int32_t i = 0; i < 3; i++) {
+        int32_t shift = (i == 0) ? 0 : 1;
+        PlaneRef plane = planeOf(frame.data(), format, width, height, i);
+
+        for (int32_t y = 0; y < height >> shift; y++) {
+            for (int32_t x = 0; x < width >> shift; x++) {
+                plane.data[y * plane.stride + x * plane.step] = pattern(x, y, i);
+            }
+        }
+    }
+    return frame;
+}
+
+// clockwise, as DpBlitStream::setRotate
+static uint8_t rotatedSample(int32_t degree, int32_t srcW, int32_t srcH, int32_t x, int32_t y,
+                             int32_t i) {
+    switch (degree) {
+        case 90:
+            return pattern(y, srcH - 1 - x, i);
+        case 180:
+            return pattern(srcW - 1 - x, srcH - 1 - y, i);
+        case 270:
+            return pattern(srcW - 1 - y, x, i);
+        default:
+            return pattern(x, y, i);
+    }
+}
+
+static void expectRotated(int32_t srcFormat, int32_t dstFormat, int32_t width, int32_t height,
+                          int32_t degree) {
+    bool transposed = (degree == 90 || degree == 270);
+    int32_t dstWidth = transposed ? height : width;
+    int32_t dstHeight = transposed ? width : height;
+
+    std::vector<uint8_t> src = makeFrame(srcFormat, width, height);
+    std::vector<uint8_t> dst(frameSize(dstFormat, dstWidth, dstHeight));
+
+    RotateInfo info;
+    memset(&info, 0, sizeof(info));
+    info.mRotateDegree = degree;
+    info.mSrcWidth = width;
+    info.mSrcHeight = height;
+    info.mSrcColorFormat = srcFormat;
+    info.mTargetWidth = dstWidth;
+    info.mTargetHeight = dstHeight;
+    info.mTargetColorFormat = dstFormat;
+    info.mRotateType = ROT_A_DEGREE_NOT_KEEP_RATIO;
+
+    int32_t fillLen = 0;
+    ASSERT_GE(RotateBufferSW(src.data(), dst.data(), &info, &fillLen), 0);
+    EXPECT_EQ(dst.size(), (size_t)fillLen);
+
+    for (int32_t i = 0; i < 3; i++) {
+        int32_t shift = (i == 0) ? 0 : 1;
+        PlaneRef plane = planeOf(dst.data(), dstFormat, dstWidth, dstHeight, i);
+
+        for (int32_t y = 0; y < dstHeight >> shift; y++) {
+            for (int32_t x = 0; x < dstWidth >> shift; x++) {
+                ASSERT_EQ(rotatedSample(degree, width >> shift, height >> shift, x, y, i),
+                          plane.data[y * plane.stride + x * plane.step])
+                        << "degree " << degree << " plane " << i << " at (" << x << ", " << y
+                        << ")";
+            }
+        }
+    }
+}
+
+TEST(RotateBufferSWTest, RotatesI420) {
+    // the chroma planes are not a multiple of the 8x8 transpose blocks
+    expectRotated(OMX_COLOR_FormatYUV420Planar, OMX_COLOR_FormatYUV420Planar, 40, 24, 0);
+    expectRotated(OMX_COLOR_FormatYUV420Planar, OMX_COLOR_FormatYUV420Planar, 40, 24, 90);
+    expectRotated(OMX_COLOR_FormatYUV420Planar, OMX_COLOR_FormatYUV420Planar, 40, 24, 180);
+    expectRotated(OMX_COLOR_FormatYUV420Planar, OMX_COLOR_FormatYUV420Planar, 40, 24, 270);
+}
+
+TEST(RotateBufferSWTest, ConvertsLayoutWhileRotating) {
+    expectRotated(OMX_MTK_COLOR_FormatYV12, OMX_COLOR_FormatYUV420Planar, 64, 48, 90);
+    expectRotated(OMX_COLOR_FormatYUV420Planar, OMX_COLOR_FormatYUV420SemiPlanar, 64, 48, 270);
+    expectRotated(OMX_COLOR_FormatYUV420SemiPlanar, OMX_MTK_COLOR_FormatYV12, 64, 48, 180);
+}
+
+TEST(RotateBufferSWTest, FillsBlackEdges) {
+    const int32_t width = 64;
+    const int32_t height = 48;
+
+    std::vector<uint8_t> src = makeFrame(OMX_COLOR_FormatYUV420Planar, width, height);
+    std::vector<uint8_t> dst(frameSize(OMX_COLOR_FormatYUV420Planar, width, height));
+
+    RotateInfo info;
+    memset(&info, 0, sizeof(info));
+    info.mRotateDegree = 90;
+    info.mSrcWidth = width;
+    info.mSrcHeight = height;
+    info.mSrcColorFormat = OMX_COLOR_FormatYUV420Planar;
+    info.mTargetWidth = width;
+    info.mTargetHeight = height;
+    info.mTargetColorFormat = OMX_COLOR_FormatYUV420Planar;
+    info.mRotateType = ROT_KEEP_RATIO_WITH_BLACK_EDGE;
+
+    int32_t fillLen = 0;
+    ASSERT_GE(RotateBufferSW(src.data(), dst.data(), &info, &fillLen), 0);
+
+    // the rotated picture is 36 wide, centered in the 64 wide frame
+    PlaneRef y = planeOf(dst.data(), OMX_COLOR_FormatYUV420Planar, width, height, 0);
+    PlaneRef u = planeOf(dst.data(), OMX_COLOR_FormatYUV420Planar, width, height, 1);
+    EXPECT_EQ(16, y.data[0]);
+    EXPECT_EQ(16, y.data[(height - 1) * y.stride + width - 1]);
+    EXPECT_EQ(128, u.data[0]);
+    EXPECT_EQ(128, u.data[(height / 2 - 1) * u.stride + width / 2 - 1]);
+}
+
+TEST(RotateBufferSWTest, RejectsUnsupportedInput) {
+    std::vector<uint8_t> src = makeFrame(OMX_COLOR_FormatYUV420Planar, 16, 16);
+    std::vector<uint8_t> dst(src.size());
+
+    RotateInfo info;
+    memset(&info, 0, sizeof(info));
+    info.mRotateDegree = 45;
+    info.mSrcWidth = 16;
+    info.mSrcHeight = 16;
+    info.mSrcColorFormat = OMX_COLOR_FormatYUV420Planar;
+    info.mTargetWidth = 16;
+    info.mTargetHeight = 16;
+    info.mTargetColorFormat = OMX_COLOR_FormatYUV420Planar;
+    info.mRotateType = ROT_A_DEGREE_NOT_KEEP_RATIO;
+
+    int32_t fillLen = 0;
+    EXPECT_EQ(-1, RotateBufferSW(src.data(), dst.data(), &info, &fillLen));
+
+    info.mRotateDegree = 90;
+    info.mTargetColorFormat = OMX_COLOR_FormatYUV422Planar;
+    EXPECT_EQ(-1, RotateBufferSW(src.data(), dst.data(), &info, &fillLen));
+}
+
+// the per pixel gather of a CPU rotate without the 8x8 transposes, clockwise
+static void rotateByteLoop(uint8_t* src, uint8_t* dst, int32_t format, int32_t width,
+                           int32_t height, int32_t degree) {
+    bool transposed = (degree == 90 || degree == 270);
+    int32_t dstWidth = transposed ? height : width;
+    int32_t dstHeight = transposed ? width : height;
+
+    for (int32_t i = 0; i < 3; i++) {
+        int32_t shift = (i == 0) ? 0 : 1;
+        int32_t srcW = width >> shift;
+        int32_t srcH = height >> shift;
+        PlaneRef from = planeOf(src, format, width, height, i);
+        PlaneRef to = planeOf(dst, format, dstWidth, dstHeight, i);
+
+        for (int32_t y = 0; y < dstHeight >> shift; y++) {
+            for (int32_t x = 0; x < dstWidth >> shift; x++) {
+                int32_t sx = x;
+                int32_t sy = y;
+
+                if (degree == 90) {
+                    sx = y;
+                    sy = srcH - 1 - x;
+                } else if (degree == 180) {
+                    sx = srcW - 1 - x;
+                    sy = srcH - 1 - y;
+                } else if (degree == 270) {
+                    sx = srcW - 1 - y;
+                    sy = x;
+                }
+                to.data[y * to.stride + x * to.step] = from.data[sy * from.stride + sx * from.step];
+            }
+        }
+    }
+}
+
+// ms per frame of the camera resolutions, same output for both
+TEST(RotateBufferSWTest, RotateBenchmark) {
+    const int32_t sizes[][2] = {{320, 240}, {640, 480}, {1280, 720}, {1920, 1080}};
+    const int32_t degrees[] = {90, 180, 270};
+    const int32_t formats[] = {OMX_COLOR_FormatYUV420Planar, OMX_COLOR_FormatYUV420SemiPlanar};
+    const int rounds = 20;
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+            for (size_t d = 0; d < sizeof(degrees) / sizeof(degrees[0]); d++) {
+                int32_t width = sizes[s][0];
+                int32_t height = sizes[s][1];
+                int32_t format = formats[f];
+                int32_t degree = degrees[d];
+                bool transposed = (degree == 90 || degree == 270);
+
+                std::vector<uint8_t> src = makeFrame(format, width, height);
+                std::vector<uint8_t> ref(frameSize(format, height, width));
+                std::vector<uint8_t> dst(ref.size());
+
+                RotateInfo info;
+                memset(&info, 0, sizeof(info));
+                info.mRotateDegree = degree;
+                info.mSrcWidth = width;
+                info.mSrcHeight = height;
+                info.mSrcColorFormat = format;
+                info.mTargetWidth = transposed ? height : width;
+                info.mTargetHeight = transposed ? width : height;
+                info.mTargetColorFormat = format;
+                info.mRotateType = ROT_A_DEGREE_NOT_KEEP_RATIO;
+
+                nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+                for (int round = 0; round < rounds; round++) {
+                    rotateByteLoop(src.data(), ref.data(), format, width, height, degree);
+                }
+                nsecs_t refNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+
+                int32_t fillLen = 0;
+                start = systemTime(SYSTEM_TIME_MONOTONIC);
+                for (int round = 0; round < rounds; round++) {
+                    ASSERT_GE(RotateBufferSW(src.data(), dst.data(), &info, &fillLen), 0);
+                }
+                nsecs_t newNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+
+                EXPECT_EQ(ref, dst) << width << "x" << height << " degree " << degree;
+
+                printf("%dx%d %s %d: byte loop %.2f ms, RotateBufferSW %.2f ms\n", width, height,
+                       format == OMX_COLOR_FormatYUV420Planar ? "I420" : "NV21", degree,
+                       refNs / 1e6 / rounds, newNs / 1e6 / rounds);
+            }
+        }
+    }
+}
+
+}  // namespace android
@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include <RfxStatusDefs.h>
 
 #include "carrierconfig.h"
@@ -1155,23 +1156,133 @@ const static CarrierConfigValue carierConfigData[] = {
 };
 
 /**
- * Return the start index of CarrierConfigValue array for specific MCC/MNC
- * @param mccmnc  mobile country code and mobile network code string
- * @retrun the start index if found else return -1
+ * MCC/MNC index of carierConfigData, sorted by mcc/mnc string
+ *   start: index of the MCC_MNC_SEPARATOR entry
+ *   count: count of keys following the separator
  */
-int getStartIndex(const char* mccmnc) {
-    int i = 0, found = 0;
+typedef struct CarrierConfigIndexStruct {
+    const char* mccmnc;
+    int start;
+    int count;
+} CarrierConfigIndex;
+
+/* sized from the count of MCC_MNC_SEPARATOR in carierConfigData, NULL if malloc failed */
+static CarrierConfigIndex* sIndex = NULL;
+static int sIndexCount = 0;
+static pthread_once_t sIndexOnce = PTHREAD_ONCE_INIT;
+
+static int compareIndex(const void* a, const void* b) {
+    const CarrierConfigIndex* l = (const CarrierConfigIndex*)a;
+    const CarrierConfigIndex* r = (const CarrierConfigIndex*)b;
+    int ret = strcmp(l->mccmnc, r->mccmnc);
+    /* keep the table order for duplicated mcc/mnc, the first one wins as the linear scan */
+    return (ret != 0) ? ret : (l->start - r->start);
+}
+
+static void buildIndex(void) {
+    int i = 0, n = 0;
+
+    for (i = 0; carierConfigData[i].key != MCC_MNC_END_TAG; i++) {
+        if (carierConfigData[i].key == MCC_MNC_SEPARATOR) {
+            n++;
+        }
+    }
+
+    sIndex = (CarrierConfigIndex*)malloc(n * sizeof(CarrierConfigIndex));
+    if (sIndex == NULL) {
+        /* findIndex() falls back to the linear scan */
+        return;
+    }
 
+    i = 0;
+    n = 0;
     while (carierConfigData[i].key != MCC_MNC_END_TAG) {
-        if ((carierConfigData[i].key == MCC_MNC_SEPARATOR) &&
-            (!strcmp(carierConfigData[i].value, mccmnc))) {
-            found = 1;
-            break;
+        if (carierConfigData[i].key == MCC_MNC_SEPARATOR) {
+            sIndex[n].mccmnc = carierConfigData[i].value;
+            sIndex[n].start = i;
+            sIndex[n].count = 0;
+            n++;
+        } else if (n > 0) {
+            sIndex[n - 1].count++;
         }
         i++;
     }
 
-    return (found == 1) ? i : -1;
+    qsort(sIndex, n, sizeof(CarrierConfigIndex), compareIndex);
+    sIndexCount = n;
+}
+
+/**
+ * Linear scan of carierConfigData for specific MCC/MNC, used only if the index can't be built
+ * @param mccmnc  mobile country code and mobile network code string
+ * @param index  output the start and the count of keys
+ * @return 1 if found else return 0
+ */
+static int scanIndex(const char* mccmnc, CarrierConfigIndex* index) {
+    int i;
+
+    for (i = 0; carierConfigData[i].key != MCC_MNC_END_TAG; i++) {
+        if (carierConfigData[i].key == MCC_MNC_SEPARATOR &&
+            !strcmp(carierConfigData[i].value, mccmnc)) {
+            index->mccmnc = carierConfigData[i].value;
+            index->start = i;
+            index->count = 0;
+            for (i++; carierConfigData[i].key != MCC_MNC_END_TAG &&
+                      carierConfigData[i].key != MCC_MNC_SEPARATOR;
+                 i++) {
+                index->count++;
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Binary search the index for specific MCC/MNC
+ * @param mccmnc  mobile country code and mobile network code string
+ * @param index  output the start and the count of keys
+ * @return 1 if found else return 0
+ */
+static int findIndex(const char* mccmnc, CarrierConfigIndex* index) {
+    int low = 0, high, mid;
+
+    if (mccmnc == NULL) {
+        return 0;
+    }
+
+    pthread_once(&sIndexOnce, buildIndex);
+    if (sIndex == NULL) {
+        return scanIndex(mccmnc, index);
+    }
+
+    /* lower bound, so the first one of duplicated mcc/mnc is returned */
+    high = sIndexCount;
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        if (strcmp(sIndex[mid].mccmnc, mccmnc) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    if (low < sIndexCount && !strcmp(sIndex[low].mccmnc, mccmnc)) {
+        *index = sIndex[low];
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Return the start index of CarrierConfigValue array for specific MCC/MNC
+ * @param mccmnc  mobile country code and mobile network code string
+ * @retrun the start index if found else return -1
+ */
+int getStartIndex(const char* mccmnc) {
+    CarrierConfigIndex index;
+
+    return findIndex(mccmnc, &index) ? index.start : -1;
 }
 
 /**
@@ -1180,18 +1291,28 @@ int getStartIndex(const char* mccmnc) {
  * @retrun the count of keys
  */
 unsigned int getKeyCount(const char* mccmnc) {
-    int i = 0, count = 0;
+    CarrierConfigIndex index;
 
-    i = getStartIndex(mccmnc);
+    return findIndex(mccmnc, &index) ? index.count : 0;
+}
 
-    if (i >= 0) {
-        while ((carierConfigData[++i].key != MCC_MNC_SEPARATOR) &&
-               (carierConfigData[i].key != MCC_MNC_END_TAG)) {
-            count++;
-        }
+/**
+ * Retrieve the values of corresponding MCC/MNC without copy
+ * @param mccmnc  mobile country code and mobile network code string
+ * @param count  output the count of values
+ * @return the pointer to the first value in the constant table, NULL if MCC/MNC can't be found
+ *         or has no value. The values must not be modified or freed.
+ */
+const CarrierConfigValue* getConstValuesByMccMnc(const char* mccmnc, unsigned int* count) {
+    CarrierConfigIndex index;
+
+    if (!findIndex(mccmnc, &index) || index.count == 0) {
+        *count = 0;
+        return NULL;
     }
 
-    return count;
+    *count = index.count;
+    return &carierConfigData[index.start + 1];
 }
 
 /**
@@ -1200,18 +1321,16 @@ unsigned int getKeyCount(const char* mccmnc) {
  * @retrun the array of values and the count of values if MCC/MNC can be found, else return 0
  */
 int getValuesByMccMnc(const char* mccmnc, CarrierConfigValue* data) {
-    int i = 0, count = 0, len;
+    const CarrierConfigValue* values;
+    unsigned int i, count;
+    int len;
 
-    i = getStartIndex(mccmnc);
-    if (i >= 0) {
-        while ((carierConfigData[++i].key != MCC_MNC_SEPARATOR) &&
-               (carierConfigData[i].key != MCC_MNC_END_TAG)) {
-            len = strlen(carierConfigData[i].value);
-            data[count].key = carierConfigData[i].key;
-            data[count].value = (char*)calloc(len + 1, sizeof(char));
-            strncpy(data[count].value, carierConfigData[i].value, len);
-            count++;
-        }
+    values = getConstValuesByMccMnc(mccmnc, &count);
+    for (i = 0; i < count; i++) {
+        len = strlen(values[i].value);
+        data[i].key = values[i].key;
+        data[i].value = (char*)calloc(len + 1, sizeof(char));
+        strncpy(data[i].value, values[i].value, len);
     }
 
     return count;
@@ -29,3 +29,17 @@ typedef struct CarrierConfigValueStruct {
     int key;
     char* value;
 } CarrierConfigValue;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* exported by libcarrierconfig, loaded by RtcCarrierConfigController with dlsym */
+int getStartIndex(const char* mccmnc);
+unsigned int getKeyCount(const char* mccmnc);
+int getValuesByMccMnc(const char* mccmnc, CarrierConfigValue* data);
+const CarrierConfigValue* getConstValuesByMccMnc(const char* mccmnc, unsigned int* count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -78,4 +78,34 @@ LOCAL_MULTILIB := first
 
 include $(BUILD_SHARED_LIBRARY)
 
+# ril_event timers and watched fds and the request table of librilfusion,
+# run with: atest librilfusion_event_test
+include $(CLEAR_VARS)
+
+LOCAL_VENDOR_MODULE := true
+
+LOCAL_SRC_FILES := \
+    ril_event.cpp \
+    test/ril_event_bench.cpp \
+    test/ril_event_test.cpp \
+    test/ril_request_test.cpp
+
+LOCAL_SHARED_LIBRARIES := \
+    libmtkrillog \
+    libmtkproperty \
+    librilfusion
+
+LOCAL_C_INCLUDES += \
+    vendor/mediatek/ims/radio_stack/platformlib/include/log \
+    vendor/mediatek/ims/radio_stack/platformlib/include/property
+
+LOCAL_MODULE := librilfusion_event_test
+LOCAL_PROPRIETARY_MODULE := true
+LOCAL_MODULE_OWNER := mtk
+LOCAL_CLANG := true
+
+LOCAL_MULTILIB := first
+
+include $(BUILD_NATIVE_TEST)
+
 endif
@@ -66,8 +66,9 @@ using ::android::hardware::joinRpcThreadpool;
 using ::android::hardware::Return;
 using ::android::hardware::Void;
 
-#define CALL_ONREQUEST(a, b, c, d, e) \
-    s_radioConfigFunctions->onRequest((a), (b), (c), (d), ((RIL_SOCKET_ID)(e)))
+#define CALL_ONREQUEST(a, b, c, d, e)                                             \
+    (android::markRequestDispatched(d),                                           \
+     s_radioConfigFunctions->onRequest((a), (b), (c), (d), ((RIL_SOCKET_ID)(e))))
 
 extern "C" int toRealSlot(int slotId);
 
@@ -28,6 +28,7 @@
 #include <sys/system_properties.h>
 #include <pwd.h>
 #include <stdio.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
@@ -126,7 +127,42 @@ static pthread_mutex_t s_pendingRequestsMutex_sockets[] = {
         PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
         PTHREAD_MUTEX_INITIALIZER};
 
-static RequestInfo* s_pendingRequests_sockets[] = {NULL, NULL, NULL, NULL};
+// Pending requests of each slot, in slabs that are kept for the process.
+// A RIL_Token is the RequestInfo, its tableIndex finds it in O(1).
+// The free list is FIFO, so a freed entry is reused as late as possible.
+#define REQUEST_SLAB_SIZE 64
+
+typedef struct RequestTable {
+    RequestInfo** slabs;
+    int slabCount;
+    int slabCapacity;
+    RequestInfo* freeList;
+    RequestInfo* freeTail;
+    int pendingCount;
+} RequestTable;
+
+static RequestTable s_requestTables[NUM_ELEMS(s_pendingRequestsMutex_sockets)];
+
+// Latency of each request id, in log2 ms buckets: <1ms, <2ms, <4ms ... >=16s
+#define LATENCY_BUCKETS 16
+#define MAX_REQUEST_STATS 512
+
+enum LatencyPhase {
+    LATENCY_QUEUE,     // enqueue to dispatch
+    LATENCY_ACK,       // dispatch to ack
+    LATENCY_COMPLETE,  // dispatch to complete
+    LATENCY_PHASES,
+};
+
+typedef struct RequestStats {
+    int request;  // 0 for an empty entry
+    uint32_t count;
+    uint32_t buckets[LATENCY_PHASES][LATENCY_BUCKETS];
+    int64_t maxUs[LATENCY_PHASES];
+} RequestStats;
+
+static pthread_mutex_t s_requestStatsMutex = PTHREAD_MUTEX_INITIALIZER;
+static RequestStats s_requestStats[MAX_REQUEST_STATS];
 
 static const struct timeval TIMEVAL_WAKE_TIMEOUT = {ANDROID_WAKE_LOCK_SECS,
                                                     ANDROID_WAKE_LOCK_USECS};
@@ -206,66 +242,231 @@ static UnsolResponseInfo s_mtk_unsolResponses[] = {
 
 char* RIL_getServiceName() { return ril_service_name; }
 
-RequestInfo* addRequestToList(int serial, int slotId, int request) {
-    RequestInfo* pRI;
-    int ret;
-    RIL_SOCKET_ID socket_id = (RIL_SOCKET_ID)slotId;
-    /* Hook for current context */
-    /* pendingRequestsMutextHook refer to &s_pendingRequestsMutex */
-    pthread_mutex_t* pendingRequestsMutexHook = NULL;
-    /* pendingRequestsHook refer to &s_pendingRequests */
-    RequestInfo** pendingRequestsHook = NULL;
+static int64_t getNowUs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000ll + ts.tv_nsec / 1000;
+}
 
-    pendingRequestsMutexHook = &(s_pendingRequestsMutex_sockets[toRealSlot(slotId)]);
-    pendingRequestsHook = &(s_pendingRequests_sockets[toRealSlot(slotId)]);
+// Called with the mutex of the slot held
+static RequestInfo* allocRequestInfo(RequestTable* table) {
+    if (table->freeList == NULL) {
+        if (table->slabCount == table->slabCapacity) {
+            int capacity = (table->slabCapacity > 0) ? table->slabCapacity * 2 : 4;
+            RequestInfo** slabs =
+                    (RequestInfo**)realloc(table->slabs, capacity * sizeof(RequestInfo*));
+            if (slabs == NULL) {
+                return NULL;
+            }
+            table->slabs = slabs;
+            table->slabCapacity = capacity;
+        }
 
-    pRI = (RequestInfo*)calloc(1, sizeof(RequestInfo));
-    if (pRI == NULL) {
-        mtkLogE(LOG_TAG, "Memory allocation failed for request %s", requestToString(request));
-        return NULL;
+        RequestInfo* slab = (RequestInfo*)calloc(REQUEST_SLAB_SIZE, sizeof(RequestInfo));
+        if (slab == NULL) {
+            return NULL;
+        }
+
+        for (int i = REQUEST_SLAB_SIZE - 1; i >= 0; i--) {
+            slab[i].tableIndex = table->slabCount * REQUEST_SLAB_SIZE + i;
+            slab[i].p_next = table->freeList;
+            table->freeList = &slab[i];
+        }
+        table->freeTail = &slab[REQUEST_SLAB_SIZE - 1];
+        table->slabs[table->slabCount++] = slab;
+    }
+
+    RequestInfo* pRI = table->freeList;
+    table->freeList = pRI->p_next;
+    if (table->freeList == NULL) {
+        table->freeTail = NULL;
+    }
+
+    // a recycled entry still has the flags and times of its last request
+    int tableIndex = pRI->tableIndex;
+    memset(pRI, 0, sizeof(RequestInfo));
+    pRI->tableIndex = tableIndex;
+    return pRI;
+}
+
+// Whether pRI is an entry of the table, without trusting its content.
+// The token is the entry itself, so a stale token of an entry that has been
+// reused by a later request can not be told apart from the new request.
+static bool isTableEntry(RequestTable* table, RequestInfo* pRI) {
+    int index = pRI->tableIndex;
+
+    if (index < 0 || index >= table->slabCount * REQUEST_SLAB_SIZE) {
+        return false;
+    }
+    return &(table->slabs[index / REQUEST_SLAB_SIZE][index % REQUEST_SLAB_SIZE]) == pRI;
+}
+
+static void freeRequestInfo(RequestInfo* pRI) {
+    int slot = toRealSlot(pRI->socket_id);
+    RequestTable* table = &(s_requestTables[slot]);
+    int tableIndex = pRI->tableIndex;
+
+    pthread_mutex_lock(&(s_pendingRequestsMutex_sockets[slot]));
+#ifdef MEMSET_FREED
+    memset(pRI, 0, sizeof(RequestInfo));
+#endif
+    pRI->tableIndex = tableIndex;
+    pRI->p_next = NULL;
+    if (table->freeTail != NULL) {
+        table->freeTail->p_next = pRI;
+    } else {
+        table->freeList = pRI;
+    }
+    table->freeTail = pRI;
+    pthread_mutex_unlock(&(s_pendingRequestsMutex_sockets[slot]));
+}
+
+static int latencyBucket(int64_t us) {
+    int bucket = 0;
+    int64_t ms = us / 1000;
+
+    while (ms > 0 && bucket < LATENCY_BUCKETS - 1) {
+        ms >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void recordLatency(RequestStats* stats, int phase, int64_t fromUs, int64_t toUs) {
+    if (fromUs == 0 || toUs == 0) {
+        return;
+    }
+
+    int64_t us = toUs - fromUs;
+    stats->buckets[phase][latencyBucket(us)]++;
+    if (us > stats->maxUs[phase]) {
+        stats->maxUs[phase] = us;
+    }
+}
+
+static void recordRequestLatency(RequestInfo* pRI, int64_t completeTimeUs) {
+    int request = pRI->pCI->requestNumber;
+    // open addressing, ids are sparse (vendor and operator bases)
+    uint32_t index = (uint32_t)request % MAX_REQUEST_STATS;
+
+    pthread_mutex_lock(&s_requestStatsMutex);
+    for (int i = 0; i < MAX_REQUEST_STATS; i++) {
+        RequestStats* stats = &(s_requestStats[index]);
+
+        if (stats->request == 0) {
+            stats->request = request;
+        }
+
+        if (stats->request == request) {
+            stats->count++;
+            recordLatency(stats, LATENCY_QUEUE, pRI->enqueueTimeUs, pRI->dispatchTimeUs);
+            recordLatency(stats, LATENCY_ACK, pRI->dispatchTimeUs, pRI->ackTimeUs);
+            recordLatency(stats, LATENCY_COMPLETE, pRI->dispatchTimeUs, completeTimeUs);
+            break;
+        }
+
+        index = (index + 1) % MAX_REQUEST_STATS;
     }
+    pthread_mutex_unlock(&s_requestStatsMutex);
+}
+
+void dumpRequestLatency(int fd) {
+    static const char* phaseNames[LATENCY_PHASES] = {"queue", "ack", "complete"};
+
+    for (int slot = 0; slot < (int)NUM_ELEMS(s_requestTables); slot++) {
+        pthread_mutex_lock(&(s_pendingRequestsMutex_sockets[slot]));
+        int pendingCount = s_requestTables[slot].pendingCount;
+        int tableSize = s_requestTables[slot].slabCount * REQUEST_SLAB_SIZE;
+        pthread_mutex_unlock(&(s_pendingRequestsMutex_sockets[slot]));
+        dprintf(fd, "slot %d: %d pending, table size %d\n", slot, pendingCount, tableSize);
+    }
+
+    pthread_mutex_lock(&s_requestStatsMutex);
+    for (int i = 0; i < MAX_REQUEST_STATS; i++) {
+        RequestStats* stats = &(s_requestStats[i]);
 
-    pRI->token = serial;
+        if (stats->request == 0) {
+            continue;
+        }
+
+        dprintf(fd, "%s(%d) count %u\n", requestToString(stats->request), stats->request,
+                stats->count);
+        for (int phase = 0; phase < LATENCY_PHASES; phase++) {
+            dprintf(fd, "  %-8s max %" PRId64 "us, <2^n ms:", phaseNames[phase],
+                    stats->maxUs[phase]);
+            for (int bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+                dprintf(fd, " %u", stats->buckets[phase][bucket]);
+            }
+            dprintf(fd, "\n");
+        }
+    }
+    pthread_mutex_unlock(&s_requestStatsMutex);
+}
+
+void markRequestDispatched(void* t) {
+    RequestInfo* pRI = (RequestInfo*)t;
+
+    if (pRI != NULL) {
+        pRI->dispatchTimeUs = getNowUs();
+    }
+}
+
+RequestInfo* addRequestToList(int serial, int slotId, int request) {
+    RequestInfo* pRI;
+    CommandInfo* pCI = NULL;
+    int ret;
+    RIL_SOCKET_ID socket_id = (RIL_SOCKET_ID)slotId;
+    int slot = toRealSlot(slotId);
+    RequestTable* table = &(s_requestTables[slot]);
 
     if (request >= RIL_REQUEST_VENDOR_BASE) {
         for (int i = 0; i < (int)NUM_ELEMS(s_mtk_commands); i++) {
             if (request == s_mtk_commands[i].requestNumber) {
-                pRI->pCI = &(s_mtk_commands[i]);
+                pCI = &(s_mtk_commands[i]);
                 break;
             }
         }
     } else {
         for (int i = 0; i < (int)NUM_ELEMS(s_commands); i++) {
             if (request == s_commands[i].requestNumber) {
-                pRI->pCI = &(s_commands[i]);
+                pCI = &(s_commands[i]);
                 break;
             }
         }
     }
 
-    if (pRI->pCI == NULL) {
+    if (pCI == NULL) {
         mtkLogI(LOG_TAG, "try to getOpCommandInfo from operator library");
-        pRI->pCI = RilOpProxy::getOpCommandInfo(request);
+        pCI = RilOpProxy::getOpCommandInfo(request);
     }
 
-    if (pRI->pCI == NULL) {
+    if (pCI == NULL) {
         mtkLogE(LOG_TAG, "Unsupported request id %s", requestToString(request));
-        free(pRI);
         return NULL;
     }
 
-    pRI->socket_id = socket_id;
-    mtkLogD(LOG_TAG, "[RilProxy] addRequestToList: pRI->socket_id = %d", pRI->socket_id);
-
-    ret = pthread_mutex_lock(pendingRequestsMutexHook);
+    ret = pthread_mutex_lock(&(s_pendingRequestsMutex_sockets[slot]));
     assert(ret == 0);
 
-    pRI->p_next = *pendingRequestsHook;
-    *pendingRequestsHook = pRI;
+    pRI = allocRequestInfo(table);
+    if (pRI != NULL) {
+        pRI->token = serial;
+        pRI->pCI = pCI;
+        pRI->socket_id = socket_id;
+        pRI->pending = 1;
+        pRI->enqueueTimeUs = getNowUs();
+        table->pendingCount++;
+    }
 
-    ret = pthread_mutex_unlock(pendingRequestsMutexHook);
+    ret = pthread_mutex_unlock(&(s_pendingRequestsMutex_sockets[slot]));
     assert(ret == 0);
 
+    if (pRI == NULL) {
+        mtkLogE(LOG_TAG, "Memory allocation failed for request %s", requestToString(request));
+        return NULL;
+    }
+
+    mtkLogD(LOG_TAG, "[RilProxy] addRequestToList: pRI->socket_id = %d", pRI->socket_id);
     return pRI;
 }
 
@@ -280,13 +481,14 @@ static void triggerEvLoop() {
     }
 }
 
-static void rilEventAddWakeup(struct ril_event* ev) {
-    ril_event_add(ev);
+static int rilEventAddWakeup(struct ril_event* ev) {
+    int ret = ril_event_add(ev);
     triggerEvLoop();
+    return ret;
 }
 
 /**
- * A write on the wakeup fd is done just to pop us out of select()
+ * A write on the wakeup fd is done just to pop us out of epoll_wait()
  * We empty the buffer here and then ril_event will reset the timers on the
  * way back down
  */
@@ -424,7 +626,12 @@ static void* eventLoop(void* param) {
 
     ril_event_set(&s_wakeupfd_event, s_fdWakeupRead, true, processWakeupCallback, NULL);
 
-    rilEventAddWakeup(&s_wakeupfd_event);
+    if (rilEventAddWakeup(&s_wakeupfd_event) < 0) {
+        // nothing could wake the loop up
+        mtkLogE(LOG_TAG, "Error in watching wakeup fd");
+        kill(0, SIGKILL);
+        return NULL;
+    }
 
     // Only returns on error
     ril_event_loop();
@@ -552,40 +759,38 @@ extern "C" void RIL_register_socket(const RIL_RadioFunctions* (*Init)(const stru
 // Check and remove RequestInfo if its a response and not just ack sent back
 static int checkAndDequeueRequestInfoIfAck(struct RequestInfo* pRI, bool isAck) {
     int ret = 0;
-    /* Hook for current context
-       pendingRequestsMutextHook refer to &s_pendingRequestsMutex */
-    pthread_mutex_t* pendingRequestsMutexHook = NULL;
-    /* pendingRequestsHook refer to &s_pendingRequests */
-    RequestInfo** pendingRequestsHook = NULL;
+    int slot;
+    RequestTable* table;
 
     if (pRI == NULL) {
         return 0;
     }
 
-    pendingRequestsMutexHook = &(s_pendingRequestsMutex_sockets[toRealSlot(pRI->socket_id)]);
-
-    pendingRequestsHook = &(s_pendingRequests_sockets[toRealSlot(pRI->socket_id)]);
+    slot = toRealSlot(pRI->socket_id);
+    if (slot < 0 || slot >= (int)NUM_ELEMS(s_requestTables)) {
+        return 0;
+    }
+    table = &(s_requestTables[slot]);
 
-    pthread_mutex_lock(pendingRequestsMutexHook);
+    pthread_mutex_lock(&(s_pendingRequestsMutex_sockets[slot]));
 
-    for (RequestInfo** ppCur = pendingRequestsHook; *ppCur != NULL; ppCur = &((*ppCur)->p_next)) {
-        if (pRI == *ppCur) {
-            ret = 1;
-            if (isAck) {  // Async ack
-                if (pRI->wasAckSent == 1) {
-                    mtkLogD(LOG_TAG, "Ack was already sent for %s",
-                            requestToString(pRI->pCI->requestNumber));
-                } else {
-                    pRI->wasAckSent = 1;
-                }
+    if (isTableEntry(table, pRI) && pRI->pending) {
+        ret = 1;
+        if (isAck) {  // Async ack
+            if (pRI->wasAckSent == 1) {
+                mtkLogD(LOG_TAG, "Ack was already sent for %s",
+                        requestToString(pRI->pCI->requestNumber));
             } else {
-                *ppCur = (*ppCur)->p_next;
+                pRI->wasAckSent = 1;
+                pRI->ackTimeUs = getNowUs();
             }
-            break;
+        } else {
+            pRI->pending = 0;
+            table->pendingCount--;
         }
     }
 
-    pthread_mutex_unlock(pendingRequestsMutexHook);
+    pthread_mutex_unlock(&(s_pendingRequestsMutex_sockets[slot]));
 
     return ret;
 }
@@ -637,12 +842,14 @@ extern "C" void RIL_onRequestComplete(RIL_Token t, RIL_Errno e, void* response,
     mtkLogD(LOG_TAG, "RequestComplete, %s", rilSocketIdToString(socket_id));
 #endif
 
+    recordRequestLatency(pRI, getNowUs());
+
     if (pRI->local > 0) {
         // Locally issued command...void only!
         // response does not go back up the command socket
         mtkLogD(LOG_TAG, "C[locl]< %s", requestToString(pRI->pCI->requestNumber));
 
-        free(pRI);
+        freeRequestInfo(pRI);
         return;
     }
 
@@ -671,7 +878,7 @@ extern "C" void RIL_onRequestComplete(RIL_Token t, RIL_Errno e, void* response,
         radio::unlockRadioServiceRlock(radioServiceRwlockPtr, (int)socket_id);
         mtkLogV(LOG_TAG, "RIL_onRequestComplete, release lock %d", (int)socket_id);
     }
-    free(pRI);
+    freeRequestInfo(pRI);
 }
 
 extern "C" void resetWakelock(void) {
@@ -22,7 +22,10 @@
 #include <fcntl.h>
 #include <ril_event.h>
 #include <string.h>
+#include <stdint.h>
+#include <sys/epoll.h>
 #include <sys/time.h>
+#include <sys/timerfd.h>
 #include <time.h>
 #include <mtk_log.h>
 #include <mtk_properties.h>
@@ -63,13 +66,23 @@ static pthread_mutex_t listMutex;
     } while (0);
 #endif
 
-static fd_set readFds;
-static int nfds = 0;
+// Watched fds are in an epoll set, timers in a binary min heap on the timeout,
+// and the earliest timer is armed on a timerfd in the same epoll set, so a
+// wakeup only touches the fds that are ready and the timers that expired.
+static int epollFd = -1;
+static int timerFd = -1;
+
+// epoll_event.data of the timerfd, watched fds use their watch_table index
+#define TIMER_FD_TAG MAX_FD_EVENTS
 
 static struct ril_event* watch_table[MAX_FD_EVENTS];
-static struct ril_event timer_list;
 static struct ril_event pending_list;
 
+#define TIMER_HEAP_INIT_SIZE 16
+static struct ril_event** timer_heap;
+static int timer_count = 0;
+static int timer_size = 0;
+
 #define DEBUG 0
 
 #if DEBUG
@@ -132,64 +145,144 @@ static void removeWatch(struct ril_event* ev, int index) {
     watch_table[index] = NULL;
     ev->index = -1;
 
-    FD_CLR(ev->fd, &readFds);
+    // fails harmlessly if the fd is already closed, the kernel dropped it then
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, ev->fd, NULL);
+    dlog("~~~~ -removeWatch ~~~~");
+}
 
-    if (ev->fd + 1 == nfds) {
-        int n = 0;
+static void heapSwap(int a, int b) {
+    struct ril_event* tmp = timer_heap[a];
+    timer_heap[a] = timer_heap[b];
+    timer_heap[b] = tmp;
+}
 
-        for (int i = 0; i < MAX_FD_EVENTS; i++) {
-            struct ril_event* rev = watch_table[i];
+static void heapPush(struct ril_event* ev) {
+    int i = timer_count++;
+    timer_heap[i] = ev;
 
-            if ((rev != NULL) && (rev->fd > n)) {
-                n = rev->fd;
-            }
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!timercmp(&timer_heap[i]->timeout, &timer_heap[parent]->timeout, <)) {
+            break;
         }
-        nfds = n + 1;
-        dlog("~~~~ nfds = %d ~~~~", nfds);
+        heapSwap(i, parent);
+        i = parent;
+    }
+}
+
+static struct ril_event* heapPop() {
+    struct ril_event* top = timer_heap[0];
+    int i = 0;
+
+    timer_heap[0] = timer_heap[--timer_count];
+
+    for (;;) {
+        int smallest = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+
+        if (left < timer_count &&
+            timercmp(&timer_heap[left]->timeout, &timer_heap[smallest]->timeout, <)) {
+            smallest = left;
+        }
+        if (right < timer_count &&
+            timercmp(&timer_heap[right]->timeout, &timer_heap[smallest]->timeout, <)) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            break;
+        }
+        heapSwap(i, smallest);
+        i = smallest;
+    }
+
+    return top;
+}
+
+// Arm the timerfd to the earliest timer, or disarm it if there is none.
+// Called with the mutex held.
+static void armTimerFd() {
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+
+    if (timer_count > 0) {
+        its.it_value.tv_sec = timer_heap[0]->timeout.tv_sec;
+        its.it_value.tv_nsec = timer_heap[0]->timeout.tv_usec * 1000;
+        // all zero would disarm, an expired timer still has to fire
+        if (its.it_value.tv_sec == 0 && its.it_value.tv_nsec == 0) {
+            its.it_value.tv_nsec = 1;
+        }
+    }
+
+    if (timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &its, NULL) < 0) {
+        mtkLogE(LOG_TAG, "ril_event: timerfd_settime error (%d)", errno);
     }
-    dlog("~~~~ -removeWatch ~~~~");
 }
 
-static void processTimeouts() {
+static void processTimeouts(bool timerFired) {
     dlog("~~~~ +processTimeouts ~~~~");
-    MUTEX_ACQUIRE();
     struct timeval now;
-    struct ril_event* tev = timer_list.next;
-    struct ril_event* next;
+    bool expired = false;
 
-    getNow(&now);
-    // walk list, see if now >= ev->timeout for any events
+    if (timerFired) {
+        uint64_t expirations;
+        // drain the timerfd, it is re-armed below
+        while (read(timerFd, &expirations, sizeof(expirations)) < 0 && errno == EINTR) {
+        }
+    }
 
+    getNow(&now);
     dlog("~~~~ Looking for timers <= %ds + %dus ~~~~", (int)now.tv_sec, (int)now.tv_usec);
-    while ((tev != &timer_list) && (timercmp(&now, &tev->timeout, >))) {
-        // Timer expired
+    // heap order, so the timers fire by timeout as the sorted list did
+    while (timer_count > 0 && !timercmp(&timer_heap[0]->timeout, &now, >)) {
         dlog("~~~~ firing timer ~~~~");
-        next = tev->next;
-        removeFromList(tev);
-        addToList(tev, &pending_list);
-        tev = next;
+        addToList(heapPop(), &pending_list);
+        expired = true;
+    }
+
+    if (timerFired || expired) {
+        armTimerFd();
     }
-    MUTEX_RELEASE();
     dlog("~~~~ -processTimeouts ~~~~");
 }
 
-static void processReadReadies(fd_set* rfds, int n) {
+// Returns -1 if a watched fd reports an error or hang up, select() saw such an fd as EBADF
+static int processReadReadies(struct epoll_event* events, int n) {
     dlog("~~~~ +processReadReadies (%d) ~~~~", n);
-    MUTEX_ACQUIRE();
 
-    for (int i = 0; (i < MAX_FD_EVENTS) && (n > 0); i++) {
-        struct ril_event* rev = watch_table[i];
-        if (rev != NULL && FD_ISSET(rev->fd, rfds)) {
-            addToList(rev, &pending_list);
-            if (rev->persist == false) {
-                removeWatch(rev, i);
-            }
-            n--;
+    for (int i = 0; i < n; i++) {
+        int index = (int)(events[i].data.u64 & 0xffffffff);
+        int fd = (int)(events[i].data.u64 >> 32);
+
+        if (index == TIMER_FD_TAG) {
+            continue;
+        }
+
+        // the event may be deleted, or the slot reused, since epoll_wait returned
+        struct ril_event* rev = watch_table[index];
+        if (rev == NULL || rev->fd != fd) {
+            continue;
+        }
+
+        if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+            mtkLogE(LOG_TAG, "ril_event: fd %d is damaged (0x%x)", fd, events[i].events);
+            return -1;
+        }
+
+        addToList(rev, &pending_list);
+        if (rev->persist == false) {
+            removeWatch(rev, index);
         }
     }
 
-    MUTEX_RELEASE();
-    dlog("~~~~ -processReadReadies (%d) ~~~~", n);
+    dlog("~~~~ -processReadReadies ~~~~");
+    return 0;
+}
+
+static void reportDamagedFd() {
+    // ALPS01509775: fd is damaged, use TRM to re-setup
+    mtk_property_set("vendor.ril.mux.report.case", "2");
+    mtk_property_set("vendor.ril.muxreport", "1");
 }
 
 static void firePending() {
@@ -204,37 +297,36 @@ static void firePending() {
     dlog("~~~~ -firePending ~~~~");
 }
 
-static int calcNextTimeout(struct timeval* tv) {
-    struct ril_event* tev = timer_list.next;
-    struct timeval now;
-
-    getNow(&now);
-
-    // Sorted list, so calc based on first node
-    if (tev == &timer_list) {
-        // no pending timers
-        return -1;
-    }
-
-    dlog("~~~~ now = %ds + %dus ~~~~", (int)now.tv_sec, (int)now.tv_usec);
-    dlog("~~~~ next = %ds + %dus ~~~~", (int)tev->timeout.tv_sec, (int)tev->timeout.tv_usec);
-    if (timercmp(&tev->timeout, &now, >)) {
-        timersub(&tev->timeout, &now, tv);
-    } else {
-        // timer already expired.
-        tv->tv_sec = tv->tv_usec = 0;
-    }
-    return 0;
-}
-
 // Initialize internal data structs
 void ril_event_init() {
     MUTEX_INIT();
 
-    FD_ZERO(&readFds);
-    init_list(&timer_list);
     init_list(&pending_list);
     memset(watch_table, 0, sizeof(watch_table));
+
+    timer_heap = (struct ril_event**)malloc(TIMER_HEAP_INIT_SIZE * sizeof(struct ril_event*));
+    timer_size = (timer_heap != NULL) ? TIMER_HEAP_INIT_SIZE : 0;
+    timer_count = 0;
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+        mtkLogE(LOG_TAG, "ril_event: epoll_create1 error (%d)", errno);
+        return;
+    }
+
+    timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timerFd < 0) {
+        mtkLogE(LOG_TAG, "ril_event: timerfd_create error (%d)", errno);
+        return;
+    }
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.u64 = TIMER_FD_TAG;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, timerFd, &event) < 0) {
+        mtkLogE(LOG_TAG, "ril_event: add timerfd error (%d)", errno);
+    }
 }
 
 // Initialize an event
@@ -250,23 +342,40 @@ void ril_event_set(struct ril_event* ev, int fd, bool persist, ril_event_cb func
 }
 
 // Add event to watch list
-void ril_event_add(struct ril_event* ev) {
+int ril_event_add(struct ril_event* ev) {
+    int ret = -1;
+
     dlog("~~~~ +ril_event_add ~~~~");
     MUTEX_ACQUIRE();
     for (int i = 0; i < MAX_FD_EVENTS; i++) {
         if (watch_table[i] == NULL) {
+            struct epoll_event event;
+            memset(&event, 0, sizeof(event));
+            // persistent events are edge triggered, their callbacks read until EAGAIN;
+            // one shot events are removed when they fire
+            event.events = ev->persist ? (EPOLLIN | EPOLLET) : EPOLLIN;
+            event.data.u64 = ((uint64_t)(uint32_t)ev->fd << 32) | (uint32_t)i;
+
+            if (epoll_ctl(epollFd, EPOLL_CTL_ADD, ev->fd, &event) < 0) {
+                mtkLogE(LOG_TAG, "ril_event: add fd %d error (%d)", ev->fd, errno);
+                break;
+            }
+
             watch_table[i] = ev;
             ev->index = i;
+            ret = 0;
             dlog("~~~~ added at %d ~~~~", i);
             dump_event(ev);
-            FD_SET(ev->fd, &readFds);
-            if (ev->fd >= nfds) nfds = ev->fd + 1;
-            dlog("~~~~ nfds = %d ~~~~", nfds);
             break;
         }
     }
     MUTEX_RELEASE();
+
+    if (ret < 0) {
+        mtkLogE(LOG_TAG, "ril_event: fd %d is not watched", ev->fd);
+    }
     dlog("~~~~ -ril_event_add ~~~~");
+    return ret;
 }
 
 // Add timer event
@@ -274,29 +383,38 @@ void ril_timer_add(struct ril_event* ev, struct timeval* tv) {
     dlog("~~~~ +ril_timer_add ~~~~");
     MUTEX_ACQUIRE();
 
-    struct ril_event* list;
     if (tv != NULL) {
-        // add to timer list
-        list = timer_list.next;
+        if (timer_count == timer_size) {
+            int size = (timer_size > 0) ? timer_size * 2 : TIMER_HEAP_INIT_SIZE;
+            struct ril_event** heap =
+                    (struct ril_event**)realloc(timer_heap, size * sizeof(struct ril_event*));
+            if (heap == NULL) {
+                mtkLogE(LOG_TAG, "ril_event: no memory for %d timers", size);
+                MUTEX_RELEASE();
+                return;
+            }
+            timer_heap = heap;
+            timer_size = size;
+        }
+
         ev->fd = -1;  // make sure fd is invalid
 
         struct timeval now;
         getNow(&now);
         timeradd(&now, tv, &ev->timeout);
 
-        // keep list sorted
-        while (timercmp(&list->timeout, &ev->timeout, <) && (list != &timer_list)) {
-            list = list->next;
+        heapPush(ev);
+        // the timerfd wakes the loop up, even when added from another thread
+        if (timer_heap[0] == ev) {
+            armTimerFd();
         }
-        // list now points to the first event older than ev
-        addToList(ev, list);
     }
 
     MUTEX_RELEASE();
     dlog("~~~~ -ril_timer_add ~~~~");
 }
 
-// Remove event from watch or timer list
+// Remove event from watch list
 void ril_event_del(struct ril_event* ev) {
     dlog("~~~~ +ril_event_del ~~~~");
     MUTEX_ACQUIRE();
@@ -312,104 +430,41 @@ void ril_event_del(struct ril_event* ev) {
     dlog("~~~~ -ril_event_del ~~~~");
 }
 
-#if DEBUG
-static void printReadies(fd_set* rfds) {
-    for (int i = 0; (i < MAX_FD_EVENTS); i++) {
-        struct ril_event* rev = watch_table[i];
-        if (rev != NULL && FD_ISSET(rev->fd, rfds)) {
-            dlog("DON: fd=%d is ready", rev->fd);
-        }
-    }
-}
-#else
-#define printReadies(rfds) \
-    do {                   \
-    } while (0)
-#endif
-
 void ril_event_loop() {
     int n;
-    fd_set rfds;
-    struct timeval tv;
-    struct timeval* ptv;
+    struct epoll_event events[MAX_FD_EVENTS + 1];
 
     for (;;) {
-        // make local copy of read fd_set
-        memcpy(&rfds, &readFds, sizeof(fd_set));
-        if (-1 == calcNextTimeout(&tv)) {
-            // no pending timers; block indefinitely
-            dlog("~~~~ no timers; blocking indefinitely ~~~~");
-            ptv = NULL;
-        } else {
-            dlog("~~~~ blocking for %ds + %dus ~~~~", (int)tv.tv_sec, (int)tv.tv_usec);
-            ptv = &tv;
-        }
-        printReadies(&rfds);
-        n = select(nfds, &rfds, NULL, NULL, ptv);
-        printReadies(&rfds);
+        n = epoll_wait(epollFd, events, MAX_FD_EVENTS + 1, -1);
         dlog("~~~~ %d events fired ~~~~", n);
         if (n < 0) {
             if (errno == EINTR) continue;
 
-            mtkLogE(LOG_TAG, "ril_event: select error (%d)", errno);
-            // bail?
-
-            int selectFd = -1;
-            for (int i = 0; (i < MAX_FD_EVENTS); i++) {
-                struct ril_event* rev = watch_table[i];
-                if (rev != NULL && FD_ISSET(rev->fd, &rfds)) {
-                    FD_CLR(rev->fd, &rfds);
-                    selectFd = rev->fd;
-                    n = select(nfds, &rfds, NULL, NULL, ptv);
-                    if (n >= 0) {
-                        mtkLogE(LOG_TAG, "ril_event: after remove fd: %d, select success",
-                                selectFd);
-                        break;
-                    }
-                }
-            }
-            mtkLogE(LOG_TAG, "ril_event: after remove fd:%d, select success2", selectFd);
-
-            int errcode_tmp = errno;
-            if (errcode_tmp == 9) {
-                struct timeval tv;
-                int rc;
-                int fd_max = 0;
-                int i = 0;
-                fd_set fds_tmp;
-                int errcode_test = 0;
-
-                fd_max = nfds;
-
-                for (i = 0; i < fd_max; i++) {
-                    if (FD_ISSET(i, &readFds)) {
-                        FD_ZERO(&fds_tmp);
-                        FD_SET(i, &fds_tmp);
-
-                        tv.tv_sec = tv.tv_usec = 0;
-                        rc = select(i + 1, &fds_tmp, NULL, NULL, &tv);
-
-                        if (rc < 0) {
-                            errcode_test = errno;
-                            if (errcode_test == 9) {
-                                mtkLogE(LOG_TAG, "ril_event: test error fd= (%d)", i);
-                            } else {
-                                mtkLogE(LOG_TAG, "ril_event: test error (%d)", errcode_test);
-                            }
-                        }
-                    }
-                }
-                // ALPS01509775: fd is damaged, use TRM to re-setup
-                mtk_property_set("vendor.ril.mux.report.case", "2");
-                mtk_property_set("vendor.ril.muxreport", "1");
+            mtkLogE(LOG_TAG, "ril_event: epoll_wait error (%d)", errno);
+
+            if (errno == EBADF) {
+                reportDamagedFd();
             }
             return;
         }
 
-        // Check for timeouts
-        processTimeouts();
-        // Check for read-ready
-        processReadReadies(&rfds, n);
+        bool timerFired = false;
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.u64 == TIMER_FD_TAG) {
+                timerFired = true;
+                break;
+            }
+        }
+
+        // one lock for timers and fds
+        MUTEX_ACQUIRE();
+        processTimeouts(timerFired);
+        if (processReadReadies(events, n) < 0) {
+            MUTEX_RELEASE();
+            reportDamagedFd();
+            return;
+        }
+        MUTEX_RELEASE();
         // Fire away
         firePending();
     }
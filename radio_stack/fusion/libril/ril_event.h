@@ -38,12 +38,14 @@ void ril_event_init();
 void ril_event_set(struct ril_event* ev, int fd, bool persist, ril_event_cb func, void* param);
 
 // Add event to watch list
-void ril_event_add(struct ril_event* ev);
+// A persistent event is edge triggered, its callback must read until EAGAIN
+// Returns 0 on success, -1 if the watch list is full or the fd can not be watched
+int ril_event_add(struct ril_event* ev);
 
 // Add timer event
 void ril_timer_add(struct ril_event* ev, struct timeval* tv);
 
-// Remove event from watch list
+// Remove event from watch list, timers can not be removed
 void ril_event_del(struct ril_event* ev);
 
 // Event loop
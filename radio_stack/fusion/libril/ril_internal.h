@@ -170,11 +170,17 @@ extern "C" const char* requestToString(int request);
 typedef struct RequestInfo {
     int32_t token;  // this is not RIL_Token
     CommandInfo* pCI;
-    struct RequestInfo* p_next;
+    struct RequestInfo* p_next;  // free list of the request table
     char cancelled;
     char local;  // responses to local commands do not go back to command process
     RIL_SOCKET_ID socket_id;
     int wasAckSent;  // Indicates whether an ack was sent earlier
+    int tableIndex;  // position in the request table of the slot, kept when freed
+    char pending;    // between addRequestToList and the response
+    // CLOCK_MONOTONIC us, 0 if not reached yet
+    int64_t enqueueTimeUs;
+    int64_t dispatchTimeUs;
+    int64_t ackTimeUs;
 } RequestInfo;
 
 typedef struct CommandInfo {
@@ -194,6 +200,12 @@ typedef struct {
 
 RequestInfo* addRequestToList(int serial, int slotId, int request);
 
+// Stamp the time the request is passed to the vendor RIL
+void markRequestDispatched(void* t);
+
+// Write the latency histograms of each request id to fd
+void dumpRequestLatency(int fd);
+
 char* RIL_getServiceName();
 
 void releaseWakeLock();
@@ -79,6 +79,7 @@ using ::android::Vector;
 using ::android::hardware::configureRpcThreadpool;
 using ::android::hardware::hidl_array;
 using ::android::hardware::hidl_bitfield;
+using ::android::hardware::hidl_handle;
 using ::android::hardware::hidl_string;
 using ::android::hardware::hidl_vec;
 using ::android::hardware::joinRpcThreadpool;
@@ -91,11 +92,13 @@ using ::android::hardware::radio::V1_2::AudioQuality;
 #define ATOI_NULL_HANDLED_DEF(x, defaultVal) (x ? atoi(x) : defaultVal)
 
 #if defined(ANDROID_MULTI_SIM)
-#define CALL_ONREQUEST(a, b, c, d, e) \
-    s_vendorFunctions->onRequest((a), (b), (c), (d), ((RIL_SOCKET_ID)(e)))
+#define CALL_ONREQUEST(a, b, c, d, e)                                        \
+    (android::markRequestDispatched(d),                                      \
+     s_vendorFunctions->onRequest((a), (b), (c), (d), ((RIL_SOCKET_ID)(e))))
 #define CALL_ONSTATEREQUEST(a) s_vendorFunctions->onStateRequest((RIL_SOCKET_ID)(a))
 #else
-#define CALL_ONREQUEST(a, b, c, d, e) s_vendorFunctions->onRequest((a), (b), (c), (d))
+#define CALL_ONREQUEST(a, b, c, d, e) \
+    (android::markRequestDispatched(d), s_vendorFunctions->onRequest((a), (b), (c), (d)))
 #define CALL_ONSTATEREQUEST(a) s_vendorFunctions->onStateRequest()
 #endif
 
@@ -520,6 +523,9 @@ struct RadioImpl : public AOSP_V1_4::IRadio {
 
     Return<void> responseAcknowledgement();
 
+    // lshal debug, dumps the request latency of libril
+    Return<void> debug(const hidl_handle& fd, const hidl_vec<hidl_string>& options);
+
     Return<void> setCarrierInfoForImsiEncryption(int32_t serial,
                                                  const AOSP_V1_1::ImsiEncryptionInfo& message);
 
@@ -1373,6 +1379,7 @@ bool dispatchCallForwardInTimeSlotStatus(int serial, int slotId, int request,
         return false;
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, &cfEx, sizeof(cfEx), pRI, pRI->socket_id);
 
     memsetAndFreeStrings(3, cfEx.number, cfEx.timeSlotBegin, cfEx.timeSlotEnd);
@@ -3029,6 +3036,7 @@ bool dispatchSimGeneralAuth(int serial, int slotId, int request, const SimAuthSt
 
     rilSimAuth.tag = simAuth.tag;
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, &rilSimAuth, sizeof(rilSimAuth), pRI, pRI->socket_id);
 
     memsetAndFreeStrings(1, rilSimAuth.param1);
@@ -3057,6 +3065,7 @@ bool dispatchPhbEntry(int serial, int slotId, int request, const PhbEntryStructu
         return false;
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, &pbe, sizeof(pbe), pRI, pRI->socket_id);
 
     memsetAndFreeStrings(1, pbe.number);
@@ -3085,6 +3094,7 @@ bool dispatchGrpEntry(int serial, int slotId, int request, int adnIndex,
         pInts[i] = grpId[i - 1];
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, pInts, countInts * sizeof(int), pRI, pRI->socket_id);
 
     if (pInts != NULL) {
@@ -3147,6 +3157,7 @@ bool dispatchPhbEntryExt(int serial, int slotId, int request, const PhbEntryExt&
         return false;
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, &pbe, sizeof(pbe), pRI, pRI->socket_id);
 
     memsetAndFreeStrings(1, pbe.number);
@@ -3185,6 +3196,7 @@ bool dispatchFdMode(int serial, int slotId, int request, int mode, int param1, i
         args.parameter1 = param1;
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, &args, sizeof(RIL_FdModeStructure), pRI, pRI->socket_id);
 
     return true;
@@ -4749,6 +4761,7 @@ Return<void> RadioImpl::emergencyDial(int32_t serial, const AOSP_V1_0::Dial& dia
     }
     */
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(requestId, &emergencyDial, sizeOfEmergencyDial, pRI,
                                  pRI->socket_id);
 
@@ -5168,6 +5181,13 @@ Return<void> RadioImpl::responseAcknowledgement() {
     return Void();
 }
 
+Return<void> RadioImpl::debug(const hidl_handle& fd, const hidl_vec<hidl_string>& /*options*/) {
+    if (fd.getNativeHandle() != NULL && fd->numFds > 0) {
+        android::dumpRequestLatency(fd->data[0]);
+    }
+    return Void();
+}
+
 Return<void> MtkRadioExImpl::responseAcknowledgementMtk() {
     android::releaseWakeLock();
     return Void();
@@ -5406,6 +5426,7 @@ bool dispatchSearchStoredFreqInfo(int serial, int slotId, int request, int32_t o
         pInts[i] = freq[i - 1];
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, pInts, countInts * sizeof(int), pRI, pRI->socket_id);
 
     if (pInts != NULL) {
@@ -5445,6 +5466,7 @@ bool dispatchSearchRat(int serial, int slotId, int request, const hidl_vec<int32
         pInts[i] = rat[i - 1];
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, pInts, countInts * sizeof(int), pRI, pRI->socket_id);
 
     if (pInts != NULL) {
@@ -5851,6 +5873,7 @@ Return<void> MtkRadioExImpl::conferenceDial(int32_t serial, const ConferenceDial
         return Void();
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, pStrings, countStrings * sizeof(char*), pRI,
                                  pRI->socket_id);
 
@@ -5900,6 +5923,7 @@ Return<void> MtkRadioExImpl::vtDial(int32_t serial, const Dial& dialInfo) {
         }
         dial.uusInfo = &uusInfo;
     }
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(requestId, &dial, sizeOfDial, pRI, pRI->socket_id);
     memsetAndFreeStrings(2, dial.address, uusInfo.uusData);
     return Void();
@@ -18409,6 +18433,7 @@ bool dispatchSmsParametrs(int serial, int slotId, int request, const SmsParams&
     params.pid = message.pid;
     params.vp = message.vp;
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, &params, sizeof(params), pRI, pRI->socket_id);
 
     return true;
@@ -19691,6 +19716,7 @@ bool dispatchVsimEvent(int serial, int slotId, int request, uint32_t transaction
     args.eventId = eventId;
     args.sim_type = simType;
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, &args, sizeof(args), pRI, pRI->socket_id);
 
     return true;
@@ -19730,6 +19756,7 @@ bool dispatchVsimOperationEvent(int serial, int slotId, int request, uint32_t tr
 
     // mtkLogD(LOG_TAG, "dispatchVsimOperationEvent: id=%d, data=%s", args.eventId, args.data);
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(request, &args, sizeof(args), pRI, pRI->socket_id);
 
     free(args.data);
@@ -22560,6 +22587,7 @@ Return<void> MtkRadioExImpl::sendRsuRequest(int serial, const RsuRequestInfo& rr
         return Void();
     }
 
+    android::markRequestDispatched(pRI);
     s_vendorFunctions->onRequest(RIL_REQUEST_SML_RSU_REQUEST, &r_rri, sizeof(r_rri), pRI,
                                  pRI->socket_id);
 
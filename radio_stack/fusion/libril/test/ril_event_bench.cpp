@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The timer heap is static, the benchmark builds its own copy of ril_event.cpp with the
+// public functions renamed so they do not clash with the ones ril_event_test.cpp runs
+#define ril_event_init bench_ril_event_init
+#define ril_event_set bench_ril_event_set
+#define ril_event_add bench_ril_event_add
+#define ril_timer_add bench_ril_timer_add
+#define ril_event_del bench_ril_event_del
+#define ril_event_loop bench_ril_event_loop
+#include "../ril_event.cpp"
+#undef ril_event_init
+#undef ril_event_set
+#undef ril_event_add
+#undef ril_timer_add
+#undef ril_event_del
+#undef ril_event_loop
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <vector>
+
+namespace {
+
+int64_t nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+// the sorted timer_list walk ril_timer_add used before the heap
+void listInsert(struct ril_event* timerList, struct ril_event* ev) {
+    struct ril_event* list = timerList->next;
+    while (timercmp(&list->timeout, &ev->timeout, <) && (list != timerList)) {
+        list = list->next;
+    }
+    addToList(ev, list);
+}
+
+// the head of the sorted list, as processTimeouts took expired timers
+struct ril_event* listPop(struct ril_event* timerList) {
+    struct ril_event* tev = timerList->next;
+    removeFromList(tev);
+    return tev;
+}
+
+// distinct timeouts in a random order, as the RIL timers of several requests
+std::vector<struct ril_event> makeTimers(int count) {
+    std::vector<struct ril_event> timers(count);
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    for (int i = count - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+    for (int i = 0; i < count; i++) {
+        memset(&timers[i], 0, sizeof(struct ril_event));
+        timers[i].fd = -1;
+        timers[i].timeout.tv_sec = order[i] / 1000;
+        timers[i].timeout.tv_usec = (order[i] % 1000) * 1000;
+        timers[i].param = (void*)(intptr_t)order[i];
+    }
+    return timers;
+}
+
+// inserts all the timers then expires them all, both designs must expire them in the same order
+TEST(RilEventBenchmark, TimerHeapVsSortedList) {
+    const int counts[] = {8, 64, 512, 4096};
+    srand(1);
+
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        int count = counts[c];
+        int rounds = 200000 / count + 1;
+        std::vector<struct ril_event> timers = makeTimers(count);
+        std::vector<intptr_t> listOrder;
+        std::vector<intptr_t> heapOrder;
+        int64_t listInsertNs = 0;
+        int64_t listExpireNs = 0;
+        int64_t heapInsertNs = 0;
+        int64_t heapExpireNs = 0;
+
+        struct ril_event timerList;
+        for (int round = 0; round < rounds; round++) {
+            init_list(&timerList);
+            int64_t start = nowNs();
+            for (int i = 0; i < count; i++) {
+                listInsert(&timerList, &timers[i]);
+            }
+            int64_t inserted = nowNs();
+            for (int i = 0; i < count; i++) {
+                struct ril_event* ev = listPop(&timerList);
+                if (round == 0) {
+                    listOrder.push_back((intptr_t)ev->param);
+                }
+            }
+            listExpireNs += nowNs() - inserted;
+            listInsertNs += inserted - start;
+        }
+
+        timer_heap = (struct ril_event**)malloc(count * sizeof(struct ril_event*));
+        ASSERT_TRUE(timer_heap != NULL);
+        timer_size = count;
+        for (int round = 0; round < rounds; round++) {
+            timer_count = 0;
+            int64_t start = nowNs();
+            for (int i = 0; i < count; i++) {
+                heapPush(&timers[i]);
+            }
+            int64_t inserted = nowNs();
+            for (int i = 0; i < count; i++) {
+                struct ril_event* ev = heapPop();
+                if (round == 0) {
+                    heapOrder.push_back((intptr_t)ev->param);
+                }
+            }
+            heapExpireNs += nowNs() - inserted;
+            heapInsertNs += inserted - start;
+        }
+        free(timer_heap);
+        timer_heap = NULL;
+        timer_size = 0;
+
+        EXPECT_EQ(listOrder, heapOrder) << count << " timers";
+        double ops = (double)count * rounds;
+        printf("%d timers: sorted list insert %.1f ns, expire %.1f ns; heap insert %.1f ns, "
+               "expire %.1f ns\n",
+               count, listInsertNs / ops, listExpireNs / ops, heapInsertNs / ops,
+               heapExpireNs / ops);
+    }
+}
+
+}  // namespace
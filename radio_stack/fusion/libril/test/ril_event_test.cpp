@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <vector>
+
+#include <ril_event.h>
+
+namespace {
+
+pthread_mutex_t sMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t sCond = PTHREAD_COND_INITIALIZER;
+std::vector<intptr_t> sFired;
+
+void recordCallback(int fd, short /*events*/, void* param) {
+    if (fd >= 0) {
+        char buf[16];
+        while (read(fd, buf, sizeof(buf)) > 0) {
+        }
+    }
+
+    pthread_mutex_lock(&sMutex);
+    sFired.push_back((intptr_t)param);
+    pthread_cond_broadcast(&sCond);
+    pthread_mutex_unlock(&sMutex);
+}
+
+// wait until count callbacks fired or timeoutMs passed, return the fired params
+std::vector<intptr_t> waitFired(size_t count, int timeoutMs = 2000) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeoutMs / 1000;
+    deadline.tv_nsec += (timeoutMs % 1000) * 1000000l;
+    if (deadline.tv_nsec >= 1000000000l) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000l;
+    }
+
+    pthread_mutex_lock(&sMutex);
+    while (sFired.size() < count) {
+        if (pthread_cond_timedwait(&sCond, &sMutex, &deadline) != 0) {
+            break;
+        }
+    }
+    std::vector<intptr_t> fired = sFired;
+    sFired.clear();
+    pthread_mutex_unlock(&sMutex);
+    return fired;
+}
+
+void* eventLoop(void*) {
+    ril_event_loop();
+    return NULL;
+}
+
+class RilEventTest : public ::testing::Test {
+  protected:
+    // one event loop for the process, as libril has
+    static void SetUpTestSuite() {
+        pthread_t tid;
+        ril_event_init();
+        pthread_create(&tid, NULL, eventLoop, NULL);
+        pthread_detach(tid);
+    }
+
+    void SetUp() override { waitFired(0, 0); }
+};
+
+TEST_F(RilEventTest, TimersFireInTimeoutOrder) {
+    // more timers than the initial heap size, added out of order
+    const int count = 40;
+    struct ril_event events[count];
+
+    for (int i = 0; i < count; i++) {
+        int order = (i * 17) % count;
+        struct timeval tv = {0, 50000 + order * 2000};
+        ril_event_set(&events[i], -1, false, recordCallback, (void*)(intptr_t)order);
+        ril_timer_add(&events[i], &tv);
+    }
+
+    std::vector<intptr_t> fired = waitFired(count);
+    ASSERT_EQ((size_t)count, fired.size());
+    for (int i = 0; i < count; i++) {
+        EXPECT_EQ(i, fired[i]);
+    }
+}
+
+TEST_F(RilEventTest, EarlierTimerRearmsLoop) {
+    struct ril_event late;
+    struct ril_event early;
+    struct timeval lateTv = {1, 0};
+    struct timeval earlyTv = {0, 10000};
+
+    ril_event_set(&late, -1, false, recordCallback, (void*)1);
+    ril_timer_add(&late, &lateTv);
+    ril_event_set(&early, -1, false, recordCallback, (void*)2);
+    ril_timer_add(&early, &earlyTv);
+
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+    std::vector<intptr_t> fired = waitFired(1);
+    gettimeofday(&end, NULL);
+
+    ASSERT_EQ(1u, fired.size());
+    EXPECT_EQ(2, fired[0]);
+    EXPECT_LT((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_usec - start.tv_usec), 500000);
+
+    fired = waitFired(1);
+    ASSERT_EQ(1u, fired.size());
+    EXPECT_EQ(1, fired[0]);
+}
+
+TEST_F(RilEventTest, OneShotFdFiresOnce) {
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+
+    struct ril_event ev;
+    ril_event_set(&ev, fds[0], false, recordCallback, (void*)3);
+    ASSERT_EQ(0, ril_event_add(&ev));
+
+    ASSERT_EQ(1, write(fds[1], "x", 1));
+    std::vector<intptr_t> fired = waitFired(1);
+    ASSERT_EQ(1u, fired.size());
+    EXPECT_EQ(3, fired[0]);
+
+    // removed from the watch list when it fired
+    ASSERT_EQ(1, write(fds[1], "x", 1));
+    EXPECT_TRUE(waitFired(1, 100).empty());
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_F(RilEventTest, PersistentFdFiresUntilDeleted) {
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+
+    struct ril_event ev;
+    ril_event_set(&ev, fds[0], true, recordCallback, (void*)4);
+    ASSERT_EQ(0, ril_event_add(&ev));
+
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(1, write(fds[1], "x", 1));
+        ASSERT_EQ(1u, waitFired(1).size());
+    }
+
+    ril_event_del(&ev);
+    ASSERT_EQ(1, write(fds[1], "x", 1));
+    EXPECT_TRUE(waitFired(1, 100).empty());
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_F(RilEventTest, AddFailsWhenWatchListIsFull) {
+    struct ril_event events[MAX_FD_EVENTS + 1];
+    int fds[MAX_FD_EVENTS + 1][2];
+    int added = 0;
+
+    for (int i = 0; i <= MAX_FD_EVENTS; i++) {
+        ASSERT_EQ(0, pipe(fds[i]));
+        ril_event_set(&events[i], fds[i][0], true, recordCallback, (void*)5);
+        if (ril_event_add(&events[i]) == 0) {
+            added++;
+        }
+    }
+
+    EXPECT_EQ(MAX_FD_EVENTS, added);
+
+    for (int i = 0; i <= MAX_FD_EVENTS; i++) {
+        ril_event_del(&events[i]);
+        close(fds[i][0]);
+        close(fds[i][1]);
+    }
+}
+
+}  // namespace
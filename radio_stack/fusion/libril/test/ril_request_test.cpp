@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <telephony/mtk_ril.h>
+#include <ril_internal.h>
+
+extern "C" void RIL_onRequestComplete(RIL_Token t, RIL_Errno e, void* response, size_t responselen);
+
+extern "C" void RIL_onRequestAck(RIL_Token t);
+
+namespace {
+
+using android::RequestInfo;
+
+// the request table keeps one free list per slot, a freed entry goes to its tail
+const int kSlot = 0;
+
+TEST(RilRequestTest, RecycledEntryStartsClean) {
+    RequestInfo* local = android::addRequestToList(1, kSlot, RIL_REQUEST_GET_SIM_STATUS);
+    ASSERT_TRUE(local != NULL);
+    // as rilConnectedInd issues RIL_REQUEST_HANGUP_ALL, the cancelled ack does not
+    // reach the radio service
+    local->local = 1;
+    local->cancelled = 1;
+    android::markRequestDispatched(local);
+    RIL_onRequestAck(local);
+    ASSERT_EQ(1, local->wasAckSent);
+    RIL_onRequestComplete(local, RIL_E_SUCCESS, NULL, 0);
+
+    // the freed entry comes back after the rest of the free list
+    std::vector<RequestInfo*> requests;
+    RequestInfo* next = NULL;
+    for (int serial = 2; serial < 10000 && next != local; serial++) {
+        next = android::addRequestToList(serial, kSlot, RIL_REQUEST_GET_SIM_STATUS);
+        ASSERT_TRUE(next != NULL);
+        requests.push_back(next);
+    }
+    ASSERT_EQ(local, next);
+
+    EXPECT_EQ(RIL_REQUEST_GET_SIM_STATUS, next->pCI->requestNumber);
+    EXPECT_EQ(1, next->pending);
+    EXPECT_EQ(0, next->local);
+    EXPECT_EQ(0, next->cancelled);
+    EXPECT_EQ(0, next->wasAckSent);
+    EXPECT_EQ(0, next->dispatchTimeUs);
+    EXPECT_EQ(0, next->ackTimeUs);
+    EXPECT_TRUE(next->p_next == NULL);
+
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i]->local = 1;
+        RIL_onRequestComplete(requests[i], RIL_E_SUCCESS, NULL, 0);
+    }
+}
+
+}  // namespace
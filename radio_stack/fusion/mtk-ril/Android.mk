@@ -486,4 +486,54 @@ else
   include $(BUILD_EXECUTABLE)
 endif
 
+# framework unit tests, run with: atest libmtk-ril_framework_test
+include $(CLEAR_VARS)
+
+LOCAL_VENDOR_MODULE := true
+
+LOCAL_SRC_FILES := \
+    framework/core/RfxTimer.cpp \
+    framework/test/RfxTimerTest.cpp \
+    framework/test/RfxMclStatusManagerTest.cpp
+
+LOCAL_SHARED_LIBRARIES := \
+    libmtk-ril libutils libcutils liblog libmtkrillog libmtkproperty
+
+ifneq ($(MTK_NUM_MODEM_PROTOCOL),1)
+    LOCAL_CFLAGS += -DANDROID_MULTI_SIM
+endif
+
+ifeq ($(MTK_NUM_MODEM_PROTOCOL), 2)
+    LOCAL_CFLAGS += -DANDROID_SIM_COUNT_2
+endif
+
+ifeq ($(MTK_NUM_MODEM_PROTOCOL), 3)
+    LOCAL_CFLAGS += -DANDROID_SIM_COUNT_3
+endif
+
+ifeq ($(MTK_NUM_MODEM_PROTOCOL), 4)
+    LOCAL_CFLAGS += -DANDROID_SIM_COUNT_4
+endif
+
+LOCAL_CFLAGS += -Werror
+
+LOCAL_C_INCLUDES += vendor/mediatek/ims/include/ril/include \
+    vendor/mediatek/ims/radio_stack/fusion/mtk-ril/framework/include \
+    vendor/mediatek/ims/radio_stack/fusion/mtk-ril/framework/include/base \
+    vendor/mediatek/ims/radio_stack/fusion/mtk-ril/framework/include/core \
+    vendor/mediatek/ims/radio_stack/fusion/mtk-ril/framework/port/android/include \
+    vendor/mediatek/ims/radio_stack/platformlib/include \
+    vendor/mediatek/ims/radio_stack/platformlib/include/utils \
+    vendor/mediatek/ims/radio_stack/platformlib/include/property \
+    vendor/mediatek/ims/radio_stack/platformlib/include/log
+
+LOCAL_MODULE := libmtk-ril_framework_test
+LOCAL_PROPRIETARY_MODULE := true
+LOCAL_MODULE_OWNER := mtk
+LOCAL_CLANG := true
+
+LOCAL_MULTILIB := first
+
+include $(BUILD_NATIVE_TEST)
+
 endif
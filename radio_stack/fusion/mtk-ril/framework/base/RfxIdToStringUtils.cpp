@@ -18,16 +18,54 @@
  * Include
  *****************************************************************************/
 #include "RfxIdToStringUtils.h"
+#include <atomic>
 #include "RfxLog.h"
+#include "RfxMessageId.h"
 
 #define RFX_LOG_TAG "RfxIdToStr"
 
+#define RFX_MSG_ID_RANGE (RFX_MESSAGE_ID_END - RFX_MESSAGE_ID_BEGIN)
+
 RfxIdToStringUtils* RfxIdToStringUtils::sSelf = NULL;
 
+// names of RFX message ids indexed by (id - RFX_MESSAGE_ID_BEGIN), read without mMutex.
+// Registered names are the stringified ids of RFX_REGISTER_DATA_TO_XXX_ID, never freed.
+static std::atomic<const char*> sMsgIdNames[RFX_MSG_ID_RANGE];
+
+// names of the message ids in RfxIdToMsgIdTable.h, so a mapped id is named without
+// a registered RfxBaseData
+namespace {
+
+struct RfxMsgIdName {
+    int msgId;
+    const char* str;
+};
+
+#define RFX_ID_MAPPING(id, msgId) {msgId, #msgId},
+#define RFX_ID_TO_MSG_ID(id, msgId) {msgId, #msgId},
+#define RFX_MSG_ID_TO_ID(id, msgId) {msgId, #msgId},
+constexpr RfxMsgIdName sMsgIdTableNames[] = {
+#include "RfxIdToMsgIdTable.h"
+};
+#undef RFX_ID_MAPPING
+#undef RFX_ID_TO_MSG_ID
+#undef RFX_MSG_ID_TO_ID
+
+}  // namespace
+
 void RfxIdToStringUtils::init() {
     if (sSelf == NULL) {
         RFX_LOG_D(RFX_LOG_TAG, "init");
         sSelf = new RfxIdToStringUtils();
+        for (const RfxMsgIdName& name : sMsgIdTableNames) {
+            int offset = name.msgId - RFX_MESSAGE_ID_BEGIN;
+            if (offset >= 0 && offset < RFX_MSG_ID_RANGE) {
+                // a registered name is the same string, keep whichever came first
+                const char* expected = NULL;
+                sMsgIdNames[offset].compare_exchange_strong(expected, name.str,
+                                                            std::memory_order_release);
+            }
+        }
     }
 }
 
@@ -37,7 +75,18 @@ void RfxIdToStringUtils::registerId(int id, char* str) {
 }
 
 const char* RfxIdToStringUtils::idToString(int id) {
-    init();
+    int offset = id - RFX_MESSAGE_ID_BEGIN;
+    if (offset >= 0 && offset < RFX_MSG_ID_RANGE) {
+        const char* str = sMsgIdNames[offset].load(std::memory_order_acquire);
+        if (str != NULL) {
+            return str;
+        }
+    }
+
+    if (sSelf == NULL) {
+        init();
+        return idToString(id);
+    }
     Mutex::Autolock autoLock(sSelf->mMutex);
     const RfxIdMappingEntry& entry = sSelf->findIdEntry(sSelf->mIdList, id);
     return entry.mStr.string();
@@ -56,6 +105,10 @@ void RfxIdToStringUtils::registerInternal(SortedVector<RfxIdMappingEntry>& list,
             RFX_ASSERT(0);
         }
     }
+    int offset = id - RFX_MESSAGE_ID_BEGIN;
+    if (offset >= 0 && offset < RFX_MSG_ID_RANGE) {
+        sMsgIdNames[offset].store(str, std::memory_order_release);
+    }
     RFX_LOG_D(RFX_LOG_TAG, "id = %d, string = %s", entry.mId, entry.mStr.string());
 }
 
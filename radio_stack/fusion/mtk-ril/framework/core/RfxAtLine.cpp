@@ -17,9 +17,15 @@
 #include "RfxAtLine.h"
 #include "RfxMisc.h"
 #include "RfxRilUtils.h"
+#include "utils/Mutex.h"
+
+using ::android::Mutex;
 
 #define RFX_LOG_TAG "RfxAtLine"
 
+// max free RfxAtLine objects kept for reuse, about 64 lines of burst URC
+#define RFX_AT_LINE_POOL_SIZE 64
+
 static const char* s_finalResponsesSuccess[] = {
         "OK", "CONNECT" /* some stacks start up data on another channel */
 };
@@ -59,39 +65,72 @@ static const char* s_finalResponsesErrorInNumeric[] = {
 
 static const char* s_ackResponse[] = {"ACK"};
 
-RfxAtLine::RfxAtLine(const RfxAtLine& other) {
-    // Only copy THIS node
-    RFX_ASSERT(other.m_pNext == NULL);
+// Free list of RfxAtLine objects, the first pointer size of a free block links the next one
+static Mutex s_poolMutex;
+static void* s_poolHead = NULL;
+static int s_poolCount = 0;
+
+void* RfxAtLine::operator new(size_t size) {
+    if (size == sizeof(RfxAtLine)) {
+        Mutex::Autolock autoLock(s_poolMutex);
+        if (s_poolHead != NULL) {
+            void* ptr = s_poolHead;
+            s_poolHead = *(void**)ptr;
+            s_poolCount--;
+            return ptr;
+        }
+    }
+    return ::operator new(size);
+}
 
-    m_line = (char*)calloc(strlen(other.m_line) + 1, sizeof(char));
-    if (m_line == NULL) {
-        RFX_LOG_E(RFX_LOG_TAG, "OOM");
-        m_pNext = NULL;
-        m_pCur = NULL;
+void RfxAtLine::operator delete(void* ptr) {
+    if (ptr == NULL) {
         return;
     }
-    memcpy(m_line, other.m_line, strlen(other.m_line));
-    m_line[strlen(other.m_line)] = '\0';
-    m_pNext = NULL;
+    {
+        Mutex::Autolock autoLock(s_poolMutex);
+        if (s_poolCount < RFX_AT_LINE_POOL_SIZE) {
+            *(void**)ptr = s_poolHead;
+            s_poolHead = ptr;
+            s_poolCount++;
+            return;
+        }
+    }
+    ::operator delete(ptr);
+}
+
+void RfxAtLine::initLine(const char* line, size_t len) {
+    if (len < INLINE_LINE_SIZE) {
+        m_line = m_inlineLine;
+    } else {
+        m_line = (char*)calloc(len + 1, sizeof(char));
+        if (m_line == NULL) {
+            RFX_LOG_E(RFX_LOG_TAG, "OOM");
+            m_pCur = NULL;
+            return;
+        }
+    }
+    memcpy(m_line, line, len);
+    m_line[len] = '\0';
 
     // initialize p_cur
     m_pCur = m_line;
 }
 
+RfxAtLine::RfxAtLine(const RfxAtLine& other) {
+    // Only copy THIS node
+    RFX_ASSERT(other.m_pNext == NULL);
+
+    m_pNext = NULL;
+    initLine(other.m_line, strlen(other.m_line));
+}
+
 RfxAtLine::RfxAtLine(const char* line, RfxAtLine* next) {
-    m_line = (char*)calloc(strlen(line) + 1, sizeof(char));
+    m_pNext = next;
+    initLine(line, strlen(line));
     if (m_line == NULL) {
-        RFX_LOG_E(RFX_LOG_TAG, "OOM");
         m_pNext = NULL;
-        m_pCur = NULL;
-        return;
     }
-    memcpy(m_line, line, strlen(line));
-    m_line[strlen(line)] = '\0';
-    m_pNext = next;
-
-    // initialize p_cur
-    m_pCur = m_line;
 }
 
 RfxAtLine::~RfxAtLine() {
@@ -100,7 +139,7 @@ RfxAtLine::~RfxAtLine() {
     }
 
     m_pCur = NULL;
-    if (m_line) {
+    if (m_line && m_line != m_inlineLine) {
         free(m_line);
     }
 }
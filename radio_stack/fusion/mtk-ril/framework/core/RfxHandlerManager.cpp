@@ -27,6 +27,57 @@
 
 RfxHandlerManager* RfxHandlerManager::s_self = NULL;
 
+/*****************************************************************************
+ * Class RfxUrcIndex
+ *****************************************************************************/
+RfxUrcIndex::RfxUrcIndex(const SortedVector<RfxHandlerRegisterEntry>& list) {
+    size_t size = list.size();
+    m_entries.setCapacity(size);
+    for (size_t i = 0; i < size; i++) {
+        m_entries.add(list.itemAt(i));
+    }
+
+    // an empty prefix matches any urc, so it goes to every bucket
+    for (int c = 0; c < BUCKET_COUNT; c++) {
+        m_bucket[c] = m_order.size();
+        for (size_t i = 0; i < size; i++) {
+            const RfxHandlerRegisterEntry& item = m_entries.itemAt(i);
+            const char* raw = item.m_raw_urc.string();
+            if ((unsigned char)raw[0] == c || (raw[0] == '\0' && !item.mNeedAllMatch)) {
+                m_order.add(i);
+            }
+        }
+    }
+    m_bucket[BUCKET_COUNT] = m_order.size();
+}
+
+const RfxHandlerRegisterEntry* RfxUrcIndex::find(const char* urc) const {
+    unsigned char c = (unsigned char)urc[0];
+    for (uint32_t i = m_bucket[c]; i < m_bucket[c + 1]; i++) {
+        const RfxHandlerRegisterEntry& item = m_entries.itemAt(m_order.itemAt(i));
+        if (match(item, urc)) {
+            return &item;
+        }
+    }
+    return NULL;
+}
+
+bool RfxUrcIndex::match(const RfxHandlerRegisterEntry& item, const char* urc) {
+    if (item.mNeedAllMatch) {
+        return strcmp(urc, item.m_raw_urc.string()) == 0;
+    }
+    return strncmp(urc, item.m_raw_urc.string(), item.m_raw_urc.size()) == 0;
+}
+
+/*****************************************************************************
+ * Class RfxHandlerManager
+ *****************************************************************************/
+RfxHandlerManager::RfxHandlerManager() {
+    for (int i = 0; i < RIL_SUPPORT_CHANNELS; i++) {
+        m_urc_index[i].store(NULL, std::memory_order_relaxed);
+    }
+}
+
 RfxHandlerManager* RfxHandlerManager::init() {
     if (s_self == NULL) {
         RFX_LOG_D(RFX_LOG_TAG, "init");
@@ -181,6 +232,10 @@ void RfxHandlerManager::registerInternal(SortedVector<RfxHandlerRegisterEntry>&
             RFX_ASSERT(0);
         }
     }
+    // registered after initHandler, the published index is stale
+    if (s_self->getUrcIndex(channel_id) != NULL) {
+        s_self->buildUrcIndexLocked(channel_id);
+    }
     s_self->m_mutex[channel_id].unlock();
 }
 
@@ -274,31 +329,33 @@ request = %d, client_id = %d, raw_urc = %s, index = %zd",
         int offset = slot_id * RIL_CHANNEL_OFFSET;
         for (int i = 0; i < RIL_CHANNEL_OFFSET; i++) {
             int targetChannel = i + offset;
-            Mutex::Autolock autoLock(s_self->m_mutex[targetChannel]);
-            SortedVector<RfxHandlerRegisterEntry> targetList = list[targetChannel];
-            int size = targetList.size();
-            for (int j = 0; j < size; j++) {
-                const RfxHandlerRegisterEntry& item = targetList.itemAt(j);
-                if (item.mNeedAllMatch) {
-                    if (String8(urc) == item.m_raw_urc) {
-                        RFX_LOG_D(RFX_LOG_TAG,
-                                  "findMsgChannel, (specific urc) channel id = %d,\
-slot id = %d, request = %d, client_id = %d, raw_urc = %s",
-                                  item.m_channel_id, item.m_slot_id, item.m_id, item.m_client_id,
-                                  item.m_raw_urc.string());
-                        return item.m_channel_id;
-                    }
-                } else {
-                    if (RfxMisc::strStartsWith(urc, item.m_raw_urc.string())) {
-                        RFX_LOG_D(RFX_LOG_TAG,
-                                  "findMsgChannel, (urc) channel id = %d,\
-slot id = %d, request = %d, client_id = %d, raw_urc = %s",
-                                  item.m_channel_id, item.m_slot_id, item.m_id, item.m_client_id,
-                                  item.m_raw_urc.string());
-                        return item.m_channel_id;
+            const RfxHandlerRegisterEntry* item = NULL;
+            RfxHandlerRegisterEntry matched;
+            const RfxUrcIndex* urcIndex = s_self->getUrcIndex(targetChannel);
+            if (urcIndex != NULL) {
+                item = urcIndex->find(urc);
+            } else {
+                // handlers of this channel are still being created, entries may move after unlock
+                Mutex::Autolock autoLock(s_self->m_mutex[targetChannel]);
+                const SortedVector<RfxHandlerRegisterEntry>& targetList = list[targetChannel];
+                int size = targetList.size();
+                for (int j = 0; j < size; j++) {
+                    if (RfxUrcIndex::match(targetList.itemAt(j), urc)) {
+                        matched = targetList.itemAt(j);
+                        item = &matched;
+                        break;
                     }
                 }
             }
+            if (item != NULL) {
+                RFX_LOG_D(RFX_LOG_TAG,
+                          "findMsgChannel, (%s) channel id = %d, slot id = %d, request = %d, \
+client_id = %d, raw_urc = %s",
+                          (item->mNeedAllMatch ? "specific urc" : "urc"), item->m_channel_id,
+                          item->m_slot_id, item->m_id, item->m_client_id,
+                          item->m_raw_urc.string());
+                return item->m_channel_id;
+            }
         }
     }
     return -1;
@@ -306,19 +363,34 @@ slot id = %d, request = %d, client_id = %d, raw_urc = %s",
 
 void RfxHandlerManager::processMessage(const sp<RfxMclMessage>& msg) {
     // dispatch to correspend handler
-    SortedVector<RfxHandlerRegisterEntry> list =
-            s_self->findListByChannel(msg->getType(), msg->getChannelId());
-    int slotId;
-    if (msg->getSendToMainProtocol()) {
-        slotId = RfxMclStatusManager::getMclStatusManager(RFX_SLOT_ID_UNKNOWN)
-                         ->getIntValue(RFX_STATUS_KEY_MAIN_CAPABILITY_SLOT, 0);
-    } else {
-        slotId = msg->getSlotId();
+    RfxBaseHandler* handler = NULL;
+    const char* urc = (msg->getRawUrc() == NULL ? NULL : msg->getRawUrc()->getLine());
+    const RfxUrcIndex* urcIndex = NULL;
+    if (msg->getType() == RAW_URC && urc != NULL) {
+        RFX_ASSERT(0 <= msg->getChannelId() &&
+                   msg->getChannelId() < RfxChannelManager::getSupportChannels());
+        urcIndex = s_self->getUrcIndex(msg->getChannelId());
     }
 
-    RfxBaseHandler* handler = s_self->findMsgHandler(
-            list, msg->getChannelId(), slotId, msg->getId(), msg->getClientId(),
-            (msg->getRawUrc() == NULL ? NULL : msg->getRawUrc()->getLine()));
+    if (urcIndex != NULL) {
+        const RfxHandlerRegisterEntry* item = urcIndex->find(urc);
+        if (item != NULL) {
+            handler = item->m_handler;
+        }
+    } else {
+        SortedVector<RfxHandlerRegisterEntry> list =
+                s_self->findListByChannel(msg->getType(), msg->getChannelId());
+        int slotId;
+        if (msg->getSendToMainProtocol()) {
+            slotId = RfxMclStatusManager::getMclStatusManager(RFX_SLOT_ID_UNKNOWN)
+                             ->getIntValue(RFX_STATUS_KEY_MAIN_CAPABILITY_SLOT, 0);
+        } else {
+            slotId = msg->getSlotId();
+        }
+
+        handler = s_self->findMsgHandler(list, msg->getChannelId(), slotId, msg->getId(),
+                                         msg->getClientId(), urc);
+    }
     if (handler != NULL) {
         RFX_LOG_D(RFX_LOG_TAG, "processMessage, handler: %p, message = %s. execute on %s", handler,
                   msg->toString().string(),
@@ -349,6 +421,11 @@ void RfxHandlerManager::initHandler(int channel_id) {
         ptr(slot, target_channel /*Hanlder will not get real channel*/);
     }
 
+    // handlers register urc in their constructor, index them for lock-free lookup
+    s_self->m_mutex[channel_id].lock();
+    s_self->buildUrcIndexLocked(channel_id);
+    s_self->m_mutex[channel_id].unlock();
+
     // for non-slot
     /*count = s_self->m_non_slot_handler_list.count(channel_id);
     RFX_LOG_D(RFX_LOG_TAG, "initHandler non_slot handler count = %d", count);
@@ -360,6 +437,17 @@ void RfxHandlerManager::initHandler(int channel_id) {
     }*/
 }
 
+void RfxHandlerManager::buildUrcIndexLocked(int channel_id) {
+    const RfxUrcIndex* oldIndex = getUrcIndex(channel_id);
+    const RfxUrcIndex* newIndex = new RfxUrcIndex(m_urc_list[channel_id]);
+    m_urc_index[channel_id].store(newIndex, std::memory_order_release);
+    if (oldIndex != NULL) {
+        m_retired_urc_index[channel_id].add(oldIndex);
+    }
+    RFX_LOG_D(RFX_LOG_TAG, "buildUrcIndexLocked, channel = %s, urc count = %zu",
+              RfxChannelManager::proxyIdToString(channel_id), m_urc_list[channel_id].size());
+}
+
 SortedVector<RfxHandlerRegisterEntry>* RfxHandlerManager::findListByType(int type) {
     switch (type) {
         case REQUEST:
@@ -24,6 +24,7 @@
 #include "RfxMainThread.h"
 #include "RfxRootController.h"
 #include "RfxTestSuitController.h"
+#include "RfxTimer.h"
 #include <semaphore.h>
 #include <sys/time.h>
 #include <time.h>
@@ -277,8 +278,10 @@ bool RfxMainThread::threadLoop() {
     RfxDebugInfo::updateDebugInfoSwitcher();
 #endif
 
-    // start message loop
-    m_looper = Looper::prepare(0);
+    // start message loop, RfxTimer is ready before the looper is visible to other threads
+    sp<Looper> looper = Looper::prepare(0);
+    RfxTimer::init(looper);
+    m_looper = looper;
 
     sem_post(&sWaitLooperSem);
 
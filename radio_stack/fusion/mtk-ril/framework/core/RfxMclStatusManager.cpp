@@ -31,10 +31,73 @@
 
 RfxMclStatusManager* RfxMclStatusManager::s_self[MAX_SIM_COUNT + 1] = {NULL};
 
-RfxMclStatusManager::RfxMclStatusManager(int slot_id) : m_slot_id(slot_id) {
+RfxMclStatusManager::RfxMclStatusManager(int slot_id) : m_slot_id(slot_id), m_waiter_count(0) {
+    initScalarList();
+}
+
+void RfxMclStatusManager::initScalarList() {
     for (int i = 0; i < RFX_STATUS_KEY_END_OF_ENUM; i++) {
-        m_status_list[i] = NULL;
+        m_scalar_list[i].seq.store(0, std::memory_order_relaxed);
+        m_scalar_list[i].type.store(RfxVariant::DATA_TYPE_NULL, std::memory_order_relaxed);
+        m_scalar_list[i].bits.store(0, std::memory_order_relaxed);
+    }
+}
+
+RfxVariant::ValueTypeEnum RfxMclStatusManager::readScalar(const RfxStatusKeyEnum key,
+                                                          int64_t* bits) const {
+    RFX_ASSERT(key > RFX_STATUS_KEY_START && key < RFX_STATUS_KEY_END_OF_ENUM);
+
+    const ScalarEntry& entry = m_scalar_list[key];
+    uint32_t seq;
+    int type;
+    do {
+        seq = entry.seq.load(std::memory_order_acquire);
+        while (seq & 1) {
+            seq = entry.seq.load(std::memory_order_acquire);
+        }
+        type = entry.type.load(std::memory_order_relaxed);
+        *bits = entry.bits.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while (entry.seq.load(std::memory_order_relaxed) != seq);
+
+    return (RfxVariant::ValueTypeEnum)type;
+}
+
+void RfxMclStatusManager::writeScalar(const RfxStatusKeyEnum key, const RfxVariant& value) {
+    RfxVariant::ValueTypeEnum type = value.get_type();
+    int64_t bits = 0;
+    switch (type) {
+        case RfxVariant::DATA_TYPE_NULL:
+            break;
+        case RfxVariant::DATA_TYPE_BOOL:
+            bits = value.asBool() ? 1 : 0;
+            break;
+        case RfxVariant::DATA_TYPE_INT:
+            bits = value.asInt();
+            break;
+        case RfxVariant::DATA_TYPE_FLOAT: {
+            float f = value.asFloat();
+            int32_t raw;
+            memcpy(&raw, &f, sizeof(raw));
+            bits = raw;
+            break;
+        }
+        case RfxVariant::DATA_TYPE_INT64:
+            bits = value.asInt64();
+            break;
+        default:
+            // only the type is mirrored, the getters of classes read m_status_list under m_mutex
+            break;
     }
+
+    // writers of one key are serialized by m_mutex[key]
+    ScalarEntry& entry = m_scalar_list[key];
+    uint32_t seq = entry.seq.load(std::memory_order_relaxed);
+    entry.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    entry.type.store(type, std::memory_order_relaxed);
+    entry.bits.store(bits, std::memory_order_relaxed);
+    entry.seq.store(seq + 2, std::memory_order_release);
 }
 
 void RfxMclStatusManager::init() {
@@ -86,11 +149,10 @@ const RfxVariant& RfxMclStatusManager::getValue(const RfxStatusKeyEnum key,
     RFX_ASSERT(key > RFX_STATUS_KEY_START && key < RFX_STATUS_KEY_END_OF_ENUM);
 
     Mutex::Autolock autoLock(m_mutex[key]);
-    if (m_status_list[key] == NULL ||
-        m_status_list[key]->value.get_type() == RfxVariant::DATA_TYPE_NULL) {
+    if (m_status_list[key].get_type() == RfxVariant::DATA_TYPE_NULL) {
         return default_value;
     } else {
-        return m_status_list[key]->value;
+        return m_status_list[key];
     }
 }
 
@@ -98,11 +160,10 @@ const RfxVariant& RfxMclStatusManager::getValue(const RfxStatusKeyEnum key) cons
     RFX_ASSERT(key > RFX_STATUS_KEY_START && key < RFX_STATUS_KEY_END_OF_ENUM);
 
     Mutex::Autolock autoLock(m_mutex[key]);
-    if (m_status_list[key] == NULL ||
-        m_status_list[key]->value.get_type() == RfxVariant::DATA_TYPE_NULL) {
+    if (m_status_list[key].get_type() == RfxVariant::DATA_TYPE_NULL) {
         return getDefaultValue(key);
     } else {
-        return m_status_list[key]->value;
+        return m_status_list[key];
     }
 }
 
@@ -122,12 +183,14 @@ void RfxMclStatusManager::setValueByRfx(const RfxStatusKeyEnum key, const RfxVar
 void RfxMclStatusManager::setValueInternal(const RfxStatusKeyEnum key, const RfxVariant& value,
                                            bool force_notify, bool is_default, bool is_status_sync,
                                            bool update_for_mock) {
-    m_mutex[key].lock();
+    RFX_UNUSED(update_for_mock);
     RFX_ASSERT(key > RFX_STATUS_KEY_START && key < RFX_STATUS_KEY_END_OF_ENUM);
+    m_mutex[key].lock();
 
-    if (m_status_list[key] == NULL) {
-        m_status_list[key] = new StatusListEntry();
-        m_status_list[key]->value = value;
+    RfxVariant& current = m_status_list[key];
+    if (current.get_type() == RfxVariant::DATA_TYPE_NULL) {
+        current = value;
+        writeScalar(key, value);
         if (RfxRilUtils::hideStatusLog(key)) {
             RFX_LOG_D(RFX_LOG_TAG, "setValue() slot(%d) key = %s, value = [XXX]", m_slot_id,
                       getKeyString(key));
@@ -135,11 +198,8 @@ void RfxMclStatusManager::setValueInternal(const RfxStatusKeyEnum key, const Rfx
             RFX_LOG_D(RFX_LOG_TAG, "setValue() slot(%d) key = %s, value = [%s]", m_slot_id,
                       getKeyString(key), value.toString().string());
         }
-    } else {
-        RfxVariant old = m_status_list[key]->value;
-        bool notify = false;
-        bool is_dif = (old != value);
-
+    } else if (current != value) {
+        // same as RfxStatusManager, only a change is worth formatting the values
         if (RfxRilUtils::hideStatusLog(key)) {
             RFX_LOG_D(RFX_LOG_TAG,
                       "setValue() slot(%d) key = %s, old = [XXX], new = [XXX],\
@@ -150,35 +210,38 @@ is_force = %s, is_default = %s",
             RFX_LOG_D(RFX_LOG_TAG,
                       "setValue() slot(%d) key = %s, old = [%s], new = [%s],\
 is_force = %s, is_default = %s",
-                      m_slot_id, getKeyString(key), old.toString().string(),
+                      m_slot_id, getKeyString(key), current.toString().string(),
                       value.toString().string(), force_notify ? "true" : "false",
                       is_default ? "true" : "false");
         }
-
-        if ((is_dif && !is_default) || force_notify) {
-            // if setting default value and not force notify, don't notify
-            notify = true;
-        }
-
-        // If current ril is in mock status , do not notify any module.
-        if (RfxRilUtils::getRilRunMode() == RilRunMode::RIL_RUN_MODE_MOCK && update_for_mock) {
-            notify = false;
-        }
-
-        if (is_dif) {
-            if (old.get_type() == RfxVariant::DATA_TYPE_NULL) {
-                old = value;
-            }
-            m_status_list[key]->value = value;
-        }
+        current = value;
+        writeScalar(key, value);
     }
     m_mutex[key].unlock();
 
+    // pairs with the increase of m_waiter_count before waiter reads the value
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waiter_count.load(std::memory_order_relaxed) > 0) {
+        Mutex::Autolock autoLock(m_wait_mutex);
+        m_wait_condition.broadcast();
+    }
+
     if (!is_status_sync) {
         updateValueToTelCore(m_slot_id, key, value, force_notify, is_default);
     }
 }
 
+void RfxMclStatusManager::waitForBoolValue(const RfxStatusKeyEnum key, bool value) {
+    Mutex::Autolock autoLock(m_wait_mutex);
+    m_waiter_count.fetch_add(1);
+    // the value is read without m_mutex, pairs with the fence of setValueInternal()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (getBoolValue(key, value) != value) {
+        m_wait_condition.wait(m_wait_mutex);
+    }
+    m_waiter_count.fetch_sub(1);
+}
+
 void RfxMclStatusManager::updateValueToTelCore(int slot_id, const RfxStatusKeyEnum key,
                                                const RfxVariant value, bool force_notify,
                                                bool is_default) {
@@ -31,9 +31,23 @@ static const char* s_smsUnsoliciteds[] = {
 
 #define RFX_LOG_TAG "AT"
 
+// dump wait histograms of the channel every N waits
+#define WAIT_DUMP_INTERVAL 1024
+
+static const char* s_waitTypeNames[] = {"reader", "command", "sim switch"};
+
+// same as RmcAtciRequestHandler::ENABLE_URC_PROP
+#define ATCI_URC_ENABLE_PROP "persist.vendor.service.atci_urc.enable"
+
 RfxReader::RfxReader(int fd, int channel_id, RfxChannelContext* context)
-    : m_fd(fd), m_channel_id(channel_id), m_context(context), mName(NULL), m_pATBufferCur(NULL) {
+    : m_fd(fd),
+      m_channel_id(channel_id),
+      m_context(context),
+      mName(NULL),
+      m_pATBufferCur(NULL),
+      m_waitCount(0) {
     memset(&m_threadId, 0, sizeof(pthread_t));
+    memset(m_waitHistogram, 0, sizeof(m_waitHistogram));
     memset(m_aTBuffer, 0, (MAX_AT_RESPONSE + 1));
 }
 
@@ -54,8 +68,6 @@ bool RfxReader::threadLoop() {
 }
 
 void RfxReader::readerLoop() {
-    int err = 0;
-
     m_pATBufferCur = m_aTBuffer;
     for (;;) {
         const char* line;
@@ -63,20 +75,18 @@ void RfxReader::readerLoop() {
 
         // RFX_LOG_D(LOG_TAG, "%s:%s", readerName, line);
         if (line == NULL) break;
-        while ((err = m_context->m_readerMutex.tryLock()) != 0) {
-            usleep(200 * 1000);
-        }
+        lockReaderMutex();
         if (isSMSUnsolicited(line)) {
-            char* line1;
             const char* line2;
             printLog(DEBUG, String8::format("SMS Urc Received!"));
             // The scope of string returned by 'readline()' is valid only
             // till next call to 'readline()' hence making a copy of line
             // before calling readline again.
-            line1 = strdup(line);
-            if (line1 == NULL) {
+            RfxAtLine* atLine1 = new RfxAtLine(line, NULL);
+            if (atLine1->getLine() == NULL) {
                 printLog(ERROR, String8::format("malloc failed"));
                 m_context->m_readerMutex.unlock();
+                delete atLine1;
                 break;
             }
             line2 = readline(m_aTBuffer);
@@ -84,27 +94,27 @@ void RfxReader::readerLoop() {
             if (line2 == NULL) {
                 printLog(ERROR, String8::format("NULL line found in %s", mName));
                 m_context->m_readerMutex.unlock();
-                free(line1);
+                delete atLine1;
                 break;
             }
             int index = 0;
-            if ((index = needToHidenLog(line1)) >= 0) {
+            if ((index = needToHidenLog(atLine1->getLine())) >= 0) {
                 printLog(INFO, String8::format("%s: line1:%s:***,line2:***", mName,
                                                getHidenLogPreFix(index)));
             } else {
-                printLog(INFO, String8::format("%s: line1:%s,line2:%s", mName, line1, line2));
+                printLog(INFO, String8::format("%s: line1:%s,line2:%s", mName, atLine1->getLine(),
+                                               line2));
             }
-            RfxAtLine* atLine1 = new RfxAtLine(line1, NULL);
             RfxAtLine* atLine2 = new RfxAtLine(line2, NULL);
             handleUnsolicited(atLine1, atLine2);
             // free at RfxMclMessage deconstructor
             // delete(atLine1);
             // delete(atLine2);
-            free(line1);
         } else {
-            while ((err = m_context->m_commandMutex.tryLock()) != 0) {
-                usleep(200 * 1000);
-            }
+            // sender releases m_commandMutex while it waits for the response
+            nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+            m_context->m_commandMutex.lock();
+            recordWaitTime(WAIT_COMMAND, start);
 
             int index = 0;
             if ((index = needToHidenLog(line)) >= 0) {
@@ -128,10 +138,10 @@ void RfxReader::readerLoop() {
         m_context->m_readerMutex.unlock();
         if (RfxRilUtils::isSimSwitchUrc(line)) {
             // Wait for sim switch to handle this urc before processing the next one
-            while (RfxMclStatusManager::getNonSlotMclStatusManager()->getBoolValue(
-                    RFX_STATUS_KEY_CAPABILITY_SWITCH_URC_CHANNEL, false)) {
-                usleep(5 * 1000);
-            }
+            nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+            RfxMclStatusManager::getNonSlotMclStatusManager()->waitForBoolValue(
+                    RFX_STATUS_KEY_CAPABILITY_SWITCH_URC_CHANNEL, false);
+            recordWaitTime(WAIT_SIM_SWITCH, start);
         }
     }
     static Mutex isTrmMutex;
@@ -147,6 +157,43 @@ void RfxReader::readerLoop() {
     isTrmMutex.unlock();
 }
 
+void RfxReader::lockReaderMutex() {
+    nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+    for (;;) {
+        RfxChannelContext* context = m_context;
+        context->m_readerMutex.lock();
+        // capability switch swaps the context of readers while holding their m_readerMutex
+        if (context == m_context) {
+            break;
+        }
+        context->m_readerMutex.unlock();
+    }
+    recordWaitTime(WAIT_READER, start);
+}
+
+void RfxReader::recordWaitTime(int type, nsecs_t start) {
+    nsecs_t waitUs = ns2us(systemTime(SYSTEM_TIME_MONOTONIC) - start);
+    int bucket = 0;
+    // buckets: <100us, <1ms, <10ms, <100ms, <1s, >=1s
+    for (nsecs_t bound = 100; bucket < WAIT_BUCKET_COUNT - 1 && waitUs >= bound; bound *= 10) {
+        bucket++;
+    }
+    m_waitHistogram[type][bucket]++;
+    if (waitUs >= 100 * 1000) {
+        printLog(INFO, String8::format("%s wait %s for %" PRId64 " us", mName,
+                                       s_waitTypeNames[type], waitUs));
+    }
+    if (++m_waitCount % WAIT_DUMP_INTERVAL == 0) {
+        for (int i = 0; i < WAIT_TYPE_COUNT; i++) {
+            const uint32_t* h = m_waitHistogram[i];
+            printLog(DEBUG, String8::format("%s wait %s histogram <100us:%u <1ms:%u <10ms:%u "
+                                            "<100ms:%u <1s:%u >=1s:%u",
+                                            mName, s_waitTypeNames[i], h[0], h[1], h[2], h[3],
+                                            h[4], h[5]));
+        }
+    }
+}
+
 char* RfxReader::readline(char* buffer) {
     ssize_t count;
 
@@ -351,19 +398,25 @@ void RfxReader::processLine(const char* line) {
 }
 
 void RfxReader::handleUnsolicited(RfxAtLine* line1, RfxAtLine* line2) {
+    // send each raw urc to atci module, only consumed when atci urc is enabled.
+    // Copy it before the urc handler may tokenize line1 in place.
+    sp<RfxMclMessage> atciMsg;
+    char enabled[RFX_PROPERTY_VALUE_MAX] = {0};
+    rfx_property_get(ATCI_URC_ENABLE_PROP, enabled, "0");
+    if (atoi(enabled) == 1) {
+        atciMsg = RfxMclMessage::obtainEvent(
+                RFX_MSG_EVENT_RAW_URC, RfxStringData(line1->getLine(), strlen(line1->getLine())),
+                RIL_CMD_PROXY_6, m_channel_id / RIL_CHANNEL_OFFSET);
+    }
+
     // create Message and set to MclDispatcherThread
     sp<RfxMclMessage> msg = RfxMclMessage::obtainRawUrc(m_channel_id, line1, line2);
     RfxMclDispatcherThread::waitLooper();
     RfxMclDispatcherThread::enqueueMclMessage(msg);
 
-    // send each raw urc to atci module
-    int slotId = RfxMclStatusManager::getNonSlotMclStatusManager()->getIntValue(
-            RFX_STATUS_KEY_MAIN_CAPABILITY_SLOT, 0);
-    sp<RfxMclMessage> atciMsg = RfxMclMessage::obtainEvent(
-            RFX_MSG_EVENT_RAW_URC,
-            RfxStringData(msg->getRawUrc()->getLine(), strlen(msg->getRawUrc()->getLine())),
-            RIL_CMD_PROXY_6, m_channel_id / RIL_CHANNEL_OFFSET);
-    RfxMclDispatcherThread::enqueueMclMessage(atciMsg);
+    if (atciMsg != NULL) {
+        RfxMclDispatcherThread::enqueueMclMessage(atciMsg);
+    }
 }
 
 void RfxReader::handleFinalResponse(RfxAtLine* line) {
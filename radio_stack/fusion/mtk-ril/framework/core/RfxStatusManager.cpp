@@ -168,6 +168,8 @@ is_force = %s, is_default = %s",
 void RfxStatusManager::updateValueMdComm(int slot_id, const RfxStatusKeyEnum key,
                                          const RfxVariant value, bool force_notify,
                                          bool is_default) {
+    // keep it in the mcl dispatcher queue, handlers there see the value and the requests
+    // sent before it in the same order as TelCore
     sp<RfxMessage> msg =
             RfxMessage::obtainStatusSync(slot_id, key, value, force_notify, is_default);
     RFX_OBJ_GET_INSTANCE(RfxRilAdapter)->requestToMcl(msg);
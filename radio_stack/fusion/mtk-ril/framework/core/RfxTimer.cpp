@@ -22,17 +22,57 @@
 #include "RfxMainThread.h"
 #include "RfxAsyncSignal.h"
 #include "RfxRootController.h"
+#include "utils/Mutex.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+using ::android::LooperCallback;
+using ::android::Mutex;
 
 #define RFX_LOG_TAG "RfxTimer"
 
+/*****************************************************************************
+ * Define
+ *****************************************************************************/
+// timers expiring in the same tick are fired by one wakeup of the main looper
+#define RFX_TIMER_TICK_NS ms2ns(10)
+
+// 4 levels of 64 slots cover 2^24 ticks, about 46 hours, later timers wait in the last level
+#define RFX_TIMER_WHEEL_BITS 6
+#define RFX_TIMER_WHEEL_SLOTS (1 << RFX_TIMER_WHEEL_BITS)
+#define RFX_TIMER_WHEEL_MASK (RFX_TIMER_WHEEL_SLOTS - 1)
+#define RFX_TIMER_WHEEL_LEVELS 4
+
+#define RFX_TIMER_NO_TICK UINT64_MAX
+
+class TimerHandler;
+
+typedef struct _TimerList {
+    TimerHandler* head;
+    TimerHandler* tail;
+    // slot in RfxTimerWheel, level -1 for the expired list
+    int level;
+    int index;
+} TimerList;
+
 /*****************************************************************************
  * Class TimerHandler
  *****************************************************************************/
 class TimerHandler : public RfxMainHandler {
   public:
-    TimerHandler(const RfxCallback0& _callback) : callback(_callback) {}
+    TimerHandler(const RfxCallback0& _callback)
+        : expire_tick(0), prev(NULL), next(NULL), list(NULL), callback(_callback) {}
     virtual ~TimerHandler() {}
 
+  public:
+    // link of RfxTimerWheel, guarded by its mutex
+    uint64_t expire_tick;
+    TimerHandler* prev;
+    TimerHandler* next;
+    TimerList* list;
+
   protected:
     virtual void onHandleMessage(const Message& message) {
         RFX_UNUSED(message);
@@ -48,18 +88,307 @@ class TimerHandler : public RfxMainHandler {
     RfxCallback0 callback;
 };
 
+/*****************************************************************************
+ * Class RfxTimerWheel
+ *****************************************************************************/
+// Hierarchical timing wheel of the main thread. Level 0 has a slot per tick, a slot of
+// level n covers 64^n ticks and is cascaded into the lower levels when level 0 wraps to it.
+// A timerfd polled by the main looper is armed to the next non-empty tick or cascade, so
+// start and stop are O(1) and do not touch the looper message queue. The wheel holds a
+// strong reference of each linked timer.
+class RfxTimerWheel : public LooperCallback {
+  public:
+    RfxTimerWheel(int fd);
+    virtual ~RfxTimerWheel() {}
+
+    void add(TimerHandler* timer, nsecs_t time);
+
+    void remove(TimerHandler* timer);
+
+    virtual int handleEvent(int fd, int events, void* data);
+
+  private:
+    uint64_t toTick(nsecs_t now) const {
+        return (uint64_t)((now - m_base_time) / RFX_TIMER_TICK_NS);
+    }
+
+    void link(TimerHandler* timer, TimerList* list);
+    void unlink(TimerHandler* timer);
+    void insert(TimerHandler* timer);
+    void cascade();
+    void advance(uint64_t now_tick);
+    void arm();
+
+  private:
+    Mutex m_mutex;
+    int m_fd;
+    nsecs_t m_base_time;
+    // the next tick to expire
+    uint64_t m_current_tick;
+    uint64_t m_armed_tick;
+    // timers in m_wheel, not counting m_expired
+    int m_count;
+    TimerList m_wheel[RFX_TIMER_WHEEL_LEVELS][RFX_TIMER_WHEEL_SLOTS];
+    // bit n is set when m_wheel[level][n] is not empty
+    uint64_t m_bitmap[RFX_TIMER_WHEEL_LEVELS];
+    TimerList m_expired;
+};
+
+static sp<RfxTimerWheel> sTimerWheel;
+
+RfxTimerWheel::RfxTimerWheel(int fd)
+    : m_fd(fd),
+      m_base_time(systemTime(SYSTEM_TIME_MONOTONIC)),
+      m_current_tick(0),
+      m_armed_tick(RFX_TIMER_NO_TICK),
+      m_count(0) {
+    for (int level = 0; level < RFX_TIMER_WHEEL_LEVELS; level++) {
+        for (int index = 0; index < RFX_TIMER_WHEEL_SLOTS; index++) {
+            m_wheel[level][index].head = NULL;
+            m_wheel[level][index].tail = NULL;
+            m_wheel[level][index].level = level;
+            m_wheel[level][index].index = index;
+        }
+        m_bitmap[level] = 0;
+    }
+    m_expired.head = NULL;
+    m_expired.tail = NULL;
+    m_expired.level = -1;
+    m_expired.index = 0;
+}
+
+void RfxTimerWheel::link(TimerHandler* timer, TimerList* list) {
+    timer->list = list;
+    timer->next = NULL;
+    timer->prev = list->tail;
+    if (list->tail != NULL) {
+        list->tail->next = timer;
+    } else {
+        list->head = timer;
+    }
+    list->tail = timer;
+    if (list->level >= 0) {
+        m_bitmap[list->level] |= (1ull << list->index);
+        m_count++;
+    }
+}
+
+void RfxTimerWheel::unlink(TimerHandler* timer) {
+    TimerList* list = timer->list;
+    if (timer->prev != NULL) {
+        timer->prev->next = timer->next;
+    } else {
+        list->head = timer->next;
+    }
+    if (timer->next != NULL) {
+        timer->next->prev = timer->prev;
+    } else {
+        list->tail = timer->prev;
+    }
+    timer->prev = NULL;
+    timer->next = NULL;
+    timer->list = NULL;
+    if (list->level >= 0) {
+        if (list->head == NULL) {
+            m_bitmap[list->level] &= ~(1ull << list->index);
+        }
+        m_count--;
+    }
+}
+
+void RfxTimerWheel::insert(TimerHandler* timer) {
+    uint64_t expire = timer->expire_tick;
+    if (expire < m_current_tick) {
+        expire = m_current_tick;
+    }
+    uint64_t diff = expire - m_current_tick;
+    if (diff >= (1ull << (RFX_TIMER_WHEEL_BITS * RFX_TIMER_WHEEL_LEVELS))) {
+        expire = m_current_tick + (1ull << (RFX_TIMER_WHEEL_BITS * RFX_TIMER_WHEEL_LEVELS)) - 1;
+        diff = expire - m_current_tick;
+    }
+
+    int level = 0;
+    while (diff >= (1ull << (RFX_TIMER_WHEEL_BITS * (level + 1)))) {
+        level++;
+    }
+    int index = (expire >> (RFX_TIMER_WHEEL_BITS * level)) & RFX_TIMER_WHEEL_MASK;
+    link(timer, &m_wheel[level][index]);
+}
+
+// called when level 0 wraps, moves the slot of the next level down, and so on while that
+// level wraps too
+void RfxTimerWheel::cascade() {
+    for (int level = 1; level < RFX_TIMER_WHEEL_LEVELS; level++) {
+        int index = (m_current_tick >> (RFX_TIMER_WHEEL_BITS * level)) & RFX_TIMER_WHEEL_MASK;
+        TimerList* list = &m_wheel[level][index];
+        while (list->head != NULL) {
+            TimerHandler* timer = list->head;
+            unlink(timer);
+            insert(timer);
+        }
+        if (index != 0) {
+            break;
+        }
+    }
+}
+
+void RfxTimerWheel::advance(uint64_t now_tick) {
+    while (m_current_tick <= now_tick) {
+        if (m_count == 0) {
+            // nothing to expire in between
+            m_current_tick = now_tick + 1;
+            break;
+        }
+        int index = m_current_tick & RFX_TIMER_WHEEL_MASK;
+        if (index == 0) {
+            cascade();
+        }
+        TimerList* list = &m_wheel[0][index];
+        while (list->head != NULL) {
+            TimerHandler* timer = list->head;
+            unlink(timer);
+            link(timer, &m_expired);
+        }
+        m_current_tick++;
+    }
+}
+
+void RfxTimerWheel::arm() {
+    uint64_t next_tick = RFX_TIMER_NO_TICK;
+    if (m_expired.head != NULL) {
+        // a passed tick, fires at once
+        next_tick = m_current_tick - 1;
+    }
+    for (int level = 0; level < RFX_TIMER_WHEEL_LEVELS; level++) {
+        uint64_t bitmap = m_bitmap[level];
+        if (bitmap == 0) {
+            continue;
+        }
+        int shift = RFX_TIMER_WHEEL_BITS * level;
+        uint64_t block = m_current_tick >> shift;
+        // the slot of the current block is still pending at level 0, and at the upper levels
+        // only if the cascade to it has not run yet
+        int first = (level > 0 && (m_current_tick & ((1ull << shift) - 1)) != 0) ? 1 : 0;
+        int start = (block + first) & RFX_TIMER_WHEEL_MASK;
+        uint64_t rotated = start == 0 ? bitmap : (bitmap >> start) | (bitmap << (64 - start));
+        uint64_t tick = (block + first + __builtin_ctzll(rotated)) << shift;
+        if (tick < next_tick) {
+            next_tick = tick;
+        }
+    }
+    if (next_tick == m_armed_tick) {
+        return;
+    }
+
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    if (next_tick != RFX_TIMER_NO_TICK) {
+        nsecs_t when = m_base_time + (nsecs_t)next_tick * RFX_TIMER_TICK_NS;
+        spec.it_value.tv_sec = when / 1000000000LL;
+        spec.it_value.tv_nsec = when % 1000000000LL;
+    }
+    if (timerfd_settime(m_fd, TFD_TIMER_ABSTIME, &spec, NULL) != 0) {
+        RFX_LOG_E(RFX_LOG_TAG, "arm(), timerfd_settime failed: %s", strerror(errno));
+    }
+    m_armed_tick = next_tick;
+}
+
+void RfxTimerWheel::add(TimerHandler* timer, nsecs_t time) {
+    nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+    if (time < 0) {
+        time = 0;
+    }
+
+    Mutex::Autolock autoLock(m_mutex);
+    if (m_count == 0 && m_current_tick < toTick(now)) {
+        // idle wheel, skip the ticks passed without a wakeup
+        m_current_tick = toTick(now);
+    }
+    // round up, a timer never fires earlier than asked
+    timer->expire_tick =
+            (uint64_t)((now + time - m_base_time + RFX_TIMER_TICK_NS - 1) / RFX_TIMER_TICK_NS);
+    timer->incStrong(this);
+    if (timer->expire_tick < m_current_tick) {
+        // its tick has been handled
+        link(timer, &m_expired);
+    } else {
+        insert(timer);
+    }
+    arm();
+}
+
+void RfxTimerWheel::remove(TimerHandler* timer) {
+    Mutex::Autolock autoLock(m_mutex);
+    if (timer->list != NULL) {
+        unlink(timer);
+        // the caller still holds the handle
+        timer->decStrong(this);
+    }
+}
+
+int RfxTimerWheel::handleEvent(int fd, int events, void* data) {
+    RFX_UNUSED(events);
+    RFX_UNUSED(data);
+    uint64_t expirations;
+    if (read(fd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN) {
+        RFX_LOG_E(RFX_LOG_TAG, "handleEvent(), read failed: %s", strerror(errno));
+    }
+
+    m_mutex.lock();
+    m_armed_tick = RFX_TIMER_NO_TICK;
+    advance(toTick(systemTime(SYSTEM_TIME_MONOTONIC)));
+    m_mutex.unlock();
+
+    // one by one, a callback may stop the timers expired after it
+    Message dummy_msg;
+    while (true) {
+        m_mutex.lock();
+        sp<TimerHandler> timer = m_expired.head;
+        if (timer != NULL) {
+            unlink(timer.get());
+            timer->decStrong(this);
+        }
+        m_mutex.unlock();
+        if (timer == NULL) {
+            break;
+        }
+        // as a delayed message did, watchdog and async signals are handled per timer
+        timer->handleMessage(dummy_msg);
+    }
+
+    m_mutex.lock();
+    arm();
+    m_mutex.unlock();
+    return 1;
+}
+
 /*****************************************************************************
  * Class RfxTimer
  *****************************************************************************/
 
+void RfxTimer::init(const sp<Looper>& looper) {
+    int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) {
+        // fall back to the delayed messages of looper
+        RFX_LOG_E(RFX_LOG_TAG, "init(), timerfd_create failed: %s", strerror(errno));
+        return;
+    }
+    sTimerWheel = new RfxTimerWheel(fd);
+    looper->addFd(fd, Looper::POLL_CALLBACK, Looper::EVENT_INPUT, sTimerWheel, NULL);
+}
+
 TimerHandle RfxTimer::start(const RfxCallback0& callback, nsecs_t time) {
     Looper* looper = RfxMainThread::getLooper().get();
 
     if (looper != NULL) {
-        Message dummy_msg;
-        sp<MessageHandler> handler = new TimerHandler(callback);
+        sp<TimerHandler> handler = new TimerHandler(callback);
         RFX_LOG_D(RFX_LOG_TAG, "start(), timer = %p", handler.get());
-        looper->sendMessageDelayed(time, handler, dummy_msg);
+        if (sTimerWheel != NULL) {
+            sTimerWheel->add(handler.get(), time);
+        } else {
+            Message dummy_msg;
+            looper->sendMessageDelayed(time, handler, dummy_msg);
+        }
         return handler;
     } else {
         return TimerHandle(NULL);
@@ -69,8 +398,13 @@ TimerHandle RfxTimer::start(const RfxCallback0& callback, nsecs_t time) {
 void RfxTimer::stop(const TimerHandle& timer_handle) {
     Looper* looper = RfxMainThread::getLooper().get();
 
-    if (looper != NULL) {
+    if (looper != NULL && timer_handle != NULL) {
         RFX_LOG_D(RFX_LOG_TAG, "stop(), timer = %p", timer_handle.get());
-        looper->removeMessages(timer_handle);
+        if (sTimerWheel != NULL) {
+            // only start() creates handles
+            sTimerWheel->remove(static_cast<TimerHandler*>(timer_handle.get()));
+        } else {
+            looper->removeMessages(timer_handle);
+        }
     }
 }
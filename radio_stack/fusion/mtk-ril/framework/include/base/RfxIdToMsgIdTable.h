@@ -0,0 +1,680 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RFX_ID_TO_MSG_ID_TABLE_HEADER__
+#define __RFX_ID_TO_MSG_ID_TABLE_HEADER__
+
+// libril request/urc id <-> vendor ril message id, expanded by RfxIdToMsgIdUtils and the
+// message id names of RfxIdToStringUtils
+// RFX_ID_MAPPING(id, msgId): both directions
+// RFX_ID_TO_MSG_ID(id, msgId): libril -> vendor ril only
+// RFX_MSG_ID_TO_ID(id, msgId): vendor ril -> libril only
+
+// SIM -- Start
+RFX_ID_MAPPING(RIL_REQUEST_GET_SIM_STATUS, RFX_MSG_REQUEST_GET_SIM_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_ENTER_SIM_PIN, RFX_MSG_REQUEST_ENTER_SIM_PIN)
+RFX_ID_MAPPING(RIL_REQUEST_ENTER_SIM_PUK, RFX_MSG_REQUEST_ENTER_SIM_PUK)
+RFX_ID_MAPPING(RIL_REQUEST_ENTER_SIM_PIN2, RFX_MSG_REQUEST_ENTER_SIM_PIN2)
+RFX_ID_MAPPING(RIL_REQUEST_ENTER_SIM_PUK2, RFX_MSG_REQUEST_ENTER_SIM_PUK2)
+RFX_ID_MAPPING(RIL_REQUEST_CHANGE_SIM_PIN, RFX_MSG_REQUEST_CHANGE_SIM_PIN)
+RFX_ID_MAPPING(RIL_REQUEST_CHANGE_SIM_PIN2, RFX_MSG_REQUEST_CHANGE_SIM_PIN2)
+RFX_ID_MAPPING(RIL_REQUEST_SIM_IO, RFX_MSG_REQUEST_SIM_IO)
+RFX_ID_MAPPING(RIL_REQUEST_ISIM_AUTHENTICATION, RFX_MSG_REQUEST_ISIM_AUTHENTICATION)
+RFX_ID_MAPPING(RIL_REQUEST_GENERAL_SIM_AUTH, RFX_MSG_REQUEST_GENERAL_SIM_AUTH)
+RFX_ID_MAPPING(RIL_REQUEST_SIM_OPEN_CHANNEL, RFX_MSG_REQUEST_SIM_OPEN_CHANNEL)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SIM_CARD_POWER, RFX_MSG_REQUEST_SET_SIM_CARD_POWER)
+RFX_ID_MAPPING(RIL_REQUEST_SIM_CLOSE_CHANNEL, RFX_MSG_REQUEST_SIM_CLOSE_CHANNEL)
+RFX_ID_MAPPING(RIL_REQUEST_SIM_TRANSMIT_APDU_BASIC, RFX_MSG_REQUEST_SIM_TRANSMIT_APDU_BASIC)
+RFX_ID_MAPPING(RIL_REQUEST_SIM_TRANSMIT_APDU_CHANNEL, RFX_MSG_REQUEST_SIM_TRANSMIT_APDU_CHANNEL)
+RFX_ID_MAPPING(RIL_REQUEST_SIM_GET_ATR, RFX_MSG_REQUEST_SIM_GET_ATR)
+RFX_ID_MAPPING(RIL_REQUEST_SIM_GET_ICCID, RFX_MSG_REQUEST_SIM_GET_ICCID)
+RFX_ID_MAPPING(RIL_REQUEST_SIM_AUTHENTICATION, RFX_MSG_REQUEST_SIM_AUTHENTICATION)
+RFX_ID_MAPPING(RIL_REQUEST_GET_IMSI, RFX_MSG_REQUEST_GET_IMSI)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_FACILITY_LOCK, RFX_MSG_REQUEST_QUERY_FACILITY_LOCK)
+RFX_ID_MAPPING(RIL_REQUEST_SET_FACILITY_LOCK, RFX_MSG_REQUEST_SET_FACILITY_LOCK)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_SUBSCRIPTION, RFX_MSG_REQUEST_CDMA_SUBSCRIPTION)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_GET_SUBSCRIPTION_SOURCE,
+               RFX_MSG_REQUEST_CDMA_GET_SUBSCRIPTION_SOURCE)
+RFX_ID_MAPPING(RIL_REQUEST_ENTER_NETWORK_DEPERSONALIZATION,
+               RFX_MSG_REQUEST_SIM_ENTER_NETWORK_DEPERSONALIZATION)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_SIM_NETWORK_LOCK, RFX_MSG_REQUEST_SIM_QUERY_SIM_NETWORK_LOCK)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SIM_NETWORK_LOCK, RFX_MSG_REQUEST_SIM_SET_SIM_NETWORK_LOCK)
+RFX_ID_MAPPING(RIL_REQUEST_ENTER_DEPERSONALIZATION, RFX_MSG_REQUEST_SIM_ENTER_DEPERSONALIZATION)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SIM_POWER, RFX_MSG_REQUEST_SET_SIM_POWER)
+RFX_ID_MAPPING(RIL_REQUEST_SET_ALLOWED_CARRIERS, RFX_MSG_REQUEST_SET_ALLOWED_CARRIERS)
+RFX_ID_MAPPING(RIL_REQUEST_GET_ALLOWED_CARRIERS, RFX_MSG_REQUEST_GET_ALLOWED_CARRIERS)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_SIM_STATUS_CHANGED, RFX_MSG_URC_RESPONSE_SIM_STATUS_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_SIM_COMMON_SLOT_NO_CHANGED, RFX_MSG_URC_SIM_COMMON_SLOT_NO_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_TRAY_PLUG_IN, RFX_MSG_URC_TRAY_PLUG_IN)
+RFX_ID_MAPPING(RIL_UNSOL_SIM_PLUG_OUT, RFX_MSG_URC_SIM_PLUG_OUT)
+RFX_ID_MAPPING(RIL_UNSOL_SIM_PLUG_IN, RFX_MSG_URC_SIM_PLUG_IN)
+RFX_ID_MAPPING(RIL_UNSOL_UICC_SUBSCRIPTION_STATUS_CHANGED,
+               RFX_MSG_URC_UICC_SUBSCRIPTION_STATUS_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_SIM_MISSING, RFX_MSG_URC_SIM_MISSING)
+RFX_ID_MAPPING(RIL_UNSOL_SIM_RECOVERY, RFX_MSG_URC_SIM_RECOVERY)
+RFX_ID_MAPPING(RIL_UNSOL_VIRTUAL_SIM_ON, RFX_MSG_URC_SIM_VIRTUAL_SIM_ON)
+RFX_ID_MAPPING(RIL_UNSOL_VIRTUAL_SIM_OFF, RFX_MSG_URC_SIM_VIRTUAL_SIM_OFF)
+RFX_ID_MAPPING(RIL_UNSOL_IMEI_LOCK, RFX_MSG_URC_SIM_IMEI_LOCK)
+RFX_ID_MAPPING(RIL_UNSOL_CARD_DETECTED_IND, RFX_MSG_URC_CARD_DETECTED_IND)
+// External SIM [Start]
+RFX_ID_MAPPING(RIL_UNSOL_VSIM_OPERATION_INDICATION, RFX_MSG_URC_SIM_VSIM_OPERATION_INDICATION)
+RFX_ID_MAPPING(RIL_REQUEST_VSIM_NOTIFICATION, RFX_MSG_REQUEST_SIM_VSIM_NOTIFICATION)
+RFX_ID_MAPPING(RIL_REQUEST_VSIM_OPERATION, RFX_MSG_REQUEST_SIM_VSIM_OPERATION)
+// External SIM [End]
+// ESIM Start
+RFX_ID_MAPPING(RIL_REQUEST_GET_SLOT_STATUS, RFX_MSG_REQUEST_GET_SLOT_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_SET_LOGICAL_TO_PHYSICAL_SLOT_MAPPING,
+               RFX_MSG_REQUEST_SET_LOGICAL_TO_PHYSICAL_SLOT_MAPPING)
+RFX_ID_MAPPING(RIL_UNSOL_ICC_SLOT_STATUS, RFX_MSG_URC_ICC_SLOT_STATUS)
+// ESIM End
+// SIM switch part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_SET_RADIO_CAPABILITY, RFX_MSG_REQUEST_SET_RADIO_CAPABILITY)
+RFX_ID_MAPPING(RIL_REQUEST_GET_RADIO_CAPABILITY, RFX_MSG_REQUEST_GET_RADIO_CAPABILITY)
+RFX_ID_MAPPING(RIL_REQUEST_GET_IMEI, RFX_MSG_REQUEST_GET_IMEI)
+RFX_ID_MAPPING(RIL_REQUEST_GET_IMEISV, RFX_MSG_REQUEST_GET_IMEISV)
+// SIM switch part -- End
+//  eMBMS
+RFX_ID_MAPPING(RIL_REQUEST_EMBMS_AT_CMD, RFX_MSG_REQUEST_EMBMS_AT_CMD)
+// eMBMS -- End
+// NW part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_SIGNAL_STRENGTH, RFX_MSG_REQUEST_SIGNAL_STRENGTH)
+RFX_ID_MAPPING(RIL_REQUEST_VOICE_REGISTRATION_STATE, RFX_MSG_REQUEST_VOICE_REGISTRATION_STATE)
+RFX_ID_MAPPING(RIL_REQUEST_DATA_REGISTRATION_STATE, RFX_MSG_REQUEST_DATA_REGISTRATION_STATE)
+RFX_ID_MAPPING(RIL_REQUEST_OPERATOR, RFX_MSG_REQUEST_OPERATOR)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_NETWORK_SELECTION_MODE,
+               RFX_MSG_REQUEST_QUERY_NETWORK_SELECTION_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_NETWORK_SELECTION_AUTOMATIC,
+               RFX_MSG_REQUEST_SET_NETWORK_SELECTION_AUTOMATIC)
+RFX_ID_MAPPING(RIL_REQUEST_SET_NETWORK_SELECTION_MANUAL,
+               RFX_MSG_REQUEST_SET_NETWORK_SELECTION_MANUAL)
+RFX_ID_MAPPING(RIL_REQUEST_SET_NETWORK_SELECTION_MANUAL_WITH_ACT,
+               RFX_MSG_REQUEST_SET_NETWORK_SELECTION_MANUAL_WITH_ACT)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_AVAILABLE_NETWORKS, RFX_MSG_REQUEST_QUERY_AVAILABLE_NETWORKS)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_AVAILABLE_NETWORKS_WITH_ACT,
+               RFX_MSG_REQUEST_QUERY_AVAILABLE_NETWORKS_WITH_ACT)
+RFX_ID_MAPPING(RIL_REQUEST_ABORT_QUERY_AVAILABLE_NETWORKS,
+               RFX_MSG_REQUEST_ABORT_QUERY_AVAILABLE_NETWORKS)
+RFX_ID_MAPPING(RIL_REQUEST_SIGNAL_STRENGTH_WITH_WCDMA_ECIO,
+               RFX_MSG_REQUEST_SIGNAL_STRENGTH_WITH_WCDMA_ECIO)
+RFX_ID_MAPPING(RIL_REQUEST_SET_BAND_MODE, RFX_MSG_REQUEST_SET_BAND_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_AVAILABLE_BAND_MODE, RFX_MSG_REQUEST_QUERY_AVAILABLE_BAND_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_PREFERRED_NETWORK_TYPE, RFX_MSG_REQUEST_SET_PREFERRED_NETWORK_TYPE)
+RFX_ID_MAPPING(RIL_REQUEST_GET_PREFERRED_NETWORK_TYPE, RFX_MSG_REQUEST_GET_PREFERRED_NETWORK_TYPE)
+RFX_ID_MAPPING(RIL_REQUEST_GET_NEIGHBORING_CELL_IDS, RFX_MSG_REQUEST_GET_NEIGHBORING_CELL_IDS)
+RFX_ID_MAPPING(RIL_REQUEST_SET_LOCATION_UPDATES, RFX_MSG_REQUEST_SET_LOCATION_UPDATES)
+RFX_ID_MAPPING(RIL_REQUEST_VOICE_RADIO_TECH, RFX_MSG_REQUEST_VOICE_RADIO_TECH)
+RFX_ID_MAPPING(RIL_REQUEST_GET_CELL_INFO_LIST, RFX_MSG_REQUEST_GET_CELL_INFO_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_SET_UNSOL_CELL_INFO_LIST_RATE,
+               RFX_MSG_REQUEST_SET_UNSOL_CELL_INFO_LIST_RATE)
+RFX_ID_MAPPING(RIL_REQUEST_GET_POL_CAPABILITY, RFX_MSG_REQUEST_GET_POL_CAPABILITY)
+RFX_ID_MAPPING(RIL_REQUEST_GET_POL_LIST, RFX_MSG_REQUEST_GET_POL_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_SET_POL_ENTRY, RFX_MSG_REQUEST_SET_POL_ENTRY)
+RFX_ID_MAPPING(RIL_REQUEST_GET_FEMTOCELL_LIST, RFX_MSG_REQUEST_GET_FEMTOCELL_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_ABORT_FEMTOCELL_LIST, RFX_MSG_REQUEST_ABORT_FEMTOCELL_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_SELECT_FEMTOCELL, RFX_MSG_REQUEST_SELECT_FEMTOCELL)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_SET_ROAMING_PREFERENCE, RFX_MSG_REQUEST_CDMA_SET_ROAMING_PREFERENCE)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_QUERY_ROAMING_PREFERENCE,
+               RFX_MSG_REQUEST_CDMA_QUERY_ROAMING_PREFERENCE)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_FEMTOCELL_SYSTEM_SELECTION_MODE,
+               RFX_MSG_REQUEST_QUERY_FEMTOCELL_SYSTEM_SELECTION_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_FEMTOCELL_SYSTEM_SELECTION_MODE,
+               RFX_MSG_REQUEST_SET_FEMTOCELL_SYSTEM_SELECTION_MODE)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_VOICE_NETWORK_STATE_CHANGED,
+               RFX_MSG_URC_RESPONSE_VOICE_NETWORK_STATE_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_NITZ_TIME_RECEIVED, RFX_MSG_URC_NITZ_TIME_RECEIVED)
+RFX_ID_MAPPING(RIL_UNSOL_SIGNAL_STRENGTH, RFX_MSG_URC_SIGNAL_STRENGTH)
+RFX_ID_MAPPING(RIL_UNSOL_SIGNAL_STRENGTH_WITH_WCDMA_ECIO,
+               RFX_MSG_URC_SIGNAL_STRENGTH_WITH_WCDMA_ECIO)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_PS_NETWORK_STATE_CHANGED,
+               RFX_MSG_URC_RESPONSE_PS_NETWORK_STATE_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_CS_NETWORK_STATE_CHANGED,
+               RFX_MSG_URC_RESPONSE_CS_NETWORK_STATE_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_RESTRICTED_STATE_CHANGED, RFX_MSG_URC_RESTRICTED_STATE_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_CDMA_OTA_PROVISION_STATUS, RFX_MSG_URC_CDMA_OTA_PROVISION_STATUS)
+RFX_ID_MAPPING(RIL_UNSOL_CDMA_PRL_CHANGED, RFX_MSG_URC_CDMA_PRL_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_CELL_INFO_LIST, RFX_MSG_URC_CELL_INFO_LIST)
+RFX_ID_MAPPING(RIL_UNSOL_VOICE_RADIO_TECH_CHANGED, RFX_MSG_URC_VOICE_RADIO_TECH_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_NETWORK_INFO, RFX_MSG_URC_NETWORK_INFO)
+RFX_ID_MAPPING(RIL_UNSOL_FEMTOCELL_INFO, RFX_MSG_URC_FEMTOCELL_INFO)
+RFX_ID_MAPPING(RIL_UNSOL_GMSS_RAT_CHANGED, RFX_MSG_URC_GMSS_RAT_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_NETWORK_EVENT, RFX_MSG_URC_NETWORK_EVENT)
+RFX_ID_TO_MSG_ID(RIL_UNSOL_MODULATION_INFO, RFX_MSG_URC_MODULATION_INFO)
+RFX_ID_MAPPING(RIL_UNSOL_NETWORK_SCAN_RESULT, RFX_MSG_URC_NETWORK_SCAN_RESULT)
+RFX_ID_MAPPING(RIL_REQUEST_SET_PSEUDO_CELL_MODE, RFX_MSG_REQUEST_SET_PSEUDO_CELL_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_GET_PSEUDO_CELL_INFO, RFX_MSG_REQUEST_GET_PSEUDO_CELL_INFO)
+RFX_ID_MAPPING(RIL_REQUEST_START_NETWORK_SCAN, RFX_MSG_RIL_REQUEST_START_NETWORK_SCAN)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SIGNAL_STRENGTH_REPORTING_CRITERIA,
+               RFX_MSG_REQUEST_SET_SIGNAL_STRENGTH_REPORTING_CRITERIA)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SYSTEM_SELECTION_CHANNELS,
+               RFX_MSG_REQUEST_SET_SYSTEM_SELECTION_CHANNELS)
+RFX_ID_MAPPING(RIL_REQUEST_STOP_NETWORK_SCAN, RFX_MSG_RIL_REQUEST_STOP_NETWORK_SCAN)
+RFX_ID_MAPPING(RIL_REQUEST_SET_UNSOLICITED_RESPONSE_FILTER,
+               RFX_MSG_REQUEST_SET_UNSOLICITED_RESPONSE_FILTER)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SERVICE_STATE, RFX_MSG_REQUEST_SET_SERVICE_STATE)
+RFX_ID_MAPPING(RIL_UNSOL_LTE_NETWORK_INFO, RFX_MSG_URC_LTE_NETWORK_INFO)
+RFX_ID_MAPPING(RIL_UNSOL_PHYSICAL_CHANNEL_CONFIGS_MTK, RFX_MSG_URC_PHYSICAL_CHANNEL_CONFIGS_MTK)
+RFX_ID_MAPPING(RIL_REQUEST_SET_LTE_RELEASE_VERSION, RFX_MSG_REQUEST_SET_LTE_RELEASE_VERSION)
+RFX_ID_MAPPING(RIL_REQUEST_GET_LTE_RELEASE_VERSION, RFX_MSG_REQUEST_GET_LTE_RELEASE_VERSION)
+RFX_ID_MAPPING(RIL_UNSOL_MCCMNC_CHANGED, RFX_MSG_URC_MCCMNC_CHANGED)
+RFX_ID_MAPPING(RIL_REQUEST_GET_TS25_NAME, RFX_MSG_REQUEST_GET_TS25_NAME)
+RFX_ID_MAPPING(RIL_REQUEST_ENABLE_CA_PLUS_FILTER, RFX_MSG_REQUEST_ENABLE_CA_PLUS_FILTER)
+RFX_ID_MAPPING(RIL_REQUEST_GET_SUGGESTED_PLMN_LIST, RFX_MSG_REQUEST_GET_SUGGESTED_PLMN_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_CONFIG_A2_OFFSET, RFX_MSG_REQUEST_CONFIG_A2_OFFSET)
+RFX_ID_MAPPING(RIL_REQUEST_CONFIG_B1_OFFSET, RFX_MSG_REQUEST_CONFIG_B1_OFFSET)
+RFX_ID_MAPPING(RIL_REQUEST_ENABLE_SCG_FAILURE, RFX_MSG_REQUEST_ENABLE_SCG_FAILURE)
+RFX_ID_MAPPING(RIL_REQUEST_DISABLE_NR, RFX_MSG_REQUEST_DISABLE_NR)
+RFX_ID_MAPPING(RIL_REQUEST_SET_TX_POWER, RFX_MSG_REQUEST_SET_TX_POWER)
+RFX_ID_MAPPING(RIL_REQUEST_SEARCH_STORED_FREQUENCY_INFO,
+               RFX_MSG_REQUEST_SEARCH_STORED_FREQUENCY_INFO)
+RFX_ID_MAPPING(RIL_REQUEST_SEARCH_RAT, RFX_MSG_REQUEST_SEARCH_RAT)
+RFX_ID_MAPPING(RIL_REQUEST_SET_BACKGROUND_SEARCH_TIMER, RFX_MSG_REQUEST_SET_BACKGROUND_SEARCH_TIMER)
+// NW part -- End
+// CC part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_GET_CURRENT_CALLS, RFX_MSG_REQUEST_GET_CURRENT_CALLS)
+RFX_ID_MAPPING(RIL_REQUEST_DIAL, RFX_MSG_REQUEST_DIAL)
+RFX_ID_MAPPING(RIL_REQUEST_EMERGENCY_DIAL, RFX_MSG_REQUEST_EMERGENCY_DIAL)
+RFX_ID_MAPPING(RIL_REQUEST_HANGUP, RFX_MSG_REQUEST_HANGUP)
+RFX_ID_MAPPING(RIL_REQUEST_HANGUP_WAITING_OR_BACKGROUND,
+               RFX_MSG_REQUEST_HANGUP_WAITING_OR_BACKGROUND)
+RFX_ID_MAPPING(RIL_REQUEST_HANGUP_FOREGROUND_RESUME_BACKGROUND,
+               RFX_MSG_REQUEST_HANGUP_FOREGROUND_RESUME_BACKGROUND)
+RFX_ID_MAPPING(RIL_REQUEST_SWITCH_WAITING_OR_HOLDING_AND_ACTIVE,
+               RFX_MSG_REQUEST_SWITCH_WAITING_OR_HOLDING_AND_ACTIVE)
+RFX_ID_MAPPING(RIL_REQUEST_CONFERENCE, RFX_MSG_REQUEST_CONFERENCE)
+RFX_ID_MAPPING(RIL_REQUEST_UDUB, RFX_MSG_REQUEST_UDUB)
+RFX_ID_MAPPING(RIL_REQUEST_LAST_CALL_FAIL_CAUSE, RFX_MSG_REQUEST_LAST_CALL_FAIL_CAUSE)
+RFX_ID_MAPPING(RIL_REQUEST_DTMF, RFX_MSG_REQUEST_DTMF)
+RFX_ID_MAPPING(RIL_REQUEST_ANSWER, RFX_MSG_REQUEST_ANSWER)
+RFX_ID_MAPPING(RIL_REQUEST_DTMF_START, RFX_MSG_REQUEST_DTMF_START)
+RFX_ID_MAPPING(RIL_REQUEST_DTMF_STOP, RFX_MSG_REQUEST_DTMF_STOP)
+RFX_ID_MAPPING(RIL_REQUEST_SEPARATE_CONNECTION, RFX_MSG_REQUEST_SEPARATE_CONNECTION)
+RFX_ID_MAPPING(RIL_REQUEST_SET_MUTE, RFX_MSG_REQUEST_SET_MUTE)
+RFX_ID_MAPPING(RIL_REQUEST_GET_MUTE, RFX_MSG_REQUEST_GET_MUTE)
+RFX_ID_MAPPING(RIL_REQUEST_EXPLICIT_CALL_TRANSFER, RFX_MSG_REQUEST_EXPLICIT_CALL_TRANSFER)
+RFX_ID_MAPPING(RIL_REQUEST_SET_TTY_MODE, RFX_MSG_REQUEST_SET_TTY_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_TTY_MODE, RFX_MSG_REQUEST_QUERY_TTY_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_HANGUP_ALL, RFX_MSG_REQUEST_HANGUP_ALL)
+RFX_ID_MAPPING(RIL_REQUEST_SET_CALL_INDICATION, RFX_MSG_REQUEST_SET_CALL_INDICATION)
+RFX_ID_MAPPING(RIL_REQUEST_SET_ECC_MODE, RFX_MSG_REQUEST_SET_ECC_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_ECC_PREFERRED_RAT, RFX_MSG_REQUEST_ECC_PREFERRED_RAT)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_VT_DIAL, RFX_MSG_REQUEST_IMS_VT_DIAL)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_EMERGENCY_DIAL, RFX_MSG_REQUEST_IMS_EMERGENCY_DIAL)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_DIAL, RFX_MSG_REQUEST_IMS_DIAL)
+RFX_ID_MAPPING(RIL_REQUEST_SET_VOICE_DOMAIN_PREFERENCE, RFX_MSG_REQUEST_SET_VOICE_DOMAIN_PREFERENCE)
+RFX_ID_MAPPING(RIL_REQUEST_GET_VOICE_DOMAIN_PREFERENCE, RFX_MSG_REQUEST_GET_VOICE_DOMAIN_PREFERENCE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_ECC_NUM, RFX_MSG_REQUEST_SET_ECC_NUM)
+RFX_ID_MAPPING(RIL_REQUEST_GET_ECC_NUM, RFX_MSG_REQUEST_GET_ECC_NUM)
+RFX_ID_MAPPING(RIL_UNSOL_ECC_NUM, RFX_MSG_UNSOL_ECC_NUM)
+RFX_ID_MAPPING(RIL_REQUEST_HANGUP_WITH_REASON, RFX_MSG_REQUEST_HANGUP_WITH_REASON)
+// CC part -- End
+// common start
+RFX_ID_MAPPING(RIL_REQUEST_BASEBAND_VERSION, RFX_MSG_REQUEST_BASEBAND_VERSION)
+RFX_ID_MAPPING(RIL_REQUEST_OEM_HOOK_RAW, RFX_MSG_REQUEST_OEM_HOOK_RAW)
+RFX_ID_MAPPING(RIL_REQUEST_OEM_HOOK_STRINGS, RFX_MSG_REQUEST_OEM_HOOK_STRINGS)
+RFX_ID_MAPPING(RIL_REQUEST_DEVICE_IDENTITY, RFX_MSG_REQUEST_DEVICE_IDENTITY)
+RFX_ID_MAPPING(RIL_REQUEST_GET_HARDWARE_CONFIG, RFX_MSG_REQUEST_GET_HARDWARE_CONFIG)
+RFX_ID_MAPPING(RIL_REQUEST_GET_ACTIVITY_INFO, RFX_MSG_REQUEST_GET_ACTIVITY_INFO)
+RFX_ID_MAPPING(RIL_REQUEST_SET_TRM, RFX_MSG_REQUEST_SET_TRM)
+RFX_ID_MAPPING(RIL_REQUEST_ENABLE_DSDA_INDICATION, RFX_MSG_REQUEST_ENABLE_DSDA_INDICATION)
+RFX_ID_MAPPING(RIL_REQUEST_GET_DSDA_STATUS, RFX_MSG_REQUEST_GET_DSDA_STATUS)
+RFX_ID_MAPPING(RIL_UNSOL_ON_DSDA_CHANGED, RFX_MSG_UNSOL_ON_DSDA_CHANGED)
+// radio start
+RFX_ID_MAPPING(RIL_REQUEST_RADIO_POWER, RFX_MSG_REQUEST_RADIO_POWER)
+RFX_ID_MAPPING(RIL_REQUEST_RESET_RADIO, RFX_MSG_REQUEST_RESET_RADIO)
+RFX_ID_MAPPING(RIL_REQUEST_RESTART_RILD, RFX_MSG_REQUEST_RESTART_RILD)
+RFX_ID_MAPPING(RIL_REQUEST_SHUTDOWN, RFX_MSG_REQUEST_SHUTDOWN)
+RFX_ID_MAPPING(RIL_REQUEST_MODEM_POWEROFF, RFX_MSG_REQUEST_MODEM_POWEROFF)
+RFX_ID_MAPPING(RIL_REQUEST_MODEM_POWERON, RFX_MSG_REQUEST_MODEM_POWERON)
+// radio end
+// Data part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_ALLOW_DATA, RFX_MSG_REQUEST_ALLOW_DATA)
+RFX_ID_MAPPING(RIL_REQUEST_SETUP_DATA_CALL, RFX_MSG_REQUEST_SETUP_DATA_CALL)
+RFX_ID_MAPPING(RIL_REQUEST_DEACTIVATE_DATA_CALL, RFX_MSG_REQUEST_DEACTIVATE_DATA_CALL)
+RFX_ID_MAPPING(RIL_REQUEST_DATA_CALL_LIST, RFX_MSG_REQUEST_DATA_CALL_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_LAST_DATA_CALL_FAIL_CAUSE, RFX_MSG_REQUEST_LAST_DATA_CALL_FAIL_CAUSE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_DATA_PROFILE, RFX_MSG_REQUEST_SET_DATA_PROFILE)
+RFX_ID_MAPPING(RIL_REQUEST_SYNC_DATA_SETTINGS_TO_MD, RFX_MSG_REQUEST_SYNC_DATA_SETTINGS_TO_MD)
+RFX_ID_MAPPING(RIL_REQUEST_RESET_MD_DATA_RETRY_COUNT, RFX_MSG_REQUEST_RESET_MD_DATA_RETRY_COUNT)
+RFX_ID_MAPPING(RIL_REQUEST_SET_INITIAL_ATTACH_APN, RFX_MSG_REQUEST_SET_INITIAL_ATTACH_APN)
+RFX_ID_MAPPING(RIL_UNSOL_PCO_DATA, RFX_MSG_UNSOL_PCO_DATA)
+RFX_ID_MAPPING(RIL_UNSOL_PCO_DATA_AFTER_ATTACHED, RFX_MSG_UNSOL_PCO_DATA_AFTER_ATTACHED)
+RFX_ID_MAPPING(RIL_UNSOL_MODEM_RESTART, RFX_MSG_UNSOL_MODEM_RESTART)
+RFX_ID_MAPPING(RIL_REQUEST_START_LCE, RFX_MSG_REQUEST_START_LCE)
+RFX_ID_MAPPING(RIL_REQUEST_STOP_LCE, RFX_MSG_REQUEST_STOP_LCE)
+RFX_ID_MAPPING(RIL_REQUEST_PULL_LCEDATA, RFX_MSG_REQUEST_PULL_LCEDATA)
+RFX_ID_MAPPING(RIL_REQUEST_SET_LTE_ACCESS_STRATUM_REPORT,
+               RFX_MSG_REQUEST_SET_LTE_ACCESS_STRATUM_REPORT)
+RFX_ID_MAPPING(RIL_REQUEST_SET_LTE_UPLINK_DATA_TRANSFER,
+               RFX_MSG_REQUEST_SET_LTE_UPLINK_DATA_TRANSFER)
+RFX_ID_MAPPING(RIL_REQUEST_SET_FD_MODE, RFX_MSG_REQUEST_SET_FD_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_LINK_CAPACITY_REPORTING_CRITERIA,
+               RFX_MSG_REQUEST_SET_LINK_CAPACITY_REPORTING_CRITERIA)
+RFX_ID_MAPPING(RIL_REQUEST_SET_PREFERRED_DATA_MODEM, RFX_MSG_REQUEST_SET_PREFERRED_DATA_MODEM)
+RFX_ID_MAPPING(RIL_UNSOL_NETWORK_REJECT_CAUSE, RFX_MSG_URC_NETWORK_REJECT_CAUSE)
+RFX_ID_MAPPING(RIL_UNSOL_QUALIFIED_NETWORK_TYPES_CHANGED,
+               RFX_MSG_URC_QUALIFIED_NETWORK_TYPES_CHANGED)
+RFX_ID_MAPPING(RIL_REQUEST_START_KEEPALIVE, RFX_MSG_REQUEST_START_KEEPALIVE)
+RFX_ID_MAPPING(RIL_REQUEST_STOP_KEEPALIVE, RFX_MSG_REQUEST_STOP_KEEPALIVE)
+// Data part -- End
+// SMS part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_SEND_SMS, RFX_MSG_REQUEST_SEND_SMS)
+RFX_ID_MAPPING(RIL_REQUEST_SEND_SMS_EXPECT_MORE, RFX_MSG_REQUEST_SEND_SMS_EXPECT_MORE)
+RFX_ID_MAPPING(RIL_REQUEST_ACKNOWLEDGE_INCOMING_GSM_SMS_WITH_PDU,
+               RFX_MSG_REQUEST_ACKNOWLEDGE_INCOMING_GSM_SMS_WITH_PDU)
+RFX_ID_MAPPING(RIL_REQUEST_WRITE_SMS_TO_SIM, RFX_MSG_REQUEST_WRITE_SMS_TO_SIM)
+RFX_ID_MAPPING(RIL_REQUEST_DELETE_SMS_ON_SIM, RFX_MSG_REQUEST_DELETE_SMS_ON_SIM)
+RFX_ID_MAPPING(RIL_REQUEST_GSM_SET_BROADCAST_SMS_CONFIG,
+               RFX_MSG_REQUEST_GSM_SET_BROADCAST_SMS_CONFIG)
+RFX_ID_MAPPING(RIL_REQUEST_REPORT_SMS_MEMORY_STATUS, RFX_MSG_REQUEST_REPORT_SMS_MEMORY_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_GET_SMS_SIM_MEM_STATUS, RFX_MSG_REQUEST_GET_SMS_SIM_MEM_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_SMS_ACKNOWLEDGE, RFX_MSG_REQUEST_SMS_ACKNOWLEDGE)
+RFX_ID_MAPPING(RIL_REQUEST_GSM_GET_BROADCAST_SMS_CONFIG,
+               RFX_MSG_REQUEST_GSM_GET_BROADCAST_SMS_CONFIG)
+RFX_ID_MAPPING(RIL_REQUEST_GET_SMSC_ADDRESS, RFX_MSG_REQUEST_GET_SMSC_ADDRESS)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SMSC_ADDRESS, RFX_MSG_REQUEST_SET_SMSC_ADDRESS)
+RFX_ID_MAPPING(RIL_REQUEST_GET_SMS_PARAMS, RFX_MSG_REQUEST_GET_SMS_PARAMS)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SMS_PARAMS, RFX_MSG_REQUEST_SET_SMS_PARAMS)
+RFX_ID_MAPPING(RIL_REQUEST_GSM_GET_BROADCAST_LANGUAGE, RFX_MSG_REQUEST_GSM_GET_BROADCAST_LANGUAGE)
+RFX_ID_MAPPING(RIL_REQUEST_GSM_SET_BROADCAST_LANGUAGE, RFX_MSG_REQUEST_GSM_SET_BROADCAST_LANGUAGE)
+RFX_ID_MAPPING(RIL_REQUEST_GSM_SMS_BROADCAST_ACTIVATION,
+               RFX_MSG_REQUEST_GSM_SMS_BROADCAST_ACTIVATION)
+RFX_ID_MAPPING(RIL_REQUEST_SET_ETWS, RFX_MSG_REQUEST_SET_ETWS)
+RFX_ID_MAPPING(RIL_REQUEST_REMOVE_CB_MESSAGE, RFX_MSG_REQUEST_REMOVE_CB_MESSAGE)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_SEND_SMS, RFX_MSG_REQUEST_IMS_SEND_SMS)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_SEND_SMS_EX, RFX_MSG_REQUEST_IMS_SEND_SMS_EX)
+RFX_ID_MAPPING(RIL_REQUEST_SMS_ACKNOWLEDGE_EX, RFX_MSG_REQUEST_SMS_ACKNOWLEDGE_EX)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SMS_FWK_READY, RFX_MSG_REQUEST_SET_SMS_FWK_READY)
+RFX_ID_MAPPING(RIL_REQUEST_GET_GSM_SMS_BROADCAST_ACTIVATION,
+               RFX_MSG_REQUEST_GET_GSM_SMS_BROADCAST_ACTIVATION)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_NEW_SMS, RFX_MSG_URC_RESPONSE_NEW_SMS)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_NEW_BROADCAST_SMS, RFX_MSG_URC_RESPONSE_NEW_BROADCAST_SMS)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_ETWS_NOTIFICATION, RFX_MSG_URC_RESPONSE_ETWS_NOTIFICATION)
+RFX_ID_MAPPING(RIL_UNSOL_SMS_READY_NOTIFICATION, RFX_MSG_URC_SMS_READY_NOTIFICATION)
+RFX_ID_MAPPING(RIL_UNSOL_SIM_SMS_STORAGE_FULL, RFX_MSG_URC_SIM_SMS_STORAGE_FULL)
+RFX_ID_MAPPING(RIL_UNSOL_ME_SMS_STORAGE_FULL, RFX_MSG_URC_ME_SMS_STORAGE_FULL)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_NEW_SMS_ON_SIM, RFX_MSG_URC_RESPONSE_NEW_SMS_ON_SIM)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_NEW_SMS_STATUS_REPORT, RFX_MSG_URC_RESPONSE_NEW_SMS_STATUS_REPORT)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_SEND_SMS, RFX_MSG_REQUEST_CDMA_SEND_SMS)
+RFX_ID_TO_MSG_ID(RIL_REQUEST_CDMA_SMS_ACKNOWLEDGE, RFX_MSG_REQUEST_CDMA_SMS_ACKNOWLEDGE)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_SMS_ACKNOWLEDGE_EX, RFX_MSG_REQUEST_CDMA_SMS_ACKNOWLEDGE_EX)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_SMS_BROADCAST_ACTIVATION,
+               RFX_MSG_REQUEST_CDMA_SMS_BROADCAST_ACTIVATION)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_DELETE_SMS_ON_RUIM, RFX_MSG_REQUEST_CDMA_DELETE_SMS_ON_RUIM)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_WRITE_SMS_TO_RUIM, RFX_MSG_REQUEST_CDMA_WRITE_SMS_TO_RUIM)
+RFX_ID_MAPPING(RIL_REQUEST_GET_SMS_RUIM_MEM_STATUS, RFX_MSG_REQUEST_GET_SMS_RUIM_MEM_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_GET_BROADCAST_SMS_CONFIG,
+               RFX_MSG_REQUEST_CDMA_GET_BROADCAST_SMS_CONFIG)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_SET_BROADCAST_SMS_CONFIG,
+               RFX_MSG_REQUEST_CDMA_SET_BROADCAST_SMS_CONFIG)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_NEW_SMS_STATUS_REPORT_EX,
+               RFX_MSG_URC_RESPONSE_NEW_SMS_STATUS_REPORT_EX)
+RFX_ID_MAPPING(RIL_UNSOL_RESPONSE_NEW_SMS_EX, RFX_MSG_URC_RESPONSE_NEW_SMS_EX)
+// SMS part -- End
+// IMS part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_SET_VOLTE_ENABLE, RFX_MSG_REQUEST_SET_VOLTE_ENABLE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_WFC_ENABLE, RFX_MSG_REQUEST_SET_WFC_ENABLE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_VILTE_ENABLE, RFX_MSG_REQUEST_SET_VILTE_ENABLE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_VIWIFI_ENABLE, RFX_MSG_REQUEST_SET_VIWIFI_ENABLE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_IMSCFG, RFX_MSG_REQUEST_SET_IMSCFG)
+RFX_ID_MAPPING(RIL_REQUEST_SET_MD_IMSCFG, RFX_MSG_REQUEST_SET_MD_IMSCFG)
+RFX_ID_MAPPING(RIL_REQUEST_GET_PROVISION_VALUE, RFX_MSG_REQUEST_GET_PROVISION_VALUE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_PROVISION_VALUE, RFX_MSG_REQUEST_SET_PROVISION_VALUE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_WFC_PROFILE, RFX_MSG_REQUEST_SET_WFC_PROFILE)
+// IMS config telephonyware START
+RFX_ID_MAPPING(RIL_REQUEST_IMS_CONFIG_SET_FEATURE, RFX_MSG_REQUEST_IMS_CONFIG_SET_FEATURE)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_CONFIG_GET_FEATURE, RFX_MSG_REQUEST_IMS_CONFIG_GET_FEATURE)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_CONFIG_SET_PROVISION, RFX_MSG_REQUEST_IMS_CONFIG_SET_PROVISION)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_CONFIG_GET_PROVISION, RFX_MSG_REQUEST_IMS_CONFIG_GET_PROVISION)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_CONFIG_GET_RESOURCE_CAP, RFX_MSG_REQUEST_IMS_CONFIG_GET_RESOURCE_CAP)
+RFX_ID_MAPPING(RIL_UNSOL_IMS_CONFIG_DYNAMIC_IMS_SWITCH_COMPLETE,
+               RFX_MSG_UNSOL_IMS_CONFIG_DYNAMIC_IMS_SWITCH_COMPLETE)
+RFX_ID_MAPPING(RIL_UNSOL_IMS_CONFIG_FEATURE_CHANGED, RFX_MSG_UNSOL_IMS_CONFIG_FEATURE_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_IMS_CONFIG_CONFIG_CHANGED, RFX_MSG_UNSOL_IMS_CONFIG_CONFIG_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_IMS_CONFIG_CONFIG_LOADED, RFX_MSG_UNSOL_IMS_CONFIG_CONFIG_LOADED)
+// IMS config telephonyware END
+RFX_ID_MAPPING(RIL_REQUEST_CONFERENCE_DIAL, RFX_MSG_REQUEST_CONFERENCE_DIAL)
+RFX_ID_MAPPING(RIL_REQUEST_DIAL_WITH_SIP_URI, RFX_MSG_REQUEST_DIAL_WITH_SIP_URI)
+RFX_ID_MAPPING(RIL_REQUEST_VT_DIAL_WITH_SIP_URI, RFX_MSG_REQUEST_VT_DIAL_WITH_SIP_URI)
+RFX_ID_MAPPING(RIL_REQUEST_HOLD_CALL, RFX_MSG_REQUEST_HOLD_CALL)
+RFX_ID_MAPPING(RIL_REQUEST_RESUME_CALL, RFX_MSG_REQUEST_RESUME_CALL)
+RFX_ID_MAPPING(RIL_REQUEST_ADD_IMS_CONFERENCE_CALL_MEMBER,
+               RFX_MSG_REQUEST_ADD_IMS_CONFERENCE_CALL_MEMBER)
+RFX_ID_MAPPING(RIL_REQUEST_REMOVE_IMS_CONFERENCE_CALL_MEMBER,
+               RFX_MSG_REQUEST_REMOVE_IMS_CONFERENCE_CALL_MEMBER)
+RFX_ID_MAPPING(RIL_REQUEST_VIDEO_CALL_ACCEPT, RFX_MSG_REQUEST_VIDEO_CALL_ACCEPT)
+RFX_ID_MAPPING(RIL_REQUEST_ECC_REDIAL_APPROVE, RFX_MSG_REQUEST_ECC_REDIAL_APPROVE)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_ECT, RFX_MSG_REQUEST_IMS_ECT)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_REGISTRATION_STATE, RFX_MSG_REQUEST_IMS_REGISTRATION_STATE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_IMS_ENABLE, RFX_MSG_REQUEST_SET_IMS_ENABLE)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_DEREG_NOTIFICATION, RFX_MSG_REQUEST_IMS_DEREG_NOTIFICATION)
+RFX_ID_MAPPING(RIL_REQUEST_SET_IMS_REGISTRATION_REPORT, RFX_MSG_REQUEST_SET_IMS_REGISTRATION_REPORT)
+RFX_ID_MAPPING(RIL_REQUEST_PULL_CALL, RFX_MSG_REQUEST_PULL_CALL)
+RFX_ID_MAPPING(RIL_REQUEST_SET_IMS_RTP_REPORT, RFX_MSG_REQUEST_SET_IMS_RTP_REPORT)
+RFX_ID_MAPPING(RIL_UNSOL_IMS_RTP_INFO, RFX_MSG_UNSOL_IMS_RTP_INFO)
+RFX_ID_MAPPING(RIL_UNSOL_VOPS_INDICATION, RFX_MSG_UNSOL_VOPS_INDICATION)  // Voice over PS
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_VOPS_STATUS, RFX_MSG_REQUEST_QUERY_VOPS_STATUS)
+RFX_ID_MAPPING(RIL_UNSOL_SIP_REG_INFO, RFX_MSG_UNSOL_SIP_REG_INFO)
+RFX_ID_MAPPING(RIL_UNSOL_IMS_REGISTRATION_STATE_IND, RFX_MSG_UNSOL_IMS_REGISTRATION_STATE_IND)
+RFX_ID_MAPPING(RIL_UNSOL_EIREG_INFO_IND, RFX_MSG_UNSOL_EIREG_INFO_IND)
+// IMS part -- End
+RFX_ID_MAPPING(RIL_REQUEST_MODIFY_MODEM_TYPE, RFX_MSG_REQUEST_WORLD_MODE_MODIFY_MODEM_TYPE)
+// PHB Part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_PHB_STORAGE_INFO, RFX_MSG_REQUEST_QUERY_PHB_STORAGE_INFO)
+RFX_ID_MAPPING(RIL_REQUEST_WRITE_PHB_ENTRY, RFX_MSG_REQUEST_WRITE_PHB_ENTRY)
+RFX_ID_MAPPING(RIL_REQUEST_READ_PHB_ENTRY, RFX_MSG_REQUEST_READ_PHB_ENTRY)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_UPB_CAPABILITY, RFX_MSG_REQUEST_QUERY_UPB_CAPABILITY)
+RFX_ID_MAPPING(RIL_REQUEST_EDIT_UPB_ENTRY, RFX_MSG_REQUEST_EDIT_UPB_ENTRY)
+RFX_ID_MAPPING(RIL_REQUEST_DELETE_UPB_ENTRY, RFX_MSG_REQUEST_DELETE_UPB_ENTRY)
+RFX_ID_MAPPING(RIL_REQUEST_READ_UPB_GAS_LIST, RFX_MSG_REQUEST_READ_UPB_GAS_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_READ_UPB_GRP, RFX_MSG_REQUEST_READ_UPB_GRP)
+RFX_ID_MAPPING(RIL_REQUEST_WRITE_UPB_GRP, RFX_MSG_REQUEST_WRITE_UPB_GRP)
+RFX_ID_MAPPING(RIL_REQUEST_GET_PHB_STRING_LENGTH, RFX_MSG_REQUEST_GET_PHB_STRING_LENGTH)
+RFX_ID_MAPPING(RIL_REQUEST_GET_PHB_MEM_STORAGE, RFX_MSG_REQUEST_GET_PHB_MEM_STORAGE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_PHB_MEM_STORAGE, RFX_MSG_REQUEST_SET_PHB_MEM_STORAGE)
+RFX_ID_MAPPING(RIL_REQUEST_READ_PHB_ENTRY_EXT, RFX_MSG_REQUEST_READ_PHB_ENTRY_EXT)
+RFX_ID_MAPPING(RIL_REQUEST_WRITE_PHB_ENTRY_EXT, RFX_MSG_REQUEST_WRITE_PHB_ENTRY_EXT)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_UPB_AVAILABLE, RFX_MSG_REQUEST_QUERY_UPB_AVAILABLE)
+RFX_ID_MAPPING(RIL_REQUEST_READ_EMAIL_ENTRY, RFX_MSG_REQUEST_READ_EMAIL_ENTRY)
+RFX_ID_MAPPING(RIL_REQUEST_READ_SNE_ENTRY, RFX_MSG_REQUEST_READ_SNE_ENTRY)
+RFX_ID_MAPPING(RIL_REQUEST_READ_ANR_ENTRY, RFX_MSG_REQUEST_READ_ANR_ENTRY)
+RFX_ID_MAPPING(RIL_REQUEST_READ_UPB_AAS_LIST, RFX_MSG_REQUEST_READ_UPB_AAS_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_SET_PHONEBOOK_READY, RFX_MSG_REQUEST_SET_PHONEBOOK_READY)
+// PHB Part -- End
+// SS Part -- start
+RFX_ID_MAPPING(RIL_REQUEST_SEND_USSD, RFX_MSG_REQUEST_SEND_USSD)
+RFX_ID_MAPPING(RIL_REQUEST_CANCEL_USSD, RFX_MSG_REQUEST_CANCEL_USSD)
+RFX_ID_MAPPING(RIL_REQUEST_GET_CLIR, RFX_MSG_REQUEST_GET_CLIR)
+RFX_ID_MAPPING(RIL_REQUEST_SET_CLIR, RFX_MSG_REQUEST_SET_CLIR)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_CALL_FORWARD_STATUS, RFX_MSG_REQUEST_QUERY_CALL_FORWARD_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_SET_CALL_FORWARD, RFX_MSG_REQUEST_SET_CALL_FORWARD)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_CALL_FORWARD_IN_TIME_SLOT,
+               RFX_MSG_REQUEST_QUERY_CALL_FORWARD_IN_TIME_SLOT)
+RFX_ID_MAPPING(RIL_REQUEST_SET_CALL_FORWARD_IN_TIME_SLOT,
+               RFX_MSG_REQUEST_SET_CALL_FORWARD_IN_TIME_SLOT)
+RFX_ID_MAPPING(RIL_REQUEST_RUN_GBA, RFX_MSG_REQUEST_RUN_GBA)
+RFX_ID_MAPPING(RIL_REQUEST_SET_CALL_WAITING, RFX_MSG_REQUEST_SET_CALL_WAITING)
+RFX_ID_MAPPING(RIL_REQUEST_CHANGE_BARRING_PASSWORD, RFX_MSG_REQUEST_CHANGE_BARRING_PASSWORD)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_CLIP, RFX_MSG_REQUEST_QUERY_CLIP)
+RFX_ID_MAPPING(RIL_REQUEST_SET_CLIP, RFX_MSG_REQUEST_SET_CLIP)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SUPP_SVC_NOTIFICATION, RFX_MSG_REQUEST_SET_SUPP_SVC_NOTIFICATION)
+RFX_ID_MAPPING(RIL_REQUEST_GET_COLP, RFX_MSG_REQUEST_GET_COLP)
+RFX_ID_MAPPING(RIL_REQUEST_SET_COLP, RFX_MSG_REQUEST_SET_COLP)
+RFX_ID_MAPPING(RIL_REQUEST_GET_COLR, RFX_MSG_REQUEST_GET_COLR)
+RFX_ID_MAPPING(RIL_REQUEST_SET_COLR, RFX_MSG_REQUEST_SET_COLR)
+RFX_ID_MAPPING(RIL_REQUEST_SEND_CNAP, RFX_MSG_REQUEST_SEND_CNAP)
+RFX_ID_MAPPING(RIL_REQUEST_SEND_USSI, RFX_MSG_REQUEST_SEND_USSI)
+RFX_ID_MAPPING(RIL_REQUEST_CANCEL_USSI, RFX_MSG_REQUEST_CANCEL_USSI)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_CALL_WAITING, RFX_MSG_REQUEST_QUERY_CALL_WAITING)
+RFX_ID_MAPPING(RIL_REQUEST_GET_XCAP_STATUS, RFX_MSG_REQUEST_GET_XCAP_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_RESET_SUPP_SERV, RFX_MSG_REQUEST_RESET_SUPP_SERV)
+RFX_ID_MAPPING(RIL_REQUEST_SETUP_XCAP_USER_AGENT_STRING,
+               RFX_MSG_REQUEST_SETUP_XCAP_USER_AGENT_STRING)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SS_PROPERTY, RFX_MSG_REQUEST_SET_SS_PROPERTY)
+RFX_ID_MAPPING(RIL_UNSOL_ON_VOLTE_SUBSCRIPTION, RFX_MSG_UNSOL_ON_VOLTE_SUBSCRIPTION)
+// SS pPart -- End
+/// M: Ims Data Framework {@
+RFX_ID_MAPPING(RIL_REQUEST_IMS_BEARER_STATE_CONFIRM, RFX_MSG_REQUEST_IMS_BEARER_STATE_CONFIRM)
+RFX_ID_MAPPING(RIL_REQUEST_SET_IMS_BEARER_NOTIFICATION, RFX_MSG_REQUEST_SET_IMS_BEARER_NOTIFICATION)
+/// @}
+// STK Part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_STK_SEND_ENVELOPE_COMMAND, RFX_MSG_REQUEST_STK_SEND_ENVELOPE_COMMAND)
+RFX_ID_MAPPING(RIL_REQUEST_STK_SEND_TERMINAL_RESPONSE, RFX_MSG_REQUEST_STK_SEND_TERMINAL_RESPONSE)
+RFX_ID_MAPPING(RIL_REQUEST_STK_HANDLE_CALL_SETUP_REQUESTED_FROM_SIM,
+               RFX_MSG_REQUEST_STK_HANDLE_CALL_SETUP_REQUESTED_FROM_SIM)
+RFX_ID_MAPPING(RIL_REQUEST_STK_HANDLE_CALL_SETUP_REQUESTED_FROM_SIM_WITH_RESULT_CODE,
+               RFX_MSG_REQUEST_STK_HANDLE_CALL_SETUP_REQUESTED_FROM_SIM_WITH_RESULT_CODE)
+RFX_ID_MAPPING(RIL_REQUEST_REPORT_STK_SERVICE_IS_RUNNING,
+               RFX_MSG_REQUEST_REPORT_STK_SERVICE_IS_RUNNING)
+RFX_ID_MAPPING(RIL_REQUEST_STK_SEND_ENVELOPE_WITH_STATUS,
+               RFX_MSG_REQUEST_STK_SEND_ENVELOPE_WITH_STATUS)
+RFX_ID_MAPPING(RIL_UNSOL_STK_SESSION_END, RFX_MSG_URC_STK_SESSION_END)
+RFX_ID_MAPPING(RIL_UNSOL_STK_PROACTIVE_COMMAND, RFX_MSG_URC_STK_PROACTIVE_COMMAND)
+RFX_ID_MAPPING(RIL_UNSOL_STK_EVENT_NOTIFY, RFX_MSG_URC_STK_EVENT_NOTIFY)
+RFX_ID_MAPPING(RIL_UNSOL_STK_CALL_SETUP, RFX_MSG_URC_STK_CALL_SETUP)
+RFX_ID_MAPPING(RIL_UNSOL_SIM_REFRESH, RFX_MSG_URC_SIM_REFRESH)
+RFX_ID_MAPPING(RIL_UNSOL_STK_CC_ALPHA_NOTIFY, RFX_MSG_URC_STK_CC_ALPHA_NOTIFY)
+// STK Part -- End
+/// M: CC: C2K specific start @{
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_SET_PREFERRED_VOICE_PRIVACY_MODE,
+               RFX_MSG_REQUEST_CDMA_SET_PREFERRED_VOICE_PRIVACY_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_QUERY_PREFERRED_VOICE_PRIVACY_MODE,
+               RFX_MSG_REQUEST_CDMA_QUERY_PREFERRED_VOICE_PRIVACY_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_FLASH, RFX_MSG_REQUEST_CDMA_FLASH)
+RFX_ID_MAPPING(RIL_REQUEST_CDMA_BURST_DTMF, RFX_MSG_REQUEST_CDMA_BURST_DTMF)
+RFX_ID_MAPPING(RIL_REQUEST_EXIT_EMERGENCY_CALLBACK_MODE,
+               RFX_MSG_REQUEST_EXIT_EMERGENCY_CALLBACK_MODE)
+RFX_ID_MAPPING(RIL_UNSOL_ENTER_EMERGENCY_CALLBACK_MODE, RFX_MSG_UNSOL_ENTER_EMERGENCY_CALLBACK_MODE)
+RFX_ID_MAPPING(RIL_UNSOL_EXIT_EMERGENCY_CALLBACK_MODE, RFX_MSG_UNSOL_EXIT_EMERGENCY_CALLBACK_MODE)
+RFX_ID_MAPPING(RIL_UNSOL_CDMA_INFO_REC, RFX_MSG_UNSOL_CDMA_INFO_REC)
+RFX_ID_MAPPING(RIL_UNSOL_CDMA_CALL_WAITING, RFX_MSG_UNSOL_CDMA_CALL_WAITING)
+RFX_ID_MAPPING(RIL_UNSOL_CDMA_CALL_ACCEPTED, RFX_MSG_UNSOL_CDMA_CALL_ACCEPTED)
+/// @}
+/// M: [Network][C2K] For Sprint Roaming Bar @{
+RFX_ID_MAPPING(RIL_REQUEST_SET_ROAMING_ENABLE, RFX_MSG_REQUEST_SET_ROAMING_ENABLE)
+RFX_ID_MAPPING(RIL_REQUEST_GET_ROAMING_ENABLE, RFX_MSG_REQUEST_GET_ROAMING_ENABLE)
+/// @}
+// MwiService @{
+RFX_ID_MAPPING(RIL_REQUEST_SET_WIFI_ENABLED, RFX_MSG_REQUEST_SET_WIFI_ENABLED)
+RFX_ID_MAPPING(RIL_REQUEST_SET_WIFI_ASSOCIATED, RFX_MSG_REQUEST_SET_WIFI_ASSOCIATED)
+RFX_ID_MAPPING(RIL_REQUEST_SET_WFC_CONFIG, RFX_MSG_REQUEST_SET_WFC_CONFIG)
+RFX_ID_MAPPING(RIL_REQUEST_SET_WIFI_SIGNAL_LEVEL, RFX_MSG_REQUEST_SET_WIFI_SIGNAL_LEVEL)
+RFX_ID_MAPPING(RIL_REQUEST_SET_GEO_LOCATION, RFX_MSG_REQUEST_SET_GEO_LOCATION)
+RFX_ID_MAPPING(RIL_REQUEST_SET_WIFI_IP_ADDRESS, RFX_MSG_REQUEST_SET_WIFI_IP_ADDRESS)
+RFX_ID_MAPPING(RIL_REQUEST_SET_EMERGENCY_ADDRESS_ID, RFX_MSG_REQUEST_SET_EMERGENCY_ADDRESS_ID)
+RFX_ID_MAPPING(RIL_REQUEST_SET_NATT_KEEP_ALIVE_STATUS, RFX_MSG_REQUEST_SET_NATT_KEEP_ALIVE_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_SET_WIFI_PING_RESULT, RFX_MSG_REQUEST_SET_WIFI_PING_RESULT)
+RFX_ID_MAPPING(RIL_REQUEST_QUERY_SSAC_STATUS, RFX_MSG_REQUEST_QUERY_SSAC_STATUS)
+/// M: Notify ePDG screen state
+RFX_ID_MAPPING(RIL_REQUEST_NOTIFY_EPDG_SCREEN_STATE, RFX_MSG_REQUEST_NOTIFY_EPDG_SCREEN_STATE)
+RFX_ID_MAPPING(RIL_UNSOL_MOBILE_WIFI_ROVEOUT, RFX_MSG_UNSOL_MOBILE_WIFI_ROVEOUT)
+RFX_ID_MAPPING(RIL_UNSOL_MOBILE_WIFI_HANDOVER, RFX_MSG_UNSOL_MOBILE_WIFI_HANDOVER)
+RFX_ID_MAPPING(RIL_UNSOL_ACTIVE_WIFI_PDN_COUNT, RFX_MSG_UNSOL_ACTIVE_WIFI_PDN_COUNT)
+RFX_ID_MAPPING(RIL_UNSOL_WIFI_RSSI_MONITORING_CONFIG, RFX_MSG_UNSOL_WIFI_RSSI_MONITORING_CONFIG)
+RFX_ID_MAPPING(RIL_UNSOL_WIFI_PDN_ERROR, RFX_MSG_UNSOL_WIFI_PDN_ERROR)
+RFX_ID_MAPPING(RIL_UNSOL_REQUEST_GEO_LOCATION, RFX_MSG_UNSOL_REQUEST_GEO_LOCATION)
+RFX_ID_MAPPING(RIL_UNSOL_WFC_PDN_STATE, RFX_MSG_URC_WFC_PDN_STATE)
+RFX_ID_MAPPING(RIL_UNSOL_NATT_KEEP_ALIVE_CHANGED, RFX_MSG_UNSOL_NATT_KEEP_ALIVE_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_WIFI_PING_REQUEST, RFX_MSG_UNSOL_WIFI_PING_REQUEST)
+RFX_ID_MAPPING(RIL_UNSOL_WIFI_PDN_OOS, RFX_MSG_UNSOL_WIFI_PDN_OOS)
+RFX_ID_MAPPING(RIL_UNSOL_WIFI_LOCK, RFX_MSG_UNSOL_WIFI_LOCK)
+RFX_ID_MAPPING(RIL_UNSOL_SSAC_STATUS, RFX_MSG_UNSOL_SSAC_STATUS)
+/// @}
+// AGPS part -- start
+RFX_ID_MAPPING(RIL_LOCAL_C2K_REQUEST_AGPS_TCP_CONNIND, RFX_MSG_REQUEST_AGPS_TCP_CONNIND)
+// AGPS Part -- End
+RFX_ID_MAPPING(RIL_LOCAL_REQUEST_GET_IMS_DATA_CALL_INFO, RFX_MSG_REQUEST_GET_IMS_DATA_CALL_INFO)
+RFX_ID_MAPPING(RIL_LOCAL_REQUEST_REUSE_IMS_DATA_CALL, RFX_MSG_REQUEST_REUSE_IMS_DATA_CALL)
+// ATCI Part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_OEM_HOOK_ATCI_INTERNAL, RFX_MSG_REQUEST_OEM_HOOK_ATCI_INTERNAL)
+// ATCI Part -- End
+// SUBSIDYLOCK Part -- Start
+RFX_ID_MAPPING(RIL_REQUEST_GET_SUBLOCK_MODEM_STATUS, RFX_MSG_REQUEST_GET_SUBLOCK_MODEM_STATUS)
+RFX_ID_MAPPING(RIL_REQUEST_UPDATE_SUBLOCK_SETTINGS, RFX_MSG_REQUEST_UPDATE_SUBLOCK_SETTINGS)
+// SUBSIDYLOCK Part -- End
+RFX_ID_MAPPING(RIL_UNSOL_OEM_HOOK_RAW, RFX_MSG_UNSOL_OEM_HOOK_RAW)
+RFX_ID_MAPPING(RIL_REQUEST_SWITCH_MODE_FOR_ECC, RFX_MSG_REQUEST_SWITCH_MODE_FOR_ECC)
+RFX_ID_MAPPING(RIL_REQUEST_FORCE_RELEASE_CALL, RFX_MSG_REQUEST_FORCE_RELEASE_CALL)
+// IMS Event part -- start
+RFX_ID_MAPPING(RIL_UNSOL_IMS_CONFERENCE_INFO_INDICATION,
+               RFX_MSG_UNSOL_IMS_CONFERENCE_INFO_INDICATION)
+RFX_ID_MAPPING(RIL_UNSOL_LTE_MESSAGE_WAITING_INDICATION,
+               RFX_MSG_UNSOL_LTE_MESSAGE_WAITING_INDICATION)
+RFX_ID_MAPPING(RIL_UNSOL_IMS_DIALOG_INDICATION, RFX_MSG_URC_IMS_DIALOG_INDICATION)
+// IMS Event part -- end
+// PS/CS attach
+RFX_ID_MAPPING(RIL_REQUEST_DATA_CONNECTION_ATTACH, RFX_MSG_REQUEST_DATA_CONNECTION_ATTACH)
+// PS/CS detach
+RFX_ID_MAPPING(RIL_REQUEST_DATA_CONNECTION_DETACH, RFX_MSG_REQUEST_DATA_CONNECTION_DETACH)
+// Cleanup all connectios
+RFX_ID_MAPPING(RIL_REQUEST_RESET_ALL_CONNECTIONS, RFX_MSG_REQUEST_RESET_ALL_CONNECTIONS)
+RFX_ID_MAPPING(RIL_REQUEST_SET_TX_POWER_STATUS, RFX_MSG_REQUEST_SET_TX_POWER_STATUS)
+// MTK-START: SIM SLOT LOCK
+RFX_ID_MAPPING(RIL_UNSOL_SIM_SLOT_LOCK_POLICY_NOTIFY, RFX_MSG_URC_SIM_SLOT_LOCK_POLICY_NOTIFY)
+RFX_ID_MAPPING(RIL_REQUEST_ENTER_DEVICE_NETWORK_DEPERSONALIZATION,
+               RFX_MSG_REQUEST_SIM_ENTER_DEVICE_NETWORK_DEPERSONALIZATION)
+// MTK-END
+RFX_ID_MAPPING(RIL_UNSOL_SIM_POWER_CHANGED, RFX_MSG_URC_SIM_POWER_CHANGED)
+RFX_ID_MAPPING(RIL_UNSOL_EMERGENCY_NUMBER_LIST, RFX_MSG_URC_EMERGENCY_NUMBER_LIST)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_GET_CURRENT_CALLS, RFX_MSG_REQUEST_IMS_GET_CURRENT_CALLS)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_HANGUP_WAITING_OR_BACKGROUND,
+               RFX_MSG_REQUEST_IMS_HANGUP_WAITING_OR_BACKGROUND)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_HANGUP_FOREGROUND_RESUME_BACKGROUND,
+               RFX_MSG_REQUEST_IMS_HANGUP_FOREGROUND_RESUME_BACKGROUND)
+RFX_ID_MAPPING(RIL_REQUEST_IMS_SWITCH_WAITING_OR_HOLDING_AND_ACTIVE,
+               RFX_MSG_REQUEST_IMS_SWITCH_WAITING_OR_HOLDING_AND_ACTIVE)
+RFX_ID_MAPPING(RIL_REQUEST_ENABLE_MODEM, RFX_MSG_REQUEST_ENABLE_MODEM)
+// M: RTT @{
+RFX_ID_MAPPING(RIL_REQUEST_SET_RTT_MODE, RFX_MSG_REQUEST_SET_RTT_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_SEND_RTT_MODIFY_REQUEST, RFX_MSG_REQUEST_SEND_RTT_MODIFY_REQUEST)
+RFX_ID_MAPPING(RIL_REQUEST_SEND_RTT_TEXT, RFX_MSG_REQUEST_SEND_RTT_TEXT)
+RFX_ID_MAPPING(RIL_REQUEST_RTT_MODIFY_REQUST_RESPONSE, RFX_MSG_REQUEST_RTT_MODIFY_REQUEST_RESPONSE)
+RFX_ID_MAPPING(RIL_UNSOL_RTT_MODIFY_RESPONSE, RFX_MSG_UNSOL_RTT_MODIFY_RESPONSE)
+RFX_ID_MAPPING(RIL_UNSOL_RTT_TEXT_RECEIVE, RFX_MSG_UNSOL_RTT_TEXT_RECEIVE)
+RFX_ID_MAPPING(RIL_UNSOL_RTT_CAPABILITY_INDICATION, RFX_MSG_UNSOL_RTT_CAPABILITY_INDICATION)
+RFX_ID_MAPPING(RIL_UNSOL_RTT_MODIFY_REQUEST_RECEIVE, RFX_MSG_UNSOL_RTT_MODIFY_REQUEST_RECEIVE)
+RFX_ID_MAPPING(RIL_UNSOL_AUDIO_INDICATION, RFX_MSG_UNSOL_AUDIO_INDICATION)
+RFX_ID_MAPPING(RIL_REQUEST_TOGGLE_RTT_AUDIO_INDICATION, RFX_MSG_REQUEST_TOGGLE_RTT_AUDIO_INDICATION)
+// @}
+RFX_ID_MAPPING(RIL_REQUEST_GET_PHONE_CAPABILITY, RFX_MSG_REQUEST_GET_PHONE_CAPABILITY)
+// M: GWSD @{
+RFX_ID_MAPPING(RIL_REQUEST_SET_GWSD_MODE, RFX_MSG_REQUEST_SET_GWSD_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_GWSD_CALL_VALID, RFX_MSG_REQUEST_SET_GWSD_CALL_VALID)
+RFX_ID_MAPPING(RIL_REQUEST_SET_GWSD_IGNORE_CALL_INTERVAL,
+               RFX_MSG_REQUEST_SET_GWSD_IGNORE_CALL_INTERVAL)
+RFX_ID_MAPPING(RIL_REQUEST_SET_GWSD_KEEP_ALIVE_PDCP, RFX_MSG_REQUEST_SET_GWSD_KEEP_ALIVE_PDCP)
+RFX_ID_MAPPING(RIL_REQUEST_SET_GWSD_KEEP_ALIVE_IPDATA, RFX_MSG_REQUEST_SET_GWSD_KEEP_ALIVE_IPDATA)
+// @}
+RFX_ID_MAPPING(RIL_REQUEST_SCREEN_STATE, RFX_MSG_REQUEST_SCREEN_STATE)
+RFX_ID_MAPPING(RIL_REQUEST_SET_SIP_HEADER, RFX_MSG_REQUEST_SET_SIP_HEADER)
+RFX_ID_MAPPING(RIL_REQUEST_SIP_HEADER_REPORT, RFX_MSG_REQUEST_SIP_HEADER_REPORT)
+RFX_ID_MAPPING(RIL_REQUEST_SET_IMS_CALL_MODE, RFX_MSG_REQUEST_SET_IMS_CALL_MODE)
+RFX_ID_MAPPING(RIL_REQUEST_SEND_DEVICE_STATE, RFX_MSG_REQUEST_SEND_DEVICE_STATE)
+RFX_ID_MAPPING(RIL_REQUEST_ACTIVATE_UICC_CARD, RFX_MSG_REQUEST_ACTIVATE_UICC_CARD)
+RFX_ID_MAPPING(RIL_REQUEST_DEACTIVATE_UICC_CARD, RFX_MSG_REQUEST_DEACTIVATE_UICC_CARD)
+RFX_ID_MAPPING(RIL_REQUEST_GET_CURRENT_UICC_CARD_PROVISIONING_STATUS,
+               RFX_MSG_REQUEST_GET_CURRENT_UICC_CARD_PROVISIONING_STATUS)
+RFX_ID_MAPPING(RIL_UNSOL_IWLAN_CELLULAR_QUALITY_CHANGED_IND,
+               RFX_MSG_URC_CELLULAR_QUALITY_CHANGED_IND)  // MUSE WFC requirement
+RFX_ID_MAPPING(RIL_REQUEST_IWLAN_REGISTER_CELLULAR_QUALITY_REPORT,
+               RFX_MSG_REQUEST_REGISTER_CELLULAR_QUALITY_REPORT)  // MUSE WFC requirement
+RFX_ID_MAPPING(RIL_REQUEST_ROUTE_CERTIFICATE, RFX_MSG_REQUEST_ROUTE_CERTIFICATE)
+RFX_ID_MAPPING(RIL_REQUEST_ROUTE_AUTH, RFX_MSG_REQUEST_ROUTE_AUTH)
+RFX_ID_MAPPING(RIL_REQUEST_ENABLE_CAPABILITY, RFX_MSG_REQUEST_ENABLE_CAPABILITY)
+RFX_ID_MAPPING(RIL_REQUEST_ABORT_CERTIFICATE, RFX_MSG_REQUEST_ABORT_CERTIFICATE)
+RFX_ID_MAPPING(RIL_REQUEST_SEND_SAR_IND, RFX_MSG_REQUEST_SEND_SAR_IND)
+RFX_ID_MAPPING(RIL_REQUEST_SET_CALL_ADDITIONAL_INFO, RFX_MSG_REQUEST_SET_CALL_ADDITIONAL_INFO)
+RFX_ID_MAPPING(RIL_REQUEST_SML_RSU_REQUEST, RFX_MSG_REQUEST_SML_RSU_REQUEST)
+RFX_ID_MAPPING(RIL_UNSOL_SML_RSU_EVENT, RFX_MSG_UNSOL_SML_RSU_EVENT)
+
+// vendor ril -> libril only, mostly URC
+// SIM -- Start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMSI_REFRESH_DONE, RFX_MSG_URC_SIM_IMSI_REFRESH_DONE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_MELOCK_NOTIFICATION, RFX_MSG_URC_SIM_MELOCK_NOTIFICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_ATT_SIM_LOCK_NOTIFICATION, RFX_MSG_URC_ATT_SIM_LOCK_NOTIFICATION)
+// SIM switch part -- Start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_RADIO_CAPABILITY, RFX_MSG_URC_RADIO_CAPABILITY)
+// eMBMS URC
+RFX_MSG_ID_TO_ID(RIL_UNSOL_EMBMS_AT_INFO, RFX_MSG_URC_EMBMS_AT_INFO)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_EMBMS_SESSION_STATUS, RFX_MSG_URC_RTC_EMBMS_SESSION_STATUS)
+// NW part -- Start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_PSEUDO_CELL_INFO, RFX_MSG_URC_PSEUDO_CELL_INFO)
+// CC part -- Start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_RESPONSE_CALL_STATE_CHANGED, RFX_MSG_UNSOL_RESPONSE_CALL_STATE_CHANGED)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_SUPP_SVC_NOTIFICATION, RFX_MSG_UNSOL_SUPP_SVC_NOTIFICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_SUPP_SVC_NOTIFICATION_EX, RFX_MSG_UNSOL_SUPP_SVC_NOTIFICATION_EX)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CALL_RING, RFX_MSG_UNSOL_CALL_RING)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_RINGBACK_TONE, RFX_MSG_UNSOL_RINGBACK_TONE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_RESEND_INCALL_MUTE, RFX_MSG_UNSOL_RESEND_INCALL_MUTE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CRSS_NOTIFICATION, RFX_MSG_UNSOL_CRSS_NOTIFICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_INCOMING_CALL_INDICATION, RFX_MSG_UNSOL_INCOMING_CALL_INDICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CALL_ADDITIONAL_INFO, RFX_MSG_UNSOL_CALL_ADDITIONAL_INFO)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CIPHER_INDICATION, RFX_MSG_UNSOL_CIPHER_INDICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_SPEECH_CODEC_INFO, RFX_MSG_UNSOL_SPEECH_CODEC_INFO)
+// common start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_OEM_HOOK_RAW, RFX_MSG_REQUEST_QUERY_MODEM_THERMAL)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_HARDWARE_CONFIG_CHANGED, RFX_MSG_UNSOL_HARDWARE_CONFIG_CHANGED)
+// radio start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_RESPONSE_RADIO_STATE_CHANGED, RFX_MSG_UNSOL_RADIO_STATE_CHANGED)
+// IMS config telephonyware START
+RFX_MSG_ID_TO_ID(RIL_UNSOL_GET_PROVISION_DONE, RFX_MSG_UNSOL_GET_PROVISION_DONE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CALL_INFO_INDICATION, RFX_MSG_UNSOL_CALL_INFO_INDICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_ECONF_SRVCC_INDICATION, RFX_MSG_UNSOL_ECONF_SRVCC_INDICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_SIP_CALL_PROGRESS_INDICATOR, RFX_MSG_UNSOL_SIP_CALL_PROGRESS_INDICATOR)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_ECONF_RESULT_INDICATION, RFX_MSG_UNSOL_ECONF_RESULT_INDICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CALLMOD_CHANGE_INDICATOR, RFX_MSG_UNSOL_CALLMOD_CHANGE_INDICATOR)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_VIDEO_CAPABILITY_INDICATOR, RFX_MSG_UNSOL_VIDEO_CAPABILITY_INDICATOR)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_SRVCC_STATE_NOTIFY, RFX_MSG_UNSOL_SRVCC_STATE_NOTIFY)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_ECT_INDICATION, RFX_MSG_UNSOL_ECT_INDICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_DISABLE_START, RFX_MSG_UNSOL_IMS_DISABLE_START)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_ENABLE_START, RFX_MSG_UNSOL_IMS_ENABLE_START)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_DISABLE_DONE, RFX_MSG_UNSOL_IMS_DISABLE_DONE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_ENABLE_DONE, RFX_MSG_UNSOL_IMS_ENABLE_DONE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_REGISTRATION_INFO, RFX_MSG_UNSOL_IMS_REGISTRATION_INFO)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_RESPONSE_IMS_NETWORK_STATE_CHANGED,
+                 RFX_MSG_UNSOL_RESPONSE_IMS_NETWORK_STATE_CHANGED)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_DEREG_DONE, RFX_MSG_UNSOL_IMS_DEREG_DONE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_EVENT_PACKAGE_INDICATION, RFX_MSG_URC_IMS_EVENT_PACKAGE_INDICATION)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_VOLTE_SETTING, RIL_MSG_UNSOL_VOLTE_SETTING)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_MULTIIMS_COUNT, RFX_MSG_UNSOL_IMS_MULTIIMS_COUNT)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_SUPPORT_ECC, RFX_MSG_UNSOL_IMS_SUPPORT_ECC)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_EMERGENCY_BEARER_SUPPORT_NOTIFY,
+                 RFX_MSG_URC_EMERGENCY_BEARER_SUPPORT_NOTIFY)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_REDIAL_EMERGENCY_INDICATION, RFX_MSG_URC_REDIAL_EMERGENCY_INDICATION)
+// Data part -- Start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_REMOVE_RESTRICT_EUTRAN, RFX_MSG_URC_REMOVE_RESTRICT_EUTRAN)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_MD_DATA_RETRY_COUNT_RESET, RFX_MSG_URC_MD_DATA_RETRY_COUNT_RESET)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_DATA_CALL_LIST_CHANGED, RFX_MSG_URC_DATA_CALL_LIST_CHANGED)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_LCEDATA_RECV, RFX_MSG_URC_LCEDATA_RECV)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_LTE_ACCESS_STRATUM_STATE_CHANGE,
+                 RFX_MSG_URC_LTE_ACCESS_STRATUM_STATE_CHANGE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_LINK_CAPACITY_ESTIMATE, RFX_MSG_URC_LINK_CAPACITY_ESTIMATE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_MOBILE_DATA_USAGE, RFX_MSG_URC_MOBILE_DATA_USAGE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_KEEPALIVE_STATUS, RFX_MSG_URC_KEEPALIVE_STATUS)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_NW_LIMIT, RFX_MSG_URC_NW_LIMIT)
+// SMS part -- Start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_RESPONSE_CDMA_NEW_SMS, RFX_MSG_URC_CDMA_NEW_SMS)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_RESPONSE_CDMA_NEW_SMS_EX, RFX_MSG_URC_CDMA_NEW_SMS_EX)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CDMA_RUIM_SMS_STORAGE_FULL, RFX_MSG_URC_CDMA_RUIM_SMS_STORAGE_FULL)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CDMA_CARD_INITIAL_ESN_OR_MEID, RFX_MSG_URC_CDMA_CARD_INITIAL_ESN_OR_MEID)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_WORLD_MODE_CHANGED, RFX_MSG_URC_WORLD_MODE_CHANGED)
+// PHB Part -- Start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_PHB_READY_NOTIFICATION, RFX_MSG_URC_PHB_READY_NOTIFICATION)
+// SS Part -- start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_ON_USSD, RFX_MSG_UNSOL_ON_USSD)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CALL_FORWARDING, RFX_MSG_UNSOL_CALL_FORWARDING)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_ON_USSI, RFX_MSG_UNSOL_ON_USSI)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_ON_XUI, RFX_MSG_UNSOL_ON_XUI)
+/// M: Ims Data Framework {@
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_BEARER_STATE_NOTIFY, RFX_MSG_URC_IMS_BEARER_STATE_NOTIFY)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_BEARER_INIT, RFX_MSG_URC_IMS_BEARER_INIT)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_DATA_INFO_NOTIFY, RFX_MSG_URC_IMS_DATA_INFO_NOTIFY)
+// AGPS part -- start
+RFX_MSG_ID_TO_ID(RIL_LOCAL_C2K_UNSOL_VIA_GPS_EVENT, RFX_MSG_URC_VIA_GPS_EVENT)
+// ATCI Part -- Start
+RFX_MSG_ID_TO_ID(RIL_UNSOL_ATCI_RESPONSE, RFX_MSG_UNSOL_ATCI_RESPONSE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_TX_POWER, RFX_MSG_UNSOL_TX_POWER)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_TX_POWER_STATUS, RFX_MSG_UNSOL_TX_POWER_STATUS)
+// Cleanup all connections
+RFX_MSG_ID_TO_ID(RIL_UNSOL_DSBP_STATE_CHANGED, RFX_MSG_UNSOL_DSBP_CHANGED_INDICATION)
+// MTK-START: SIM SLOT LOCK
+RFX_MSG_ID_TO_ID(RIL_UNSOL_NO_EMERGENCY_CALLBACK_MODE, RFX_MSG_UNSOL_NO_EMERGENCY_CALLBACK_MODE)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_IMS_RESPONSE_CALL_STATE_CHANGED,
+                 RFX_MSG_UNSOL_IMS_RESPONSE_CALL_STATE_CHANGED)
+// M: GWSD @{
+RFX_MSG_ID_TO_ID(RIL_UNSOL_SIP_HEADER, RFX_MSG_URC_SIP_HEADER)
+RFX_MSG_ID_TO_ID(RIL_UNSOL_CALL_RAT_INDICATION, RFX_MSG_URC_CALL_RAT_INDICATION)
+
+#endif
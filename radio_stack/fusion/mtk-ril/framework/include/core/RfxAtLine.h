@@ -27,6 +27,11 @@ class RfxAtLine {
   public:
     RfxAtLine() : m_line(NULL), m_pNext(NULL) {}
 
+    // Reader creates one RfxAtLine for every line from the channel and they are deleted on
+    // other threads, so objects are recycled through a shared free list instead of the heap
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
     RfxAtLine(const char* line, RfxAtLine* next);
 
     // copy constructor
@@ -59,6 +64,10 @@ class RfxAtLine {
     bool isAckResponse();
 
   private:
+    // lines shorter than this are kept in m_inlineLine without another allocation
+    enum { INLINE_LINE_SIZE = 256 };
+
+    void initLine(const char* line, size_t len);
     void skipWhiteSpace();
     void skipNextComma();
     int atTokNextintBase(int base, int uns, int* err);
@@ -69,5 +78,6 @@ class RfxAtLine {
     char* m_line;  // should dynamic allocate memory?
     RfxAtLine* m_pNext;
     char* m_pCur;  // current position, initialize at atTokStart
+    char m_inlineLine[INLINE_LINE_SIZE];
 };
 #endif
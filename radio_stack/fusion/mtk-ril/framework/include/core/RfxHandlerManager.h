@@ -20,6 +20,7 @@
 #include "utils/RefBase.h"
 #include "utils/SortedVector.h"
 #include "utils/String8.h"
+#include <atomic>
 #include <map>
 #include "RfxBaseHandler.h"
 #include "RfxMclMessage.h"
@@ -157,6 +158,27 @@ class RfxHandlerRegisterEntry {
     bool mNeedAllMatch;
 };
 
+// Immutable URC routing table of one channel.
+// Entries are bucketed by the first character of the raw urc, each bucket keeps
+// the SortedVector order (prefix entries longest first, then all-match entries),
+// so find() returns the same entry as a full scan of the channel list.
+class RfxUrcIndex {
+  public:
+    explicit RfxUrcIndex(const SortedVector<RfxHandlerRegisterEntry>& list);
+
+    const RfxHandlerRegisterEntry* find(const char* urc) const;
+
+    static bool match(const RfxHandlerRegisterEntry& item, const char* urc);
+
+  private:
+    enum { BUCKET_COUNT = 256 };
+
+    Vector<RfxHandlerRegisterEntry> m_entries;
+    // entries of bucket c are m_entries[m_order[m_bucket[c]] .. m_order[m_bucket[c + 1] - 1]]
+    Vector<uint32_t> m_order;
+    uint32_t m_bucket[BUCKET_COUNT + 1];
+};
+
 class RfxHandlerManager {
   public:
     static RfxHandlerManager* init();
@@ -184,6 +206,8 @@ class RfxHandlerManager {
     static int findMsgChannel(int type, int slot_id, int id, int client_id, const char* urc);
 
   private:
+    RfxHandlerManager();
+
     void registerInternal(Vector<RfxCreateHandlerFuncptr>& list, RfxCreateHandlerFuncptr func_ptr,
                           int c_id);
 
@@ -208,6 +232,13 @@ class RfxHandlerManager {
 
     SortedVector<RfxHandlerRegisterEntry> findListByChannel(int type, int channel_id);
 
+    // must hold m_mutex[channel_id]
+    void buildUrcIndexLocked(int channel_id);
+
+    const RfxUrcIndex* getUrcIndex(int channel_id) const {
+        return m_urc_index[channel_id].load(std::memory_order_acquire);
+    }
+
   private:
     static RfxHandlerManager* s_self;
     // handler & channel relationship
@@ -220,6 +251,11 @@ class RfxHandlerManager {
     SortedVector<RfxHandlerRegisterEntry> m_urc_list[RIL_SUPPORT_CHANNELS];
     SortedVector<RfxHandlerRegisterEntry> m_event_list[RIL_SUPPORT_CHANNELS];
     mutable Mutex m_mutex[RIL_SUPPORT_CHANNELS];
+
+    // urc lookup without m_mutex, published after initHandler of the channel.
+    // Replaced indexes are kept in m_retired_urc_index since readers may still use them.
+    std::atomic<const RfxUrcIndex*> m_urc_index[RIL_SUPPORT_CHANNELS];
+    Vector<const RfxUrcIndex*> m_retired_urc_index[RIL_SUPPORT_CHANNELS];
 };
 
 #endif
@@ -23,8 +23,12 @@
 #include "RfxDefs.h"
 #include "RfxStatusDefs.h"
 #include "RfxVariant.h"
+#include "utils/Condition.h"
 #include "utils/Mutex.h"
+#include <atomic>
+#include <string.h>
 
+using ::android::Condition;
 using ::android::Mutex;
 
 /*****************************************************************************
@@ -33,11 +37,7 @@ using ::android::Mutex;
 
 class RfxMclStatusManager {
   public:
-    RfxMclStatusManager() : m_slot_id(RFX_SLOT_ID_UNKNOWN) {
-        for (int i = 0; i < RFX_STATUS_KEY_END_OF_ENUM; i++) {
-            m_status_list[i] = NULL;
-        }
-    }
+    RfxMclStatusManager() : m_slot_id(RFX_SLOT_ID_UNKNOWN), m_waiter_count(0) { initScalarList(); }
 
     explicit RfxMclStatusManager(int slot_id);
 
@@ -116,6 +116,9 @@ class RfxMclStatusManager {
     void setValueInternal(const RfxStatusKeyEnum key, const RfxVariant& value, bool force_notify,
                           bool is_default, bool is_status_sync, bool update_for_mock = false);
 
+    // block the caller until the bool value of key becomes value, an unset key returns at once
+    void waitForBoolValue(const RfxStatusKeyEnum key, bool value);
+
     int getSlotId() const { return m_slot_id; }
 
     static const RfxVariant& getDefaultValue(const RfxStatusKeyEnum key);
@@ -125,24 +128,52 @@ class RfxMclStatusManager {
     void updateValueToTelCore(int slot_id, const RfxStatusKeyEnum key, const RfxVariant value,
                               bool force_notify = false, bool is_default = false);
 
+    void initScalarList();
+
+    // type of the value of key and its bool/int/float/int64 bits, read without m_mutex
+    RfxVariant::ValueTypeEnum readScalar(const RfxStatusKeyEnum key, int64_t* bits) const;
+
+    // called with m_mutex[key] held
+    void writeScalar(const RfxStatusKeyEnum key, const RfxVariant& value);
+
   private:
-    typedef struct _StatusListEntry {
-        RfxVariant value;
-    } StatusListEntry;
+    // seqlock mirror of m_status_list, an odd seq means a write in progress
+    typedef struct _ScalarEntry {
+        std::atomic<uint32_t> seq;
+        std::atomic<int> type;
+        std::atomic<int64_t> bits;
+    } ScalarEntry;
 
   private:
     static RfxMclStatusManager* s_self[MAX_SIM_COUNT + 1];
     int m_slot_id;
-    StatusListEntry* m_status_list[RFX_STATUS_KEY_END_OF_ENUM];
+    RfxVariant m_status_list[RFX_STATUS_KEY_END_OF_ENUM];
     mutable Mutex m_mutex[RFX_STATUS_KEY_END_OF_ENUM];
+    ScalarEntry m_scalar_list[RFX_STATUS_KEY_END_OF_ENUM];
+
+    // waitForBoolValue() waiters, woken up by setValueInternal()
+    std::atomic<int> m_waiter_count;
+    Mutex m_wait_mutex;
+    Condition m_wait_condition;
 };
 
 inline bool RfxMclStatusManager::getBoolValue(const RfxStatusKeyEnum key,
                                               bool default_value) const {
+    int64_t bits;
+    RfxVariant::ValueTypeEnum type = readScalar(key, &bits);
+    if (type == RfxVariant::DATA_TYPE_BOOL) {
+        return bits != 0;
+    } else if (type == RfxVariant::DATA_TYPE_NULL) {
+        return default_value;
+    }
     return getValue(key, RfxVariant(default_value)).asBool();
 }
 
 inline bool RfxMclStatusManager::getBoolValue(const RfxStatusKeyEnum key) const {
+    int64_t bits;
+    if (readScalar(key, &bits) == RfxVariant::DATA_TYPE_BOOL) {
+        return bits != 0;
+    }
     return getValue(key).asBool();
 }
 
@@ -152,10 +183,21 @@ inline void RfxMclStatusManager::setBoolValue(const RfxStatusKeyEnum key, bool v
 }
 
 inline int RfxMclStatusManager::getIntValue(const RfxStatusKeyEnum key, int default_value) const {
+    int64_t bits;
+    RfxVariant::ValueTypeEnum type = readScalar(key, &bits);
+    if (type == RfxVariant::DATA_TYPE_INT) {
+        return (int)bits;
+    } else if (type == RfxVariant::DATA_TYPE_NULL) {
+        return default_value;
+    }
     return getValue(key, RfxVariant(default_value)).asInt();
 }
 
 inline int RfxMclStatusManager::getIntValue(const RfxStatusKeyEnum key) const {
+    int64_t bits;
+    if (readScalar(key, &bits) == RfxVariant::DATA_TYPE_INT) {
+        return (int)bits;
+    }
     return getValue(key).asInt();
 }
 
@@ -166,10 +208,27 @@ inline void RfxMclStatusManager::setIntValue(const RfxStatusKeyEnum key, int val
 
 inline float RfxMclStatusManager::getFloatValue(const RfxStatusKeyEnum key,
                                                 float default_value) const {
+    int64_t bits;
+    RfxVariant::ValueTypeEnum type = readScalar(key, &bits);
+    if (type == RfxVariant::DATA_TYPE_FLOAT) {
+        float value;
+        int32_t raw = (int32_t)bits;
+        memcpy(&value, &raw, sizeof(value));
+        return value;
+    } else if (type == RfxVariant::DATA_TYPE_NULL) {
+        return default_value;
+    }
     return getValue(key, RfxVariant(default_value)).asFloat();
 }
 
 inline float RfxMclStatusManager::getFloatValue(const RfxStatusKeyEnum key) const {
+    int64_t bits;
+    if (readScalar(key, &bits) == RfxVariant::DATA_TYPE_FLOAT) {
+        float value;
+        int32_t raw = (int32_t)bits;
+        memcpy(&value, &raw, sizeof(value));
+        return value;
+    }
     return getValue(key).asFloat();
 }
 
@@ -180,10 +239,21 @@ inline void RfxMclStatusManager::setFloatValue(const RfxStatusKeyEnum key, float
 
 inline int64_t RfxMclStatusManager::getInt64Value(const RfxStatusKeyEnum key,
                                                   int64_t default_value) const {
+    int64_t bits;
+    RfxVariant::ValueTypeEnum type = readScalar(key, &bits);
+    if (type == RfxVariant::DATA_TYPE_INT64) {
+        return bits;
+    } else if (type == RfxVariant::DATA_TYPE_NULL) {
+        return default_value;
+    }
     return getValue(key, RfxVariant(default_value)).asInt64();
 }
 
 inline int64_t RfxMclStatusManager::getInt64Value(const RfxStatusKeyEnum key) const {
+    int64_t bits;
+    if (readScalar(key, &bits) == RfxVariant::DATA_TYPE_INT64) {
+        return bits;
+    }
     return getValue(key).asInt64();
 }
 
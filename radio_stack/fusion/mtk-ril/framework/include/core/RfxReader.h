@@ -19,6 +19,8 @@
 
 #include <utils/Looper.h>
 #include <utils/threads.h>
+#include <utils/Timers.h>
+#include <inttypes.h>
 #include "utils/RefBase.h"
 #include "utils/String8.h"
 #include <string.h>
@@ -50,6 +52,10 @@ class RfxReader : public Thread {
     void setChannelContext(RfxChannelContext* context) { m_context = context; }
 
   private:
+    // wait points of readerLoop, for the wait time histogram
+    enum { WAIT_READER, WAIT_COMMAND, WAIT_SIM_SWITCH, WAIT_TYPE_COUNT };
+    enum { WAIT_BUCKET_COUNT = 6 };
+
     virtual bool threadLoop();
     void readerLoop();
     void readerLoopForFragData();
@@ -62,6 +68,8 @@ class RfxReader : public Thread {
     void handleUserDataEvent(int clientId, char* data, size_t length);
     void handleRequestAck();
     void printLog(int level, String8 log);
+    void lockReaderMutex();
+    void recordWaitTime(int type, nsecs_t start);
 
   private:
     sp<Looper> m_looper;
@@ -72,5 +80,7 @@ class RfxReader : public Thread {
     const char* mName;
     char* m_pATBufferCur;
     char m_aTBuffer[MAX_AT_RESPONSE + 1];
+    uint32_t m_waitHistogram[WAIT_TYPE_COUNT][WAIT_BUCKET_COUNT];
+    uint32_t m_waitCount;
 };
 #endif
@@ -39,6 +39,9 @@ typedef sp<MessageHandler> TimerHandle;
 
 class RfxTimer {
   public:
+    // called by RfxMainThread once its looper is prepared
+    static void init(const sp<Looper>& looper);
+
     static TimerHandle start(const RfxCallback0& callback, nsecs_t time);
 
     static void stop(const TimerHandle& timer_handle);
@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdio.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <utils/Mutex.h>
+#include <vector>
+
+#include "RfxMclStatusManager.h"
+
+namespace {
+
+// the keys are plain storage of a private manager here, their meaning in rild does not matter
+const RfxStatusKeyEnum kIntKey = RFX_STATUS_KEY_RADIO_STATE;
+const RfxStatusKeyEnum kInt64Key = RFX_STATUS_KEY_VOICE_TYPE;
+const RfxStatusKeyEnum kFloatKey = RFX_STATUS_KEY_DATA_TYPE;
+const RfxStatusKeyEnum kBoolKey = RFX_STATUS_KEY_MODEM_POWER_OFF;
+
+// status sync values are not mirrored back to TelCore, so no dispatcher is needed
+void setSynced(RfxMclStatusManager* manager, RfxStatusKeyEnum key, const RfxVariant& value) {
+    manager->setValueByRfx(key, value, false, false, true);
+}
+
+int64_t nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+// the store RfxMclStatusManager had before the seqlock, a Mutex per key and the variant copied
+// out under it, without the logs both have
+class MutexStatusStore {
+  public:
+    MutexStatusStore() {
+        for (int i = 0; i < RFX_STATUS_KEY_END_OF_ENUM; i++) {
+            m_status_list[i] = NULL;
+        }
+    }
+
+    ~MutexStatusStore() {
+        for (int i = 0; i < RFX_STATUS_KEY_END_OF_ENUM; i++) {
+            delete m_status_list[i];
+        }
+    }
+
+    void setValue(RfxStatusKeyEnum key, const RfxVariant& value) {
+        Mutex::Autolock autoLock(m_mutex[key]);
+        if (m_status_list[key] == NULL) {
+            m_status_list[key] = new RfxVariant(value);
+        } else if (*m_status_list[key] != value) {
+            *m_status_list[key] = value;
+        }
+    }
+
+    int getIntValue(RfxStatusKeyEnum key, int default_value) const {
+        Mutex::Autolock autoLock(m_mutex[key]);
+        return m_status_list[key] == NULL ? default_value : m_status_list[key]->asInt();
+    }
+
+    bool getBoolValue(RfxStatusKeyEnum key, bool default_value) const {
+        Mutex::Autolock autoLock(m_mutex[key]);
+        return m_status_list[key] == NULL ? default_value : m_status_list[key]->asBool();
+    }
+
+  private:
+    RfxVariant* m_status_list[RFX_STATUS_KEY_END_OF_ENUM];
+    mutable Mutex m_mutex[RFX_STATUS_KEY_END_OF_ENUM];
+};
+
+void setSynced(MutexStatusStore* store, RfxStatusKeyEnum key, const RfxVariant& value) {
+    store->setValue(key, value);
+}
+
+// the keys a SIM plug out and in and the RAT switches after it set
+const RfxStatusKeyEnum kChurnKeys[] = {
+        RFX_STATUS_KEY_SIM_INSERT_STATE, RFX_STATUS_KEY_CARD_TYPE,  RFX_STATUS_KEY_SIM_STATE,
+        RFX_STATUS_KEY_RADIO_STATE,      RFX_STATUS_KEY_VOICE_TYPE, RFX_STATUS_KEY_DATA_TYPE,
+        RFX_STATUS_KEY_PREFERRED_NW_TYPE};
+const int kChurnKeyCount = sizeof(kChurnKeys) / sizeof(kChurnKeys[0]);
+
+struct ChurnResult {
+    int64_t writeNs;
+    int64_t writes;
+    int64_t reads;
+    int64_t readNs;
+    int lastValue;
+};
+
+// one writer, the status sync of the RIL proxy, runs the hot plug bursts while the
+// readers, the handlers of the mcl channels, poll the keys and the modem power flag
+template <typename Store>
+ChurnResult runStatusChurn(Store* store, int bursts, int readerCount) {
+    for (int i = 0; i < kChurnKeyCount; i++) {
+        setSynced(store, kChurnKeys[i], RfxVariant(0));
+    }
+    setSynced(store, kBoolKey, RfxVariant(false));
+
+    std::atomic<bool> done(false);
+    std::atomic<int64_t> reads(0);
+    std::atomic<int64_t> readNs(0);
+    // keeps the reads from being optimized out
+    std::atomic<int> sink(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < readerCount; r++) {
+        readers.push_back(std::thread([&, r]() {
+            int64_t count = 0;
+            int sum = 0;
+            int64_t start = nowNs();
+            for (int i = r; !done.load(std::memory_order_relaxed); i++) {
+                sum += store->getIntValue(kChurnKeys[i % kChurnKeyCount], -1);
+                if (store->getBoolValue(kBoolKey, false)) {
+                    sum++;
+                }
+                count += 2;
+            }
+            readNs += nowNs() - start;
+            reads += count;
+            sink += sum;
+        }));
+    }
+
+    int64_t writes = 0;
+    int64_t start = nowNs();
+    for (int burst = 0; burst < bursts; burst++) {
+        // plug out, then in
+        for (int i = 0; i < 4; i++) {
+            setSynced(store, kChurnKeys[i], RfxVariant(0));
+        }
+        setSynced(store, kBoolKey, RfxVariant(true));
+        for (int i = 0; i < 4; i++) {
+            setSynced(store, kChurnKeys[i], RfxVariant(burst + i + 1));
+        }
+        setSynced(store, kBoolKey, RfxVariant(false));
+        writes += 10;
+        // RAT switches while camping, 2G/3G/4G, with the same values set again
+        for (int rat = 0; rat < 6; rat++) {
+            for (int i = 4; i < kChurnKeyCount; i++) {
+                setSynced(store, kChurnKeys[i], RfxVariant(rat % 3));
+            }
+            writes += kChurnKeyCount - 4;
+        }
+    }
+    int64_t writeNs = nowNs() - start;
+
+    done = true;
+    for (size_t r = 0; r < readers.size(); r++) {
+        readers[r].join();
+    }
+
+    ChurnResult result;
+    result.writeNs = writeNs;
+    result.writes = writes;
+    result.reads = reads.load();
+    result.readNs = readNs.load();
+    result.lastValue = store->getIntValue(kChurnKeys[0], -1);
+    return result;
+}
+
+TEST(RfxMclStatusManagerTest, ScalarGetters) {
+    RfxMclStatusManager manager(0);
+
+    EXPECT_EQ(7, manager.getIntValue(kIntKey, 7));
+    EXPECT_EQ(-1ll, manager.getInt64Value(kInt64Key, -1ll));
+    EXPECT_TRUE(manager.getBoolValue(kBoolKey, true));
+
+    setSynced(&manager, kIntKey, RfxVariant(3));
+    setSynced(&manager, kInt64Key, RfxVariant((int64_t)0x123456789all));
+    setSynced(&manager, kFloatKey, RfxVariant(-2.5f));
+    setSynced(&manager, kBoolKey, RfxVariant(false));
+
+    EXPECT_EQ(3, manager.getIntValue(kIntKey, 7));
+    EXPECT_EQ(3, manager.getIntValue(kIntKey));
+    EXPECT_EQ(0x123456789all, manager.getInt64Value(kInt64Key, -1ll));
+    EXPECT_EQ(-2.5f, manager.getFloatValue(kFloatKey, 0.0f));
+    EXPECT_FALSE(manager.getBoolValue(kBoolKey, true));
+    // the variant and the scalar mirror agree
+    EXPECT_EQ(3, manager.getValue(kIntKey).asInt());
+}
+
+TEST(RfxMclStatusManagerTest, FirstValueIsPublishedWhole) {
+    const int rounds = 20;
+    for (int round = 0; round < rounds; round++) {
+        RfxMclStatusManager* manager = new RfxMclStatusManager(0);
+        std::atomic<bool> ready(false);
+        std::atomic<int> torn(0);
+        // the reader follows the writer key by key, an unset key reads the default and a set
+        // one reads its value, never the type of the new value with the bits of the old one
+        std::thread reader([&]() {
+            ready = true;
+            for (int key = RFX_STATUS_KEY_START + 1; key < RFX_STATUS_KEY_END_OF_ENUM; key++) {
+                int value;
+                do {
+                    value = manager->getIntValue((RfxStatusKeyEnum)key, -1);
+                } while (value == -1);
+                if (value != key + round) {
+                    torn++;
+                }
+            }
+        });
+        while (!ready.load()) {
+        }
+        for (int key = RFX_STATUS_KEY_START + 1; key < RFX_STATUS_KEY_END_OF_ENUM; key++) {
+            setSynced(manager, (RfxStatusKeyEnum)key, RfxVariant(key + round));
+        }
+        reader.join();
+        delete manager;
+
+        ASSERT_EQ(0, torn.load()) << "round " << round;
+    }
+}
+
+TEST(RfxMclStatusManagerTest, ReadersSeeValuesInWriteOrder) {
+    RfxMclStatusManager manager(0);
+    const int writes = 5000;
+    setSynced(&manager, kIntKey, RfxVariant(0));
+    setSynced(&manager, kInt64Key, RfxVariant((int64_t)0));
+
+    std::atomic<bool> done(false);
+    std::atomic<int> backwards(0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 2; i++) {
+        readers.push_back(std::thread([&]() {
+            int last = 0;
+            int64_t last64 = 0;
+            while (!done.load()) {
+                // one writer, so a reader never sees an older value after a newer one
+                int count = manager.getIntValue(kIntKey);
+                int64_t count64 = manager.getInt64Value(kInt64Key);
+                if (count < last || count64 < last64) {
+                    backwards++;
+                }
+                last = count;
+                last64 = count64;
+            }
+        }));
+    }
+
+    for (int i = 1; i <= writes; i++) {
+        setSynced(&manager, kIntKey, RfxVariant(i));
+        setSynced(&manager, kInt64Key, RfxVariant((int64_t)i << 32));
+    }
+    done = true;
+    for (size_t i = 0; i < readers.size(); i++) {
+        readers[i].join();
+    }
+
+    EXPECT_EQ(0, backwards.load());
+    EXPECT_EQ(writes, manager.getIntValue(kIntKey));
+    EXPECT_EQ((int64_t)writes << 32, manager.getInt64Value(kInt64Key));
+}
+
+TEST(RfxMclStatusManagerTest, WaitForBoolValue) {
+    RfxMclStatusManager manager(0);
+
+    // an unset key returns at once
+    manager.waitForBoolValue(kBoolKey, true);
+
+    setSynced(&manager, kBoolKey, RfxVariant(false));
+    std::atomic<bool> woken(false);
+    std::thread waiter([&]() {
+        manager.waitForBoolValue(kBoolKey, true);
+        woken = true;
+    });
+
+    usleep(50 * 1000);
+    EXPECT_FALSE(woken.load());
+    // a change of another key wakes it up to wait again
+    setSynced(&manager, kIntKey, RfxVariant(1));
+    usleep(50 * 1000);
+    EXPECT_FALSE(woken.load());
+
+    setSynced(&manager, kBoolKey, RfxVariant(true));
+    waiter.join();
+    EXPECT_TRUE(woken.load());
+}
+
+TEST(RfxMclStatusManagerTest, SimHotPlugChurnBenchmark) {
+    const int bursts = 20000;
+    const int readerCount = 3;
+
+    MutexStatusStore mutexStore;
+    ChurnResult before = runStatusChurn(&mutexStore, bursts, readerCount);
+    RfxMclStatusManager manager(0);
+    ChurnResult after = runStatusChurn(&manager, bursts, readerCount);
+
+    EXPECT_EQ(bursts, before.lastValue);
+    EXPECT_EQ(bursts, after.lastValue);
+    EXPECT_EQ(bursts, manager.getIntValue(kChurnKeys[0]));
+    printf("%d hot plug bursts, %d readers: Mutex per key %.1f ns/write %.1f ns/read, "
+           "seqlock %.1f ns/write %.1f ns/read\n",
+           bursts, readerCount, (double)before.writeNs / before.writes,
+           (double)before.readNs / before.reads, (double)after.writeNs / after.writes,
+           (double)after.readNs / after.reads);
+}
+
+}  // namespace
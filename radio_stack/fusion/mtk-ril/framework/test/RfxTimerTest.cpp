@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+
+#include "RfxMainThread.h"
+#include "RfxObject.h"
+#include "RfxTimer.h"
+
+using ::android::Message;
+
+/*****************************************************************************
+ * Main thread of the test
+ *****************************************************************************/
+// RfxTimer.cpp is built into the test, the test thread polls the looper of the wheel as the
+// main thread does, without the controllers and the async signal queue of a running rild
+static sp<Looper> sLooper;
+
+sp<Looper> RfxMainThread::getLooper() { return sLooper; }
+
+void RfxMainHandler::handleMessage(const Message& message) { onHandleMessage(message); }
+
+namespace {
+
+std::vector<int> sFired;
+
+class TimerTarget : public RfxObject {
+  public:
+    explicit TimerTarget(int id) : m_id(id), m_start_time(0), m_delay(0), m_fired_time(0) {}
+
+    void start(nsecs_t delay) {
+        m_start_time = systemTime(SYSTEM_TIME_MONOTONIC);
+        m_delay = delay;
+        m_handle = RfxTimer::start(RfxCallback0(this, &TimerTarget::onTimer), delay);
+    }
+
+    // the handle of a timer to stop from the callback
+    void stopOnFire(const TimerHandle& handle) { m_stop_handle = handle; }
+
+    void onTimer() {
+        m_fired_time = systemTime(SYSTEM_TIME_MONOTONIC);
+        sFired.push_back(m_id);
+        if (m_stop_handle != NULL) {
+            RfxTimer::stop(m_stop_handle);
+        }
+    }
+
+    nsecs_t deadline() const { return m_start_time + m_delay; }
+
+  public:
+    int m_id;
+    nsecs_t m_start_time;
+    nsecs_t m_delay;
+    nsecs_t m_fired_time;
+    TimerHandle m_handle;
+    TimerHandle m_stop_handle;
+};
+
+// the TimerHandler of RfxTimer before the wheel, one delayed message of the main looper per
+// timer, stopped by removeMessages
+class LooperTimerHandler : public RfxMainHandler {
+  public:
+    LooperTimerHandler(const RfxCallback0& _callback) : callback(_callback) {}
+    virtual ~LooperTimerHandler() {}
+
+  protected:
+    virtual void onHandleMessage(const Message& message) {
+        RFX_UNUSED(message);
+        callback.invoke();
+    }
+
+  private:
+    RfxCallback0 callback;
+};
+
+struct WheelTimers {
+    static TimerHandle start(const RfxCallback0& callback, nsecs_t time) {
+        return RfxTimer::start(callback, time);
+    }
+
+    static void stop(const TimerHandle& handle) { RfxTimer::stop(handle); }
+};
+
+struct LooperTimers {
+    static TimerHandle start(const RfxCallback0& callback, nsecs_t time) {
+        Message dummy_msg;
+        sp<MessageHandler> handler = new LooperTimerHandler(callback);
+        sLooper->sendMessageDelayed(time, handler, dummy_msg);
+        return handler;
+    }
+
+    static void stop(const TimerHandle& handle) { sLooper->removeMessages(handle); }
+};
+
+// poll the looper until count timers fired in total or timeoutMs passed
+void pollFired(size_t count, int timeoutMs = 3000) {
+    nsecs_t deadline = systemTime(SYSTEM_TIME_MONOTONIC) + ms2ns(timeoutMs);
+    while (sFired.size() < count) {
+        nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+        if (now >= deadline) {
+            break;
+        }
+        sLooper->pollOnce(toMillisecondTimeoutDelay(now, deadline));
+    }
+}
+
+class RfxTimerTest : public ::testing::Test {
+  protected:
+    // one wheel for the process, as rild has
+    static void SetUpTestSuite() {
+        sLooper = new Looper(false);
+        RfxTimer::init(sLooper);
+    }
+
+    virtual void SetUp() { sFired.clear(); }
+};
+
+TEST_F(RfxTimerTest, FiresInDelayOrderAndNeverEarly) {
+    // 700 and 1300 ms are beyond the 64 ticks of level 0 and cascade down
+    const int delays[] = {700, 0, 250, 1300, 30, 60};
+    const int count = sizeof(delays) / sizeof(delays[0]);
+    std::vector<sp<TimerTarget> > targets;
+    for (int i = 0; i < count; i++) {
+        targets.push_back(new TimerTarget(i));
+        targets[i]->start(ms2ns(delays[i]));
+        ASSERT_TRUE(targets[i]->m_handle != NULL);
+    }
+
+    pollFired(count);
+
+    std::vector<int> expected = {1, 4, 5, 2, 0, 3};
+    EXPECT_EQ(expected, sFired);
+    for (int i = 0; i < count; i++) {
+        EXPECT_GE(targets[i]->m_fired_time, targets[i]->deadline()) << "timer " << i;
+    }
+}
+
+TEST_F(RfxTimerTest, StoppedTimerNeverFires) {
+    sp<TimerTarget> stopped = new TimerTarget(0);
+    sp<TimerTarget> kept = new TimerTarget(1);
+    stopped->start(ms2ns(50));
+    kept->start(ms2ns(100));
+    RfxTimer::stop(stopped->m_handle);
+    // stopping twice is harmless
+    RfxTimer::stop(stopped->m_handle);
+
+    pollFired(1);
+    pollFired(2, 200);
+
+    EXPECT_EQ(std::vector<int>{1}, sFired);
+    // stopping a fired timer is harmless
+    RfxTimer::stop(kept->m_handle);
+}
+
+TEST_F(RfxTimerTest, CallbackStopsTimerOfTheSameTick) {
+    sp<TimerTarget> first = new TimerTarget(0);
+    sp<TimerTarget> second = new TimerTarget(1);
+    first->start(ms2ns(20));
+    second->start(ms2ns(20));
+    first->stopOnFire(second->m_handle);
+
+    pollFired(1);
+    pollFired(2, 200);
+
+    EXPECT_EQ(std::vector<int>{0}, sFired);
+}
+
+TEST_F(RfxTimerTest, StartsFromIdleWheel) {
+    // the ticks passed without a timer are skipped, the next one is not fired at once
+    usleep(300 * 1000);
+    sp<TimerTarget> target = new TimerTarget(0);
+    target->start(ms2ns(100));
+
+    pollFired(1);
+
+    ASSERT_EQ(std::vector<int>{0}, sFired);
+    EXPECT_GE(target->m_fired_time, target->deadline());
+}
+
+TEST_F(RfxTimerTest, RandomDelays) {
+    const int count = 200;
+    srand(7);
+    std::vector<sp<TimerTarget> > targets;
+    for (int i = 0; i < count; i++) {
+        targets.push_back(new TimerTarget(i));
+        targets[i]->start(ms2ns(rand() % 1500));
+    }
+
+    pollFired(count);
+
+    ASSERT_EQ((size_t)count, sFired.size());
+    for (int i = 0; i < count; i++) {
+        EXPECT_GE(targets[i]->m_fired_time, targets[i]->deadline()) << "timer " << i;
+    }
+    // timers of one 10 ms tick fire together in any order, earlier ticks fire first
+    for (int i = 1; i < count; i++) {
+        EXPECT_LE(targets[sFired[i - 1]]->deadline(), targets[sFired[i]]->deadline() + ms2ns(10))
+                << "timer " << sFired[i - 1] << " fired before " << sFired[i];
+    }
+}
+
+// a started guard timer of each request in flight, stopped when its response comes
+const int kChurnInFlight = 16;
+const int kChurnRequests = 20000;
+// long guard timers left in the queue, as of the modules waiting on URCs
+const int kChurnPending = 1000;
+const int kChurnFired = 200;
+
+struct ChurnResult {
+    nsecs_t churnNs;
+    std::vector<int> fired;
+};
+
+// start and stop churn of request guard timers with kChurnPending timers pending, then a batch
+// of short timers with every third one stopped, the rest fire
+template <class Timers>
+ChurnResult runTimerChurn() {
+    ChurnResult result;
+    sp<TimerTarget> churnTarget = new TimerTarget(-1);
+    RfxCallback0 churnCallback(churnTarget.get(), &TimerTarget::onTimer);
+    srand(11);
+
+    std::vector<TimerHandle> pending;
+    for (int i = 0; i < kChurnPending; i++) {
+        pending.push_back(Timers::start(churnCallback, ms2ns(60000 + rand() % 60000)));
+    }
+
+    std::vector<TimerHandle> inFlight(kChurnInFlight);
+    nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+    for (int i = 0; i < kChurnRequests; i++) {
+        TimerHandle& slot = inFlight[i % kChurnInFlight];
+        if (slot != NULL) {
+            Timers::stop(slot);
+        }
+        slot = Timers::start(churnCallback, ms2ns(5000 + rand() % 25000));
+    }
+    result.churnNs = systemTime(SYSTEM_TIME_MONOTONIC) - start;
+
+    sFired.clear();
+    std::vector<sp<TimerTarget> > targets;
+    std::vector<TimerHandle> handles;
+    size_t expected = 0;
+    for (int i = 0; i < kChurnFired; i++) {
+        targets.push_back(new TimerTarget(i));
+        handles.push_back(
+                Timers::start(RfxCallback0(targets[i].get(), &TimerTarget::onTimer),
+                              ms2ns(rand() % 200)));
+    }
+    for (int i = 0; i < kChurnFired; i++) {
+        if (i % 3 == 0) {
+            Timers::stop(handles[i]);
+        } else {
+            expected++;
+        }
+    }
+    pollFired(expected);
+    pollFired(expected + 1, 100);
+    result.fired = sFired;
+    std::sort(result.fired.begin(), result.fired.end());
+
+    for (int i = 0; i < kChurnInFlight; i++) {
+        Timers::stop(inFlight[i]);
+    }
+    for (int i = 0; i < kChurnPending; i++) {
+        Timers::stop(pending[i]);
+    }
+    return result;
+}
+
+TEST_F(RfxTimerTest, TimerChurnBenchmark) {
+    ChurnResult looper = runTimerChurn<LooperTimers>();
+    ChurnResult wheel = runTimerChurn<WheelTimers>();
+
+    ASSERT_EQ((size_t)(kChurnFired - (kChurnFired + 2) / 3), wheel.fired.size());
+    EXPECT_EQ(looper.fired, wheel.fired);
+    printf("%d timers pending, start and stop of a request timer: looper %.1f ns, wheel %.1f ns\n",
+           kChurnPending, (double)looper.churnNs / kChurnRequests,
+           (double)wheel.churnNs / kChurnRequests);
+}
+
+}  // namespace
@@ -181,10 +181,8 @@ void RmcCapabilitySwitchRequestHandler::requestSetRadioCapability(const sp<RfxMc
         }
 
         // wait for URC channel switch done
-        while (getNonSlotMclStatusManager()->getBoolValue(
-                RFX_STATUS_KEY_CAPABILITY_SWITCH_URC_CHANNEL, false)) {
-            usleep(100 * 1000);
-        }
+        getNonSlotMclStatusManager()->waitForBoolValue(RFX_STATUS_KEY_CAPABILITY_SWITCH_URC_CHANNEL,
+                                                       false);
 
         if (RfxRilUtils::getRilRunMode() != RIL_RUN_MODE_MOCK) {
             queryActiveMode();
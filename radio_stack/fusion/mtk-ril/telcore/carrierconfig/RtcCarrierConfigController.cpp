@@ -208,8 +208,30 @@ void RtcCarrierConfigController::loadConfiguration(const char* mccmnc) {
     RfxStatusKeyEnum key;
     String8 defaultValue;
 
+    /* Use the values in the constant table of libcarrierconfig directly if supported */
+    fnGetConstValuesByMccMnc =
+            (decltype(fnGetConstValuesByMccMnc))dlsym(dlHandle, "getConstValuesByMccMnc");
+    if (fnGetConstValuesByMccMnc != NULL) {
+        unsigned int constCount = 0;
+        const CarrierConfigValue* values = fnGetConstValuesByMccMnc(mccmnc, &constCount);
+        RFX_LOG_D(RFX_LOG_TAG, "getConstValuesByMccMnc for %s = %u", mccmnc, constCount);
+        for (unsigned int i = 0; i < constCount; i++) {
+            key = (RfxStatusKeyEnum)values[i].key;
+            getStatusManager()->setString8Value(key, String8(values[i].value));
+            defaultValue = getStatusManager()->getDefaultValue(key).asString8();
+            RFX_LOG_D(RFX_LOG_TAG, "key = %s, default value = %s, new value = %s",
+                      RfxStatusManager::getKeyString(key), defaultValue.string(),
+                      getStatusManager()->getString8Value(key).string());
+        }
+        if (constCount > 0) {
+            getStatusManager()->setString8Value(RFX_STATUS_KEY_CARRIER_CONFIG_CHANGED,
+                                                String8(mccmnc));
+            return;
+        }
+    }
+
     /* getKeyCount function pointer */
-    fnGetKeyCount = (unsigned int (*)(const char*))dlsym(dlHandle, "getKeyCount");
+    fnGetKeyCount = (decltype(fnGetKeyCount))dlsym(dlHandle, "getKeyCount");
     if (fnGetKeyCount == NULL) {
         RFX_LOG_E(RFX_LOG_TAG, "getKeyCount function in libcarrierconfig is not defined!");
     } else {
@@ -221,7 +243,7 @@ void RtcCarrierConfigController::loadConfiguration(const char* mccmnc) {
     if (count > 0) {
         /* Load carrier config value */
         fnGetValuesByMccMnc =
-                (int (*)(const char*, CarrierConfigValue*))dlsym(dlHandle, "getValuesByMccMnc");
+                (decltype(fnGetValuesByMccMnc))dlsym(dlHandle, "getValuesByMccMnc");
         if (fnGetValuesByMccMnc == NULL) {
             RFX_LOG_D(RFX_LOG_TAG, "getValueByKey function in libcarrierconfig is not defined!");
         } else {
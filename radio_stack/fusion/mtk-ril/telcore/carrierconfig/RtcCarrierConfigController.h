@@ -53,8 +53,9 @@ class RtcCarrierConfigController : public RfxController {
 
     /* Native Carrier Config */
     void* dlHandle;
-    unsigned int (*fnGetKeyCount)(const char*);
-    int (*fnGetValuesByMccMnc)(const char*, CarrierConfigValue*);
+    decltype(&getKeyCount) fnGetKeyCount;
+    decltype(&getValuesByMccMnc) fnGetValuesByMccMnc;
+    decltype(&getConstValuesByMccMnc) fnGetConstValuesByMccMnc;
     void freeCarrierConfigValue(CarrierConfigValue* data, int count);
 };
 
@@ -51,4 +51,28 @@ LOCAL_C_INCLUDES := \
     vendor/mediatek/ims/radio_stack/platformlib/include/property \
     vendor/mediatek/ims/radio_stack/platformlib/include/log
 
+gsm0710muxd_cflags := $(LOCAL_CFLAGS)
+gsm0710muxd_c_includes := $(LOCAL_C_INCLUDES)
+
 include $(BUILD_EXECUTABLE)
+
+# frame path from the serial device to a pty, run with: atest gsm0710muxd_test
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := gsm0710muxd_test
+LOCAL_PROPRIETARY_MODULE := true
+LOCAL_MODULE_OWNER := mtk
+LOCAL_MULTILIB := 32
+
+LOCAL_SRC_FILES := \
+    src/gsm0710muxd_fc.c \
+    test/gsm0710muxd_test_hooks.c \
+    test/gsm0710muxd_pty_test.cpp
+
+LOCAL_SHARED_LIBRARIES := \
+    libmtkcutils libmtkrillog libmtkproperty
+
+LOCAL_CFLAGS := $(gsm0710muxd_cflags)
+LOCAL_C_INCLUDES := $(gsm0710muxd_c_includes)
+
+include $(BUILD_NATIVE_TEST)
@@ -37,11 +37,17 @@
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
 #include <termios.h>
 #include <time.h>
 #include <unistd.h>
 #include <pthread.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 #ifdef MUX_ANDROID
 //#include <pathconf.h>
@@ -87,6 +93,8 @@ int watchdog(Serial* serial);
 int create_thread(pthread_t* thread_id, void* thread_function, void* thread_function_arg);
 int write_frame(int channel, const unsigned char* input, int length, unsigned char type);
 void destroy_frame(GSM0710_Frame* frame);
+int gsm0710_frame_linearize(GSM0710_Frame* frame);
+int gsm0710_frame_detach(GSM0710_Frame* frame);
 
 /******************************************************************************/
 
@@ -95,7 +103,7 @@ extern void _fc_chokePty(Channel* channel);
 extern void _fc_releasePty(Channel* channel);
 extern void _fc_initContext(Channel* channel);
 extern void _fc_closeContext(Channel* channel);
-extern void _fc_cacheRemainingFrameData(Channel* channel, GSM0710_Frame* frame, int written);
+extern int _fc_cacheRemainingFrameData(Channel* channel, GSM0710_Frame* frame, int written);
 extern void _fc_cacheFrameData(Channel* channel, GSM0710_Frame* frame);
 extern void start_retry_write_thread(Channel* channel);
 #endif /* __MUXD_FLOWCONTROL__ */
@@ -157,6 +165,74 @@ static const unsigned char r_crctable[] = {
         0xCF,
 };
 
+/*
+ * slice-by-4 tables of r_crctable: r_crctable_n[k][i] is r_crctable applied k + 2 times,
+ * i.e. the crc contribution of byte i followed by k + 1 bytes. The crc is linear, so
+ * 4 bytes can be folded with one lookup per byte instead of 4 dependent lookups.
+ */
+static const unsigned char r_crctable_n[3][256] = {
+        {
+                0x00, 0x6D, 0xDA, 0xB7, 0x75, 0x18, 0xAF, 0xC2, 0xEA, 0x87, 0x30, 0x5D, 0x9F, 0xF2, 0x45,
+                0x28, 0x15, 0x78, 0xCF, 0xA2, 0x60, 0x0D, 0xBA, 0xD7, 0xFF, 0x92, 0x25, 0x48, 0x8A, 0xE7,
+                0x50, 0x3D, 0x2A, 0x47, 0xF0, 0x9D, 0x5F, 0x32, 0x85, 0xE8, 0xC0, 0xAD, 0x1A, 0x77, 0xB5,
+                0xD8, 0x6F, 0x02, 0x3F, 0x52, 0xE5, 0x88, 0x4A, 0x27, 0x90, 0xFD, 0xD5, 0xB8, 0x0F, 0x62,
+                0xA0, 0xCD, 0x7A, 0x17, 0x54, 0x39, 0x8E, 0xE3, 0x21, 0x4C, 0xFB, 0x96, 0xBE, 0xD3, 0x64,
+                0x09, 0xCB, 0xA6, 0x11, 0x7C, 0x41, 0x2C, 0x9B, 0xF6, 0x34, 0x59, 0xEE, 0x83, 0xAB, 0xC6,
+                0x71, 0x1C, 0xDE, 0xB3, 0x04, 0x69, 0x7E, 0x13, 0xA4, 0xC9, 0x0B, 0x66, 0xD1, 0xBC, 0x94,
+                0xF9, 0x4E, 0x23, 0xE1, 0x8C, 0x3B, 0x56, 0x6B, 0x06, 0xB1, 0xDC, 0x1E, 0x73, 0xC4, 0xA9,
+                0x81, 0xEC, 0x5B, 0x36, 0xF4, 0x99, 0x2E, 0x43, 0xA8, 0xC5, 0x72, 0x1F, 0xDD, 0xB0, 0x07,
+                0x6A, 0x42, 0x2F, 0x98, 0xF5, 0x37, 0x5A, 0xED, 0x80, 0xBD, 0xD0, 0x67, 0x0A, 0xC8, 0xA5,
+                0x12, 0x7F, 0x57, 0x3A, 0x8D, 0xE0, 0x22, 0x4F, 0xF8, 0x95, 0x82, 0xEF, 0x58, 0x35, 0xF7,
+                0x9A, 0x2D, 0x40, 0x68, 0x05, 0xB2, 0xDF, 0x1D, 0x70, 0xC7, 0xAA, 0x97, 0xFA, 0x4D, 0x20,
+                0xE2, 0x8F, 0x38, 0x55, 0x7D, 0x10, 0xA7, 0xCA, 0x08, 0x65, 0xD2, 0xBF, 0xFC, 0x91, 0x26,
+                0x4B, 0x89, 0xE4, 0x53, 0x3E, 0x16, 0x7B, 0xCC, 0xA1, 0x63, 0x0E, 0xB9, 0xD4, 0xE9, 0x84,
+                0x33, 0x5E, 0x9C, 0xF1, 0x46, 0x2B, 0x03, 0x6E, 0xD9, 0xB4, 0x76, 0x1B, 0xAC, 0xC1, 0xD6,
+                0xBB, 0x0C, 0x61, 0xA3, 0xCE, 0x79, 0x14, 0x3C, 0x51, 0xE6, 0x8B, 0x49, 0x24, 0x93, 0xFE,
+                0xC3, 0xAE, 0x19, 0x74, 0xB6, 0xDB, 0x6C, 0x01, 0x29, 0x44, 0xF3, 0x9E, 0x5C, 0x31, 0x86,
+                0xEB,
+        },
+        {
+                0x00, 0xD0, 0x61, 0xB1, 0xC2, 0x12, 0xA3, 0x73, 0x45, 0x95, 0x24, 0xF4, 0x87, 0x57, 0xE6,
+                0x36, 0x8A, 0x5A, 0xEB, 0x3B, 0x48, 0x98, 0x29, 0xF9, 0xCF, 0x1F, 0xAE, 0x7E, 0x0D, 0xDD,
+                0x6C, 0xBC, 0xD5, 0x05, 0xB4, 0x64, 0x17, 0xC7, 0x76, 0xA6, 0x90, 0x40, 0xF1, 0x21, 0x52,
+                0x82, 0x33, 0xE3, 0x5F, 0x8F, 0x3E, 0xEE, 0x9D, 0x4D, 0xFC, 0x2C, 0x1A, 0xCA, 0x7B, 0xAB,
+                0xD8, 0x08, 0xB9, 0x69, 0x6B, 0xBB, 0x0A, 0xDA, 0xA9, 0x79, 0xC8, 0x18, 0x2E, 0xFE, 0x4F,
+                0x9F, 0xEC, 0x3C, 0x8D, 0x5D, 0xE1, 0x31, 0x80, 0x50, 0x23, 0xF3, 0x42, 0x92, 0xA4, 0x74,
+                0xC5, 0x15, 0x66, 0xB6, 0x07, 0xD7, 0xBE, 0x6E, 0xDF, 0x0F, 0x7C, 0xAC, 0x1D, 0xCD, 0xFB,
+                0x2B, 0x9A, 0x4A, 0x39, 0xE9, 0x58, 0x88, 0x34, 0xE4, 0x55, 0x85, 0xF6, 0x26, 0x97, 0x47,
+                0x71, 0xA1, 0x10, 0xC0, 0xB3, 0x63, 0xD2, 0x02, 0xD6, 0x06, 0xB7, 0x67, 0x14, 0xC4, 0x75,
+                0xA5, 0x93, 0x43, 0xF2, 0x22, 0x51, 0x81, 0x30, 0xE0, 0x5C, 0x8C, 0x3D, 0xED, 0x9E, 0x4E,
+                0xFF, 0x2F, 0x19, 0xC9, 0x78, 0xA8, 0xDB, 0x0B, 0xBA, 0x6A, 0x03, 0xD3, 0x62, 0xB2, 0xC1,
+                0x11, 0xA0, 0x70, 0x46, 0x96, 0x27, 0xF7, 0x84, 0x54, 0xE5, 0x35, 0x89, 0x59, 0xE8, 0x38,
+                0x4B, 0x9B, 0x2A, 0xFA, 0xCC, 0x1C, 0xAD, 0x7D, 0x0E, 0xDE, 0x6F, 0xBF, 0xBD, 0x6D, 0xDC,
+                0x0C, 0x7F, 0xAF, 0x1E, 0xCE, 0xF8, 0x28, 0x99, 0x49, 0x3A, 0xEA, 0x5B, 0x8B, 0x37, 0xE7,
+                0x56, 0x86, 0xF5, 0x25, 0x94, 0x44, 0x72, 0xA2, 0x13, 0xC3, 0xB0, 0x60, 0xD1, 0x01, 0x68,
+                0xB8, 0x09, 0xD9, 0xAA, 0x7A, 0xCB, 0x1B, 0x2D, 0xFD, 0x4C, 0x9C, 0xEF, 0x3F, 0x8E, 0x5E,
+                0xE2, 0x32, 0x83, 0x53, 0x20, 0xF0, 0x41, 0x91, 0xA7, 0x77, 0xC6, 0x16, 0x65, 0xB5, 0x04,
+                0xD4,
+        },
+        {
+                0x00, 0x8C, 0xD9, 0x55, 0x73, 0xFF, 0xAA, 0x26, 0xE6, 0x6A, 0x3F, 0xB3, 0x95, 0x19, 0x4C,
+                0xC0, 0x0D, 0x81, 0xD4, 0x58, 0x7E, 0xF2, 0xA7, 0x2B, 0xEB, 0x67, 0x32, 0xBE, 0x98, 0x14,
+                0x41, 0xCD, 0x1A, 0x96, 0xC3, 0x4F, 0x69, 0xE5, 0xB0, 0x3C, 0xFC, 0x70, 0x25, 0xA9, 0x8F,
+                0x03, 0x56, 0xDA, 0x17, 0x9B, 0xCE, 0x42, 0x64, 0xE8, 0xBD, 0x31, 0xF1, 0x7D, 0x28, 0xA4,
+                0x82, 0x0E, 0x5B, 0xD7, 0x34, 0xB8, 0xED, 0x61, 0x47, 0xCB, 0x9E, 0x12, 0xD2, 0x5E, 0x0B,
+                0x87, 0xA1, 0x2D, 0x78, 0xF4, 0x39, 0xB5, 0xE0, 0x6C, 0x4A, 0xC6, 0x93, 0x1F, 0xDF, 0x53,
+                0x06, 0x8A, 0xAC, 0x20, 0x75, 0xF9, 0x2E, 0xA2, 0xF7, 0x7B, 0x5D, 0xD1, 0x84, 0x08, 0xC8,
+                0x44, 0x11, 0x9D, 0xBB, 0x37, 0x62, 0xEE, 0x23, 0xAF, 0xFA, 0x76, 0x50, 0xDC, 0x89, 0x05,
+                0xC5, 0x49, 0x1C, 0x90, 0xB6, 0x3A, 0x6F, 0xE3, 0x68, 0xE4, 0xB1, 0x3D, 0x1B, 0x97, 0xC2,
+                0x4E, 0x8E, 0x02, 0x57, 0xDB, 0xFD, 0x71, 0x24, 0xA8, 0x65, 0xE9, 0xBC, 0x30, 0x16, 0x9A,
+                0xCF, 0x43, 0x83, 0x0F, 0x5A, 0xD6, 0xF0, 0x7C, 0x29, 0xA5, 0x72, 0xFE, 0xAB, 0x27, 0x01,
+                0x8D, 0xD8, 0x54, 0x94, 0x18, 0x4D, 0xC1, 0xE7, 0x6B, 0x3E, 0xB2, 0x7F, 0xF3, 0xA6, 0x2A,
+                0x0C, 0x80, 0xD5, 0x59, 0x99, 0x15, 0x40, 0xCC, 0xEA, 0x66, 0x33, 0xBF, 0x5C, 0xD0, 0x85,
+                0x09, 0x2F, 0xA3, 0xF6, 0x7A, 0xBA, 0x36, 0x63, 0xEF, 0xC9, 0x45, 0x10, 0x9C, 0x51, 0xDD,
+                0x88, 0x04, 0x22, 0xAE, 0xFB, 0x77, 0xB7, 0x3B, 0x6E, 0xE2, 0xC4, 0x48, 0x1D, 0x91, 0x46,
+                0xCA, 0x9F, 0x13, 0x35, 0xB9, 0xEC, 0x60, 0xA0, 0x2C, 0x79, 0xF5, 0xD3, 0x5F, 0x0A, 0x86,
+                0x4B, 0xC7, 0x92, 0x1E, 0x38, 0xB4, 0xE1, 0x6D, 0xAD, 0x21, 0x74, 0xF8, 0xDE, 0x52, 0x07,
+                0x8B,
+        },
+};
+
 /******************************************************************************/
 #ifdef MUX_ANDROID
 
@@ -499,6 +575,24 @@ static int baud_rate_index(int baud_rate) {
     return -1;
 }
 
+/*
+ * Purpose:  Feeds given characters into a running frame check sequence.
+ * Input:     fcs - current fcs register, 0xFF at frame start
+ *           input - character array
+ *           length - number of characters in array (that are included)
+ * Return:   updated fcs register
+ */
+static unsigned char frame_update_crc(unsigned char fcs, const unsigned char* input, int length) {
+    int i = 0;
+
+    for (; i + 4 <= length; i += 4)
+        fcs = r_crctable_n[2][fcs ^ input[i]] ^ r_crctable_n[1][input[i + 1]] ^
+              r_crctable_n[0][input[i + 2]] ^ r_crctable[input[i + 3]];
+    for (; i < length; i++) fcs = r_crctable[fcs ^ input[i]];
+
+    return fcs;
+}
+
 /*
  * Purpose:  Calculates frame check sequence from given characters.
  * Input:     input - character array
@@ -506,12 +600,59 @@ static int baud_rate_index(int baud_rate) {
  * Return:   frame check sequence
  */
 unsigned char frame_calc_crc(const unsigned char* input, int length) {
-    unsigned char fcs = 0xFF;
+    return 0xFF - frame_update_crc(0xFF, input, length);
+}
 
-    int i;
-    for (i = 0; i < length; i++) fcs = r_crctable[fcs ^ input[i]];
+/*
+ * GSM0710_FRAME_ADV_ESCAPED_SYMS are Flag, Escape and XON/XOFF with or without bit 8 and 2,
+ * the last four are exactly the chars with (c & ADV_XONXOFF_MASK) == ADV_XONXOFF.
+ */
+#define ADV_XONXOFF_MASK 0x7D
+#define ADV_XONXOFF 0x11
+#define IS_ADV_ESCAPED_SYM(c)                                           \
+    ((c) == GSM0710_FRAME_ADV_FLAG || (c) == GSM0710_FRAME_ADV_ESC || \
+     ((c) & ADV_XONXOFF_MASK) == ADV_XONXOFF)
+
+/*
+ * Purpose:  Finds the first char to be escaped, 16 chars at a time with SSE2/NEON.
+ * Input:     data - pointer to the char buffer to be parsed
+ *           length - the length of the data char buffer
+ * Return:   index of the first GSM0710_FRAME_ADV_ESCAPED_SYMS char, length if none
+ */
+static int find_adv_escaped_sym(const unsigned char* data, int length) {
+    int i = 0;
 
-    return 0xFF - fcs;
+#if defined(__SSE2__)
+    const __m128i flag = _mm_set1_epi8((char)GSM0710_FRAME_ADV_FLAG);
+    const __m128i esc = _mm_set1_epi8((char)GSM0710_FRAME_ADV_ESC);
+    const __m128i mask = _mm_set1_epi8((char)ADV_XONXOFF_MASK);
+    const __m128i xonxoff = _mm_set1_epi8((char)ADV_XONXOFF);
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i hit = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(v, flag), _mm_cmpeq_epi8(v, esc)),
+                _mm_cmpeq_epi8(_mm_and_si128(v, mask), xonxoff));
+        int bits = _mm_movemask_epi8(hit);
+        if (bits != 0) return i + __builtin_ctz(bits);
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const uint8x16_t flag = vdupq_n_u8(GSM0710_FRAME_ADV_FLAG);
+    const uint8x16_t esc = vdupq_n_u8(GSM0710_FRAME_ADV_ESC);
+    const uint8x16_t mask = vdupq_n_u8(ADV_XONXOFF_MASK);
+    const uint8x16_t xonxoff = vdupq_n_u8(ADV_XONXOFF);
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t v = vld1q_u8(data + i);
+        uint8x16_t hit = vorrq_u8(vorrq_u8(vceqq_u8(v, flag), vceqq_u8(v, esc)),
+                                  vceqq_u8(vandq_u8(v, mask), xonxoff));
+        uint64x2_t hit64 = vreinterpretq_u64_u8(hit);
+        /* the exact position is found by the scalar loop below */
+        if ((vgetq_lane_u64(hit64, 0) | vgetq_lane_u64(hit64, 1)) != 0) break;
+    }
+#endif
+
+    for (; i < length; i++)
+        if (IS_ADV_ESCAPED_SYM(data[i])) break;
+    return i;
 }
 
 /*
@@ -522,19 +663,18 @@ unsigned char frame_calc_crc(const unsigned char* input, int length) {
  * Return:   adv_i - number of added escape chars
  */
 static int fill_adv_frame_buf(unsigned char* adv_buf, const unsigned char* data, int length) {
-    static const unsigned char esc[] = GSM0710_FRAME_ADV_ESCAPED_SYMS;
-    int i, adv_i = 0;
-    unsigned int esc_i;
-
-    for (i = 0; i < length; ++i, ++adv_i) {
-        adv_buf[adv_i] = data[i];
-        for (esc_i = 0; esc_i < sizeof(esc) / sizeof(esc[0]); ++esc_i)
-            if (data[i] == esc[esc_i]) {
-                adv_buf[adv_i] = GSM0710_FRAME_ADV_ESC;
-                adv_i++;
-                adv_buf[adv_i] = data[i] ^ GSM0710_FRAME_ADV_ESC_COPML;
-                break;
-            }
+    int i = 0, adv_i = 0, run;
+
+    while (i < length) {
+        /* copy the run of plain chars at once */
+        run = find_adv_escaped_sym(data + i, length - i);
+        memcpy(adv_buf + adv_i, data + i, run);
+        i += run;
+        adv_i += run;
+        if (i < length) {
+            adv_buf[adv_i++] = GSM0710_FRAME_ADV_ESC;
+            adv_buf[adv_i++] = data[i++] ^ GSM0710_FRAME_ADV_ESC_COPML;
+        }
     }
     return adv_i;
 }
@@ -1383,6 +1523,40 @@ static GSM0710_Buffer* gsm0710_buffer_init() {
  */
 static void gsm0710_buffer_destroy(GSM0710_Buffer* buf) { free(buf); }
 
+/*
+ * Purpose:  Commits data already placed at buf->writep (wrapping around) and wakes up the
+ *                assembly thread
+ * Input:      buf - pointer to the buffer
+ *                length - how many characters were placed, no more than gsm0710_buffer_free()
+ * Return:    -
+ */
+static void gsm0710_buffer_commit(GSM0710_Buffer* buf, int length) {
+    int c = buf->endp - buf->writep;
+    int was_ready;
+
+    if (length >= c)
+        buf->writep = buf->data + (length - c);
+    else
+        buf->writep += length;
+
+    pthread_mutex_lock(&buf->datacount_lock);
+    /* After copying the data to the serial->in_buf, it is time to update datacount to avoid read
+     * thread to get invalid data */
+    buf->datacount += length; /*updating the data-not-yet-read counter*/
+    LOGMUX(LOG_DEBUG, "GSM0710 buffer (up-to-date): written %d, free %d, stored %d", length,
+           gsm0710_buffer_free(buf), gsm0710_buffer_length(buf));
+    pthread_mutex_unlock(&buf->datacount_lock);
+
+    pthread_mutex_lock(&buf->newdataready_lock);
+    was_ready = buf->newdataready;
+    buf->newdataready = 1; /*signal assemble_frame_thread that new buffer data is ready and stored
+                              in serial->in_buf */
+    pthread_mutex_unlock(&buf->newdataready_lock);
+    /* assemble_frame_thread has been signalled and not yet cleared newdataready, it will see the
+     * new datacount when it gets there */
+    if (!was_ready) pthread_cond_signal(&buf->newdataready_signal);
+}
+
 /*
  * Purpose:  Writes data to the buffer
  * Input:      buf - pointer to the buffer
@@ -1405,30 +1579,132 @@ int gsm0710_buffer_write(GSM0710_Buffer* buf, const unsigned char* input, int le
          * buf */
         memcpy(buf->writep, input, c);
         memcpy(buf->data, input + c, length - c);
-        buf->writep = buf->data + (length - c);
     } else {
         /* In this case: buf->readp is located between the buf->writep and buf->endp */
         memcpy(buf->writep, input, length);
-        buf->writep += length;
-        if (buf->writep == buf->endp) buf->writep = buf->data;
     }
+    gsm0710_buffer_commit(buf, length);
+
+    LOGMUX(LOG_VERBOSE, "Leave");
+    return length;
+}
 
+/*
+ * Purpose:  Reads from fd straight into the free space of the buffer, no intermediate copy
+ * Input:      buf - pointer to the buffer
+ *                fd - the serial device
+ *                length - max characters to read, no more than gsm0710_buffer_free()
+ * Return:    return value of readv()
+ */
+static int gsm0710_buffer_read_fd(GSM0710_Buffer* buf, int fd, int length) {
+    struct iovec iov[2];
+    int c = buf->endp - buf->writep;
+    int iovcnt = 1;
+    int len;
+
+    iov[0].iov_base = buf->writep;
+    iov[0].iov_len = min(length, c);
+    if (length > c) {
+        iov[1].iov_base = buf->data;
+        iov[1].iov_len = length - c;
+        iovcnt = 2;
+    }
+
+    if ((len = readv(fd, iov, iovcnt)) > 0) {
+        if (len > c) {
+            syslogdump("<s ", buf->writep, c);
+            syslogdump("<s ", buf->data, len - c);
+        } else {
+            syslogdump("<s ", buf->writep, len);
+        }
+        gsm0710_buffer_commit(buf, len);
+    }
+    return len;
+}
+
+/*
+ * Purpose:  Releases the bytes held by the last extracted frame, so the serial read thread can
+ *                reuse them. It is called after every extracted frame.
+ * Input:      buf - pointer to the buffer
+ * Return:    -
+ */
+static void gsm0710_buffer_release(GSM0710_Buffer* buf) {
     pthread_mutex_lock(&buf->datacount_lock);
-    /* After copying the data to the serial->in_buf, it is time to update datacount to avoid read
-     * thread to get invalid data */
-    buf->datacount += length; /*updating the data-not-yet-read counter*/
-    LOGMUX(LOG_DEBUG, "GSM0710 buffer (up-to-date): written %d, free %d, stored %d", length,
-           gsm0710_buffer_free(buf), gsm0710_buffer_length(buf));
+    buf->heldcount = 0;
     pthread_mutex_unlock(&buf->datacount_lock);
 
-    pthread_mutex_lock(&buf->newdataready_lock);
-    buf->newdataready = 1; /*signal assemble_frame_thread that new buffer data is ready and stored
-                              in serial->in_buf */
-    pthread_mutex_unlock(&buf->newdataready_lock);
-    pthread_cond_signal(&buf->newdataready_signal);
+    /*Okay, go ahead and signal ser_read_thread to wake up if it is sleeping because reassembly
+     * buffer was full before */
+    pthread_mutex_lock(&buf->bufferready_lock);
+    if (buf->input_sleeping == 1) {
+        LOGMUX(LOG_VERBOSE, "Signal thread serial device read(): case1");
+        pthread_cond_signal(&buf->bufferready_signal);
+    }
+    pthread_mutex_unlock(&buf->bufferready_lock);
+}
 
-    LOGMUX(LOG_VERBOSE, "Leave");
-    return length;
+/* Free frame objects kept for reuse, frames are created for every received frame */
+#define MUXD_FRAME_FREELIST_SIZE 64
+
+static GSM0710_Frame* frame_freelist = NULL;
+static int frame_freelist_count = 0;
+static pthread_mutex_t frame_freelist_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Purpose:  Allocates a zeroed frame, reusing a freed one if any
+ * Input:      -
+ * Return:    frame or null if out of memory
+ */
+static GSM0710_Frame* alloc_frame() {
+    GSM0710_Frame* frame = NULL;
+
+    pthread_mutex_lock(&frame_freelist_lock);
+    if (frame_freelist != NULL) {
+        frame = frame_freelist;
+        frame_freelist = frame->next_free;
+        frame_freelist_count--;
+    }
+    pthread_mutex_unlock(&frame_freelist_lock);
+
+    if (frame == NULL) return (GSM0710_Frame*)malloc_r(sizeof(GSM0710_Frame));
+
+    memset(frame, 0, sizeof(GSM0710_Frame));
+    return frame;
+}
+
+/*
+ * Purpose:  Makes the payload of a frame view contiguous, copies only if it wraps around
+ * Input:      frame - pointer to the frame
+ * Return:    0 on success, -1 if out of memory
+ */
+int gsm0710_frame_linearize(GSM0710_Frame* frame) {
+    if (frame->data_view && frame->data_length < frame->length) {
+        return gsm0710_frame_detach(frame);
+    }
+    return 0;
+}
+
+/*
+ * Purpose:  Copies the payload of a frame view to own memory, so it can be kept after the next
+ *                frame is extracted
+ * Input:      frame - pointer to the frame
+ * Return:    0 on success, -1 if out of memory
+ */
+int gsm0710_frame_detach(GSM0710_Frame* frame) {
+    unsigned char* data;
+
+    if (!frame->data_view) return 0;
+
+    if ((data = (unsigned char*)malloc_r(sizeof(char) * frame->length)) == NULL) return -1;
+    memcpy(data, frame->data, frame->data_length);
+    if (frame->data_length < frame->length)
+        memcpy(data + frame->data_length, frame->data_wrap, frame->length - frame->data_length);
+
+    frame->data = data;
+    frame->data_view = 0;
+    frame->data_length = frame->length;
+    frame->data_wrap = NULL;
+    return 0;
 }
 
 /*
@@ -1441,9 +1717,19 @@ void destroy_frame(GSM0710_Frame* frame) {
         LOGMUX(LOG_VERBOSE, "frame_data ptr=0x%02X, frame_len=%d", (unsigned int)frame->data,
                frame->length);
 
-        if (frame->data != NULL) free(frame->data);
+        if (frame->data != NULL && !frame->data_view) free(frame->data);
     }
-    free(frame);
+
+    pthread_mutex_lock(&frame_freelist_lock);
+    if (frame_freelist_count < MUXD_FRAME_FREELIST_SIZE) {
+        frame->next_free = frame_freelist;
+        frame_freelist = frame;
+        frame_freelist_count++;
+        frame = NULL;
+    }
+    pthread_mutex_unlock(&frame_freelist_lock);
+
+    if (frame != NULL) free(frame);
 }
 
 /*
@@ -1524,12 +1810,7 @@ static GSM0710_Frame* gsm0710_base_buffer_get_frame(GSM0710_Buffer* buf, int pas
     pthread_mutex_unlock(&buf->datacount_lock);
     LOGMUX(LOG_DEBUG, "local_datacount %d", local_datacount);
     if (local_datacount >= length_needed) { /* enough data stored for 0710 frame header+footer? */
-        if ((frame = (GSM0710_Frame*)malloc_r(sizeof(GSM0710_Frame))) != NULL) {
-            /* Add by LS */
-            /* It it does not set zero: when it encounters an error before allocating mem for
-             * frame->data */
-            /* In destroy_frame(): It will free the memory pointed by frame->data abnormally */
-            memset(frame, 0, sizeof(GSM0710_Frame));
+        if ((frame = alloc_frame()) != NULL) {
 
             /* Parse Address Field */
             LOGMUX(LOG_VERBOSE, "UIH Addr Filed value=0x%02X", *local_readp);
@@ -1687,29 +1968,34 @@ static GSM0710_Frame* gsm0710_base_buffer_get_frame(GSM0710_Buffer* buf, int pas
         if (frame->length > 0) {
             /* Now, local_readp is pointed to the 1st byte of the Information field and all data for
              * this completed frame are stored in buf */
-            if ((frame->data = malloc_r(sizeof(char) * frame->length)) != NULL) {
-                end = buf->endp - local_readp;
-                if (frame->length > end) { /*wrap-around necessary*/
-                    /* In this case: the buf->writep is not possible located between the buf->readp
-                     * and buf->end */
-                    /* 1st: From local_readp to end */
-                    memcpy(frame->data, local_readp, end);
-                    /* 2nd: From start position(i.e.,buf->data) of buf to (frame->length - end) */
-                    memcpy(frame->data + end, buf->data, frame->length - end);
+            /* The payload is not copied, frame->data refers to it in buf, which is held until
+             * extract_frames() is done with this frame (see gsm0710_buffer_release()) */
+            frame->data = local_readp;
+            frame->data_view = 1;
+            end = buf->endp - local_readp;
+            if (frame->length > end) { /*wrap-around necessary*/
+                /* In this case: the buf->writep is not possible located between the buf->readp
+                 * and buf->end */
+                /* 1st: From local_readp to end, 2nd: From start position(i.e.,buf->data) of buf to
+                 * (frame->length - end) */
+                frame->data_length = end;
+                frame->data_wrap = buf->data;
+                /* Update the pointer local_readp to the FCS field */
+                local_readp = buf->data + (frame->length - end);
+                local_datacount -= frame->length;
+            } else {
+                frame->data_length = frame->length;
+                local_readp += frame->length;
+                local_datacount -= frame->length;
+                if (local_readp == buf->endp)
                     /* Update the pointer local_readp to the FCS field */
-                    local_readp = buf->data + (frame->length - end);
-                    local_datacount -= frame->length;
-                } else {
-                    memcpy(frame->data, local_readp, frame->length);
-                    local_readp += frame->length;
-                    local_datacount -= frame->length;
-                    if (local_readp == buf->endp)
-                        /* Update the pointer local_readp to the FCS field */
-                        local_readp = buf->data;
-                }
-                if (GSM0710_FRAME_IS(GSM0710_TYPE_UI, frame))
-                    for (end = 0; end < frame->length; end++)
-                        fcs = r_crctable[fcs ^ (frame->data[end])];
+                    local_readp = buf->data;
+            }
+            if (GSM0710_FRAME_IS(GSM0710_TYPE_UI, frame)) {
+                fcs = frame_update_crc(fcs, frame->data, frame->data_length);
+                if (frame->data_length < frame->length)
+                    fcs = frame_update_crc(fcs, frame->data_wrap,
+                                           frame->length - frame->data_length);
             }
         }
         /*Okay, check FCS*/
@@ -1760,6 +2046,8 @@ static GSM0710_Frame* gsm0710_base_buffer_get_frame(GSM0710_Buffer* buf, int pas
     buf->readp = local_readp;
     buf->datacount -=
             (local_datacount_backup - local_datacount); /* subtract whatever we analyzed */
+    /* keep the frame in buf till it is released, not to be overwritten by serial read thread */
+    buf->heldcount = local_datacount_backup - local_datacount;
     pthread_mutex_unlock(&buf->datacount_lock);
 
     buf->flag_found = 0; /* prepare for any future frame processing*/
@@ -1836,8 +2124,7 @@ l_begin:
                                */
             }
             /* Okay, extract the header information */
-            if ((frame = (GSM0710_Frame*)calloc(1, sizeof(GSM0710_Frame))) !=
-                NULL) {                                  /* frame is sane, allocate memory for it */
+            if ((frame = alloc_frame()) != NULL) {       /* frame is sane, allocate memory for it */
                 frame->channel = ((data[0] & 252) >> 2); /* the channel address field */
                 fcs = r_crctable[fcs ^ data[0]];
                 frame->control = data[1]; /* the frame type field */
@@ -1850,20 +2137,12 @@ l_begin:
             }
             /* Okay, extract the payload data */
             if (frame->length > 0) {
-                if ((frame->data = (unsigned char*)calloc(1, sizeof(char) * frame->length))) {
-                    memcpy(frame->data, data + 2,
-                           frame->length); /*copy data from first payload field*/
-                    if (GSM0710_FRAME_IS(GSM0710_TYPE_UI, frame)) {
-                        int i;
-                        for (i = 0; i < frame->length; ++i)
-                            fcs = r_crctable[fcs ^ (frame->data[i])];
-                    }
-                } else {
-                    LOGMUX(LOG_ERR, "Out of memory, when allocating space for frame data");
-                    buf->flag_found = 0;
-                    destroy_frame(frame);
-                    goto l_begin;
-                }
+                /* refer to the first payload field, adv_data is not touched till the next call */
+                frame->data = data + 2;
+                frame->data_view = 1;
+                frame->data_length = frame->length;
+                if (GSM0710_FRAME_IS(GSM0710_TYPE_UI, frame))
+                    fcs = frame_update_crc(fcs, frame->data, frame->length);
             }
             /* Okay, check FCS field */
             if (r_crctable[fcs ^ data[buf->adv_length - 1]] != 0xCF) {
@@ -2544,6 +2823,25 @@ static int handle_command(GSM0710_Frame* frame) {
     return 0;
 }
 
+/*
+ * Purpose:  Writes the payload of a frame, both parts of a wrapped frame view at once
+ * Input:    fd - the pty to write
+ *           frame - pointer to the frame
+ * Return:   return value of write()/writev()
+ */
+static int write_frame_payload(int fd, GSM0710_Frame* frame) {
+    struct iovec iov[2];
+
+    if (!frame->data_view || frame->data_length >= frame->length)
+        return write(fd, frame->data, frame->length);
+
+    iov[0].iov_base = frame->data;
+    iov[0].iov_len = frame->data_length;
+    iov[1].iov_base = frame->data_wrap;
+    iov[1].iov_len = frame->length - frame->data_length;
+    return writev(fd, iov, 2);
+}
+
 /*
  * Purpose:  Extracts and assembles frames from the mux GSM0710 buffer
  * Input:    buf - the receiver buffer
@@ -2563,19 +2861,6 @@ int extract_frames(GSM0710_Buffer* buf) {
         /* If it can't obtain a completed frame(e.g.,f9,......,f9) in
          * gsm0710_base_buffer_get_frame(), NULL will be returned */
         frames_extracted++;
-        /*Okay, go ahead and signal ser_read_thread to wake up if it is sleeping because reassembly
-         * buffer was full before */
-        pthread_mutex_lock(&buf->bufferready_lock);
-        if (buf->input_sleeping == 1) {
-            /* Because the serial->inbuf's data are copied to the frame->data, it is time to signal
-             * the thread_serial_device_read */
-            // pthread_cond_signal(&newdataready_signal);
-            /* [Bug] Note by LS: It should signal the thread waits for the bufferready_signal
-             * instead of newdataready_signal */
-            LOGMUX(LOG_VERBOSE, "Signal thread serial device read(): case1");
-            pthread_cond_signal(&buf->bufferready_signal);
-        }
-        pthread_mutex_unlock(&buf->bufferready_lock);
 
         if ((GSM0710_FRAME_IS(GSM0710_TYPE_UI, frame) ||
              GSM0710_FRAME_IS(GSM0710_TYPE_UIH, frame))) {
@@ -2609,7 +2894,7 @@ int extract_frames(GSM0710_Buffer* buf) {
                     int write_result = -1;
 
                     while (1) {
-                        if ((write_result = write(channel->fd, frame->data, frame->length)) >= 0) {
+                        if ((write_result = write_frame_payload(channel->fd, frame)) >= 0) {
                             int fsync_result = -1;
                             LOGMUX(LOG_DEBUG,
                                    "write() returned. Written %d/%d bytes of frame to %s,count %d",
@@ -2628,12 +2913,11 @@ int extract_frames(GSM0710_Buffer* buf) {
 
 #ifdef __MUXD_FLOWCONTROL__
                             if ((frame->length - write_result) > 0) {
-                                /* Cache remaining data into a linked list */
-                                _fc_cacheRemainingFrameData(channel, frame, write_result);
-
-                                /* Start another thread to retry the action - writte data into the
-                                 * channel*/
-                                start_retry_write_thread(channel);
+                                /* Cache remaining data into a linked list, and start another
+                                 * thread to retry the action - writte data into the channel */
+                                if (_fc_cacheRemainingFrameData(channel, frame, write_result) == 0) {
+                                    start_retry_write_thread(channel);
+                                }
                                 frame = NULL;
                             }
 #endif /* __MUXD_FLOWCONTROL__ */
@@ -2651,12 +2935,12 @@ int extract_frames(GSM0710_Buffer* buf) {
                                     // Add by MTK03594
                                     // Disable RX flow control for VT call
                                     if (frame->channel != MUXD_VT_CH_NUM) {
-                                        /* Cache remaining data into a linked list */
-                                        _fc_cacheRemainingFrameData(channel, frame, 0);
-
-                                        /* Start another thread to retry the action - writte data
-                                         * into the channel*/
-                                        start_retry_write_thread(channel);
+                                        /* Cache remaining data into a linked list, and start
+                                         * another thread to retry the action - writte data into
+                                         * the channel */
+                                        if (_fc_cacheRemainingFrameData(channel, frame, 0) == 0) {
+                                            start_retry_write_thread(channel);
+                                        }
                                     } else {
                                         LOGMUX(LOG_ERR, "Discard VT frame");
                                     }
@@ -2727,7 +3011,7 @@ int extract_frames(GSM0710_Buffer* buf) {
                 // control channel command (i.e., UIH Frame with the control command sent on
                 // frame->channel#0)
                 LOGMUX(LOG_DEBUG, "Frame channel == 0, control channel command");
-                handle_command(frame);
+                if (gsm0710_frame_linearize(frame) == 0) handle_command(frame);
             }
         } else {
             // not an information frame (e.g., SABM,UA,DISC and DM)
@@ -2910,6 +3194,8 @@ int extract_frames(GSM0710_Buffer* buf) {
         /* Memory allocation from frame and frame->data may be done in
          * gsm0710_base_buffer_get_frame() */
         if (frame != NULL) destroy_frame(frame);
+        /* Cached frames are detached already, the payload in buffer is not needed anymore */
+        gsm0710_buffer_release(buf);
     }
     LOGMUX(LOG_VERBOSE, "Leave");
     return frames_extracted;
@@ -3149,9 +3435,6 @@ int thread_serial_device_read(void* vargp) {
 
         switch (serial->state) {
             case MUX_STATE_MUXING: {
-                /* Note by LS: It may not declare a local array with so large size; it can sync with
-                 * CCCI TTY driver buf's size */
-                unsigned char buffer[4096];
                 int len;
                 // input from serial port
                 LOGMUX(LOG_VERBOSE, "Serial Data");
@@ -3160,10 +3443,9 @@ int thread_serial_device_read(void* vargp) {
                 if ((length = gsm0710_buffer_free(buf)) >
                     0) { /*available space in buffer (not locked since we want to utilize all
                             available space)*/
-                    if ((len = read(serial->fd, buffer, min(length, sizeof(buffer)))) > 0) {
-                        syslogdump("<s ", buffer, len);
-                        /* Copy data from local buf to the serial->in_buf */
-                        gsm0710_buffer_write(buf, buffer, len);
+                    /* Read into the serial->in_buf directly, the frames refer to it later */
+                    if ((len = gsm0710_buffer_read_fd(buf, serial->fd, length)) > 0) {
+                        LOGMUX(LOG_VERBOSE, "Read %d bytes from serial device", len);
                     } else if ((length > 0) && (len == 0)) {
                         LOGMUX(LOG_VERBOSE, "Waiting for data from serial device");
                     } else {
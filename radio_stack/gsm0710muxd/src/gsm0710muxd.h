@@ -197,7 +197,7 @@
 /* In this way, the available free space is less than or equal to the actual free space size due to
  * un-updated buf->readp and buf->datacount */
 
-#define gsm0710_buffer_free(buf) (GSM0710_BUFFER_SIZE - buf->datacount)
+#define gsm0710_buffer_free(buf) (GSM0710_BUFFER_SIZE - buf->datacount - buf->heldcount)
 
 /******************************************************************************/
 
@@ -340,6 +340,14 @@ typedef struct GSM0710_Frame {
     int length;
     unsigned char* data;
 
+    /* data_view = 1: data points into GSM0710_Buffer instead of own memory, only valid until the
+     * next frame is extracted. If the payload wraps around the end of the buffer, data holds
+     * data_length bytes and the rest starts at data_wrap, see gsm0710_frame_linearize() */
+    int data_view;
+    int data_length;
+    unsigned char* data_wrap;
+    struct GSM0710_Frame* next_free; /* link in the free frame list */
+
 } GSM0710_Frame;
 
 typedef struct GSM0710_FrameList {
@@ -358,6 +366,7 @@ typedef struct GSM0710_Buffer {
     unsigned char* writep;
     unsigned char* endp;
     unsigned int datacount;
+    unsigned int heldcount; /* bytes just before readp still referenced by the extracted frame */
     int newdataready;   /*newdataready = 1: new data written to internal buffer. newdataready=0:
                            acknowledged by assembly thread*/
     int input_sleeping; /*input_sleeping = 1 if ser_read_thread (input to buffer) is waiting because
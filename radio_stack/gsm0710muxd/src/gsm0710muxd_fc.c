@@ -64,7 +64,7 @@ void _fc_chokePty(Channel* channel);
 void _fc_releasePty(Channel* channel);
 void _fc_initContext(Channel* channel);
 void _fc_closeContext(Channel* channel);
-void _fc_cacheRemainingFrameData(Channel* channel, GSM0710_Frame* frame, int written);
+int _fc_cacheRemainingFrameData(Channel* channel, GSM0710_Frame* frame, int written);
 void _fc_cacheFrameData(Channel* channel, GSM0710_Frame* frame);
 
 /******************************************************************************/
@@ -74,6 +74,7 @@ extern void set_main_exit_signal(int signal);
 extern int create_thread(pthread_t* thread_id, void* thread_function, void* thread_function_arg);
 extern int write_frame(int channel, const unsigned char* input, int length, unsigned char type);
 extern void destroy_frame(GSM0710_Frame* frame);
+extern int gsm0710_frame_detach(GSM0710_Frame* frame);
 
 /******************************************************************************/
 
@@ -198,6 +199,8 @@ void _fc_closeContext(Channel* channel) {
 }
 
 void _fc_cacheFrameData(Channel* channel, GSM0710_Frame* frame) {
+    int dropped = 0;
+
     LOGMUX(LOG_DEBUG, "Enter");
 
     /* All data sent from the modem before receiving the MSC with FC OFF Rsp will be inserted into
@@ -206,8 +209,14 @@ void _fc_cacheFrameData(Channel* channel, GSM0710_Frame* frame) {
         LOGMUX(LOG_DEBUG, "Accumulated_pending_frame_bytes is larger than mark val=%d, drop it",
                RX_FLOW_CTRL_HIGH_WATERMARK);
         serial.in_buf->dropped_count++;
+        dropped = 1;
         // mtk02863
         // Gsm0710Muxd_Assert(19);
+    } else if (gsm0710_frame_detach(frame) < 0) {
+        /* the frame refers to the re-assembly buffer which is reused by the next frame */
+        LOGMUX(LOG_ERR, "Out of memory to keep frame_len=%d, drop it", frame->length);
+        serial.in_buf->dropped_count++;
+        dropped = 1;
     } else {
         channel->rx_fl_total += frame->length;
         channel->rx_fl = _fl_pushFrame(channel->rx_fl, frame);
@@ -215,16 +224,30 @@ void _fc_cacheFrameData(Channel* channel, GSM0710_Frame* frame) {
 
     LOGMUX(LOG_INFO, "Case2:Frame List=0x%08X, pending_frame_bytes=%d, frame_len=%d",
            (unsigned int)channel->rx_fl, channel->rx_fl_total, frame->length);
+
+    /* the caller has handed the frame over */
+    if (dropped) destroy_frame(frame);
     return;
 }
 
-void _fc_cacheRemainingFrameData(Channel* channel, GSM0710_Frame* frame, int written) {
+/*
+ * Return:   0 if the frame is cached, -1 if it is dropped, and no retry thread is needed
+ */
+int _fc_cacheRemainingFrameData(Channel* channel, GSM0710_Frame* frame, int written) {
     LOGMUX(LOG_INFO, "Enter");
 
     if (!_fl_isEmpty(channel->rx_fl)) Gsm0710Muxd_Assert(GSM0710MUXD_FRAMELIST_INIT_ERR);
 
     channel->rx_fl = _fl_init(channel->rx_fl);
 
+    /* the frame may refer to the re-assembly buffer, keep a copy of its payload */
+    if (gsm0710_frame_detach(frame) < 0) {
+        LOGMUX(LOG_ERR, "Out of memory to keep frame_len=%d written=%d, drop it", frame->length,
+               written);
+        serial.in_buf->dropped_count++;
+        destroy_frame(frame);
+        return -1;
+    }
     channel->rx_fl_total = (frame->length - written);
     channel->rx_fl = _fl_pushFrame(channel->rx_fl, frame);
     // todo
@@ -232,7 +255,7 @@ void _fc_cacheRemainingFrameData(Channel* channel, GSM0710_Frame* frame, int wri
 
     /* This is 1st node due to pty channel's buffer is full */
     LOGMUX(LOG_INFO, "Case1: FrameList=0x%08X", (unsigned int)channel->rx_fl);
-    return;
+    return 0;
 }
 
 /******************************************************************************/
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+// gsm0710muxd_test_hooks.c
+extern "C" {
+int muxd_test_init_serial(int basic, int fd);
+void muxd_test_set_channel(int id, int fd, int n1);
+int muxd_test_write_uih(int channel, const unsigned char* input, int length);
+int muxd_test_serial_round();
+}
+
+namespace {
+
+// the channel and the frame size rild runs the muxd with, -f 512
+const int kChannel = 1;
+const int kN1 = 512;
+
+int64_t nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+// a raw pty pair, the muxd writes the master and rild reads the slave
+struct PtyPair {
+    PtyPair() : master(-1), slave(-1) {
+        struct termios options;
+        master = posix_openpt(O_RDWR | O_NOCTTY);
+        if (master < 0 || grantpt(master) < 0 || unlockpt(master) < 0) return;
+        slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+        if (slave < 0) return;
+        tcgetattr(master, &options);
+        cfmakeraw(&options);
+        tcsetattr(master, TCSANOW, &options);
+        tcgetattr(slave, &options);
+        cfmakeraw(&options);
+        tcsetattr(slave, TCSANOW, &options);
+    }
+
+    ~PtyPair() {
+        if (slave >= 0) close(slave);
+        if (master >= 0) close(master);
+    }
+
+    int master;
+    int slave;
+};
+
+// the serial stream of the modem, payloads split into UIH frames of kN1 bytes
+std::vector<unsigned char> encodeStream(const std::vector<unsigned char>& payload) {
+    std::vector<unsigned char> stream;
+    FILE* file = tmpfile();
+    if (file == NULL) return stream;
+    muxd_test_init_serial(1, fileno(file));
+    muxd_test_set_channel(kChannel, -1, kN1);
+    for (size_t i = 0; i < payload.size(); i += kN1) {
+        int length = (int)std::min(payload.size() - i, (size_t)kN1);
+        muxd_test_write_uih(kChannel, &payload[i], length);
+    }
+    stream.resize(ftell(file));
+    rewind(file);
+    if (fread(stream.data(), 1, stream.size(), file) != stream.size()) stream.clear();
+    fclose(file);
+    return stream;
+}
+
+// drains the slave until size bytes arrived
+void readAll(int fd, size_t size, std::vector<unsigned char>* out, std::atomic<size_t>* received) {
+    unsigned char chunk[4096];
+    while (out->size() < size) {
+        int len = read(fd, chunk, sizeof(chunk));
+        if (len <= 0) break;
+        out->insert(out->end(), chunk, chunk + len);
+        *received = out->size();
+    }
+}
+
+TEST(Gsm0710MuxdPtyTest, ThroughputBenchmark) {
+    const size_t size = 16 * 1024 * 1024;
+    std::vector<unsigned char> payload(size);
+    srand(1);
+    for (size_t i = 0; i < size; i++) {
+        payload[i] = rand();
+    }
+    std::vector<unsigned char> stream = encodeStream(payload);
+    ASSERT_FALSE(stream.empty());
+
+    PtyPair pty;
+    ASSERT_GE(pty.slave, 0);
+    int modem[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, modem));
+    ASSERT_EQ(0, muxd_test_init_serial(1, modem[0]));
+    // blocking master, the flow control cache of a full pty is not part of the measurement
+    muxd_test_set_channel(kChannel, pty.master, kN1);
+
+    // the pty alone, the ceiling of the path
+    std::vector<unsigned char> direct;
+    std::atomic<size_t> directReceived(0);
+    int64_t start = nowNs();
+    std::thread directReader(readAll, pty.slave, size, &direct, &directReceived);
+    for (size_t i = 0; i < size; i += kN1) {
+        ASSERT_GT(write(pty.master, &payload[i], std::min(size - i, (size_t)kN1)), 0);
+    }
+    directReader.join();
+    int64_t directNs = nowNs() - start;
+    ASSERT_EQ(payload, direct);
+
+    // modem -> serial read thread -> frame extraction -> pty
+    std::vector<unsigned char> muxed;
+    std::atomic<size_t> muxedReceived(0);
+    start = nowNs();
+    std::thread muxedReader(readAll, pty.slave, size, &muxed, &muxedReceived);
+    std::thread modemWriter([&]() {
+        for (size_t i = 0; i < stream.size();) {
+            int len = write(modem[1], &stream[i], std::min(stream.size() - i, (size_t)4096));
+            if (len <= 0) break;
+            i += len;
+        }
+        close(modem[1]);
+    });
+    int64_t deadline = start + 60 * 1000000000ll;
+    while (muxedReceived.load() < size && nowNs() < deadline) {
+        muxd_test_serial_round();
+    }
+    if (muxedReceived.load() < size) {
+        // lost frames, wake up the reader with EIO
+        close(pty.master);
+        pty.master = -1;
+    }
+    modemWriter.join();
+    muxedReader.join();
+    int64_t muxedNs = nowNs() - start;
+    close(modem[0]);
+    muxd_test_set_channel(kChannel, -1, kN1);
+
+    EXPECT_EQ(payload, muxed);
+    printf("pty pair, %zu bytes in %d byte frames: pty alone %.1f MB/s, through the muxd %.1f "
+           "MB/s\n",
+           size, kN1, size * 1000.0 / directNs, size * 1000.0 / muxedNs);
+}
+
+}  // namespace
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The muxd is one C file with a main() and static state, the test builds it in here and reaches
+ * the static parts through the hooks below */
+#define main gsm0710muxd_main
+#include "../src/gsm0710muxd.c"
+#undef main
+
+/*
+ * Purpose:  Puts the serial side into muxing state with a new receive buffer
+ * Input:    basic - 1 for basic mode as rild runs it (-m basic), 0 for advanced mode
+ *           fd - the serial device
+ * Return:   0 if success, else 1
+ */
+int muxd_test_init_serial(int basic, int fd) {
+    cmux_mode = basic ? 0 : 1;
+    serial.fd = fd;
+    serial.state = MUX_STATE_MUXING;
+    if (serial.in_buf == NULL && (serial.in_buf = gsm0710_buffer_init()) == NULL) return 1;
+    if (serial.adv_frame_buf == NULL &&
+        (serial.adv_frame_buf = (unsigned char*)calloc(1, (cmux_N1 + 3) * 2 + 2)) == NULL)
+        return 1;
+    return 0;
+}
+
+/*
+ * Purpose:  Connects a logical channel to a pty without the poll thread of the pty
+ * Input:    id - the channel id
+ *           fd - master side of the pty, -1 to disconnect
+ *           n1 - the negotiated frame size
+ * Return:   -
+ */
+void muxd_test_set_channel(int id, int fd, int n1) {
+    channellist[id].id = id;
+    channellist[id].fd = fd;
+    channellist[id].negotiated_N1 = n1;
+}
+
+/*
+ * Purpose:  Sends a UIH frame to the serial device
+ * Input:    channel - the channel id
+ *           input - the payload
+ *           length - the length of the payload
+ * Return:   return value of write_frame()
+ */
+int muxd_test_write_uih(int channel, const unsigned char* input, int length) {
+    return write_frame(channel, input, length, GSM0710_TYPE_UIH);
+}
+
+/*
+ * Purpose:  One round of the serial read thread and one of the frame assembly thread
+ * Input:    -
+ * Return:   number of frames extracted
+ */
+int muxd_test_serial_round() {
+    thread_serial_device_read(&serial);
+    return extract_frames(serial.in_buf);
+}
@@ -78,14 +78,14 @@ struct HEVCAssembler : public RTPAssembler {
             mNALSize = 0;
             mNALType = 0;
             mNRI = 1;
+            mFirstToken = 0;
+            mEarliestToken = 0;
+            mEarliestRecvTimeUs = 0;
+            mLatestToken = 0;
         }
 
       protected:
-        ~NALFragMentsInfo() {
-            if (!mNALFragments.empty()) {
-                mNALFragments.clear();
-            }
-        }
+        ~NALFragMentsInfo() {}
 
       public:
         bool mIsCompleted;
@@ -96,10 +96,19 @@ struct HEVCAssembler : public RTPAssembler {
         uint32_t mNALSize;
         uint32_t mNALType;
         uint32_t mNRI;
-        List<sp<ABuffer> > mNALFragments;
+        // NAL header and the payloads received so far, written in place
+        sp<ABuffer> mNAL;
+        // the metas of the NAL are copied from it
+        RTPPacketInfo mLastPacketInfo;
+        int32_t mFirstToken;
+        int32_t mEarliestToken;
+        int64_t mEarliestRecvTimeUs;
+        int32_t mLatestToken;
     };
 
     sp<NALFragMentsInfo> mpNALFragmentInfo;
+    // the buffer of a new fragmented NAL is sized from the recent NALs
+    size_t mNALSizeHint;
 
   public:
     virtual AssemblyStatus assembleMore(const sp<RTPSource> source);
@@ -112,8 +121,9 @@ struct HEVCAssembler : public RTPAssembler {
   private:
     AssemblyStatus addNALUnit(const sp<RTPSource>& source);
     void addSingleNALUnit(const sp<ABuffer>& buffer);
-    AssemblyStatus addFragmentedNALUnit(List<sp<ABuffer> >* queue);
-    bool addSingleTimeAggregationPacket(const sp<ABuffer>& buffer);
+    AssemblyStatus addFragmentedNALUnit(RTPReorderQueue* queue);
+    void appendFragment(const sp<ABuffer>& buffer, const RTPPacketInfo& packetInfo);
+    bool addSingleTimeAggregationPacket(const sp<ABuffer>& buffer, const RTPPacketInfo& info);
     sp<ABuffer> assembleToNAL(sp<NALFragMentsInfo> nalFragmentInfo);
     void submitAccessUnit(const sp<ABuffer>& accessUnit);
 
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_ADAPTATION_LIB_CONTROLLER_H_
+
+#define _IMS_RTP_ADAPTATION_LIB_CONTROLLER_H_
+
+#include "RTPCongestionController.h"
+
+#include <media/stagefright/foundation/ABase.h>
+
+namespace imsma {
+
+// RTPCongestionController backed by TxAdaptationInfo of libimsma_adapt,
+// keeps the adaptation behavior from before the controller was pluggable.
+class RTPAdaptationLibController : public RTPCongestionController {
+  public:
+    explicit RTPAdaptationLibController(TxAdaptationInfo* adaInfo);
+
+    virtual const char* getName() const { return "adaptation_lib"; }
+
+    virtual bool onReportBlock(uint8_t* data, int32_t containTMMBR, int64_t rttUs,
+                               signalInfo sigInfo, int64_t nowUs, uint32_t* target,
+                               bool* needForceI);
+    virtual bool onTMMBR(uint8_t* fci, uint32_t queueDurationUs, signalInfo sigInfo,
+                         int64_t nowUs, uint32_t* target);
+    virtual bool onQueueDelay(uint32_t queueDurationUs, int64_t nowUs, uint32_t* target);
+
+  private:
+    TxAdaptationInfo* mAdaInfo;
+
+    DISALLOW_EVIL_CONSTRUCTORS(RTPAdaptationLibController);
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_ADAPTATION_LIB_CONTROLLER_H_
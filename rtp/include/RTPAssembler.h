@@ -22,6 +22,7 @@
 #include <utils/List.h>
 #include <utils/StrongPointer.h>
 #include <utils/RefBase.h>
+#include <utils/Vector.h>
 
 #include <utils/List.h>
 #include <media/stagefright/foundation/ABuffer.h>
@@ -54,12 +55,18 @@ struct RTPAssembler : public RefBase {
     RTPAssembler();
 
     void onPacketReceived(const sp<RTPSource>& source);
+    // when the assembler started waiting for a missing packet, -1 if not waiting
+    int64_t getFirstFailureTimeUs() const { return mFirstFailureTimeUs; }
     virtual void flushQueue() = 0;
     virtual void reset() = 0;
     virtual uint32_t getLostCount() = 0;
     virtual uint32_t getIDamageCount() = 0;
     virtual bool isCSD(const sp<ABuffer>& accessUnit) = 0;
 
+    // every access unit keeps at least kStartCodeHeadroom bytes before data(),
+    // the consumer may write a start code there instead of copying the NAL
+    static const size_t kStartCodeHeadroom = 4;
+
     // virtual void onByeReceived() = 0;
   protected:
     virtual AssemblyStatus assembleMore(const sp<RTPSource> source) = 0;
@@ -82,6 +89,12 @@ struct RTPAssembler : public RefBase {
     int64_t mFirstFailureTimeUs;
     static const uint32_t kLargeSequenceGap = 20;
 
+    // NAL buffers are reused once the consumer has released them,
+    // large I frame NALs then do not cost a fresh allocation each time
+    static const size_t kNALBufferPoolSize = 4;
+    static const size_t kMinNALCapacity = 4096;
+    Vector<sp<ABuffer> > mNALBufferPool;
+
     DISALLOW_EVIL_CONSTRUCTORS(RTPAssembler);
 
     // do something before time established
@@ -92,7 +105,13 @@ struct RTPAssembler : public RefBase {
     */
 
   protected:
-    static void CopyMetas(const sp<ABuffer>& to, const sp<ABuffer>& from);
+    // the packet header reaches ABuffer::meta() only here, for the access units
+    static void CopyMetas(const sp<ABuffer>& to, const RTPPacketInfo& from);
+
+    // empty buffer for a NAL of up to capacity bytes, with kStartCodeHeadroom before data()
+    sp<ABuffer> acquireNALBuffer(size_t capacity);
+    // buffer holding the data of buffer with room for capacity bytes
+    sp<ABuffer> growNALBuffer(const sp<ABuffer>& buffer, size_t capacity);
     // notify ARTPSource to updateExpectedTimeoutUs, mainly for audio
     /*
     virtual void evaluateDuration(const sp<RTPSource> &source,
@@ -101,8 +120,8 @@ struct RTPAssembler : public RefBase {
                         return;
 
         }*/
-    AssemblyStatus getAssembleStatus(List<sp<ABuffer> >* queue, uint32_t nextExpectedSeq) {
-        sp<ABuffer> buffer = *--queue->end();
+    AssemblyStatus getAssembleStatus(RTPReorderQueue* queue, uint32_t nextExpectedSeq) {
+        sp<ABuffer> buffer = queue->back();
         uint32_t seq = buffer->int32Data();
         return seq - nextExpectedSeq > kLargeSequenceGap ? LARGE_SEQUENCE_GAP
                                                          : WRONG_SEQUENCE_NUMBER;
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_CONGESTION_CONTROLLER_H_
+
+#define _IMS_RTP_CONGESTION_CONTROLLER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "TxAdaptationInfo.h"
+
+namespace imsma {
+
+// Decides the encoding bit rate of RTPSender from the network feedback.
+// Each event returns true and sets *target(bps) when the encoder should be adjusted,
+// RTPSender then calls notifyAdjustEncBR(*target).
+// Time is passed by the caller, so a backend can be driven by a trace replay.
+// Not thread safe, RTPSender uses it from its own looper.
+class RTPCongestionController {
+  public:
+    enum Type {
+        // loss and report block based adaptation of the prebuilt libimsma_adapt
+        kTypeAdaptationLib = 0,
+        // delay gradient(GCC like) with loss based fallback
+        kTypeDelayGradient = 1,
+    };
+
+    struct PacketFeedback {
+        // transport wide seq, see RTPTransportFeedback
+        uint16_t mSeqNum;
+        // in the receiver clock, -1 if the packet is reported lost
+        int64_t mArrivalTimeUs;
+    };
+
+    // adaInfo is owned by RTPSender and must outlive the controller
+    static RTPCongestionController* create(int32_t type, TxAdaptationInfo* adaInfo);
+
+    virtual ~RTPCongestionController() {}
+
+    virtual const char* getName() const = 0;
+
+    // upper bound from b=AS and MBR_UL, in bps
+    virtual void setMaxBitrate(uint32_t maxBitrate) {}
+
+    // seqNum is the transport wide seq when negotiated, otherwise the RTP seqNum
+    virtual void onPacketSent(uint16_t seqNum, uint32_t size, int64_t sendTimeUs) {}
+
+    // per packet arrival times reported by the receiver
+    virtual bool onPacketFeedback(const PacketFeedback* feedbacks, size_t count, int64_t nowUs,
+                                  uint32_t* target) {
+        return false;
+    }
+
+    // data is the report block after SSRC, rttUs is -1 if not available
+    virtual bool onReportBlock(uint8_t* data, int32_t containTMMBR, int64_t rttUs,
+                               signalInfo sigInfo, int64_t nowUs, uint32_t* target,
+                               bool* needForceI) = 0;
+
+    // fci is the 4 bytes of MxTBR Exp, Mantissa and Measured Overhead
+    virtual bool onTMMBR(uint8_t* fci, uint32_t queueDurationUs, signalInfo sigInfo,
+                         int64_t nowUs, uint32_t* target) = 0;
+
+    // queueDurationUs is the media duration waiting in the RTP packet queue
+    virtual bool onQueueDelay(uint32_t queueDurationUs, int64_t nowUs, uint32_t* target) = 0;
+
+    virtual void reset() {}
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_CONGESTION_CONTROLLER_H_
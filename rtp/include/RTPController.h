@@ -215,12 +215,18 @@ class RTPController : public IRTPController {
         kKeyTMMBN = 0x08,
         kKeyPLI = 0x10,
         kKeyGNACK = 0x20,
+        kKeyTWCC = 0x40,
     };
     // uint32_t mFeedBackFlag;
     uint8_t mFIRLastSeqNum;
 
     sp<ABuffer> mSliBuffer;
     sp<ABuffer> mGenericNACKBuffer;
+    // 64 FCIs, pending NACKs beyond it are replaced by the newest
+    static const size_t kMaxGenericNACKFCISize = 256;
+    // FCIs of transport wide feedback waiting for RTCP, the oldest is dropped beyond it
+    Vector<sp<ABuffer> > mTransportFeedbackFCIs;
+    static const size_t kMaxTransportFeedbackFCIs = 8;
 
     // for adaptation
     // bool m_isNWIndication;
@@ -314,6 +320,7 @@ class RTPController : public IRTPController {
     // for adaptation
     void addTMMBR(const sp<ABuffer>& buffer);
     void addTMMBN(const sp<ABuffer>& buffer);
+    void addTransportFeedback(const sp<ABuffer>& buffer);
 
     // this function must called in looper message,
     // it's the caller's responsible to lock this operation
@@ -327,6 +334,7 @@ class RTPController : public IRTPController {
     // for adaptation
     void onReceiveTMMBN(const sp<ABuffer> buffer);
     void onReceiveTMMBR(const sp<ABuffer> buffer);
+    void onReceiveTransportFeedback(const sp<ABuffer> buffer);
 
     void onSendFIR();
     void onReceiveCSD(int32_t trackIndex = IMSMA_RTP_VIDEO);
@@ -339,6 +347,7 @@ class RTPController : public IRTPController {
     // for adaptation
     void onSendTMMBR(sp<ABuffer> buffer, bool isReduce);
     void onSendTMMBN(sp<ABuffer> buffer);
+    void onSendTransportFeedback(sp<ABuffer> buffer);
     bool scanTMMBR(sp<ABuffer> rtcp_packet);
 
     enum {
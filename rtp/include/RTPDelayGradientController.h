@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_DELAY_GRADIENT_CONTROLLER_H_
+
+#define _IMS_RTP_DELAY_GRADIENT_CONTROLLER_H_
+
+#include "RTPCongestionController.h"
+
+#include <media/stagefright/foundation/ABase.h>
+
+namespace imsma {
+
+// Delay gradient congestion controller, after draft-ietf-rmcat-gcc-02.
+// Delay based: packets sent within kBurstIntervalUs are grouped, the one way delay
+// variation between groups goes through a trendline filter and an overuse detector
+// with adaptive threshold, and an AIMD rate control follows the detector.
+// Loss based: the fraction lost of the report blocks, used while no per packet
+// feedback is received.
+// The target is the lowest of both, TMMBR and the max bit rate.
+class RTPDelayGradientController : public RTPCongestionController {
+  public:
+    // packets of one frame burst are one group
+    static const int64_t kBurstIntervalUs = 5000ll;
+    // regression window of the trendline filter, in groups
+    static const size_t kTrendlineWindowSize = 20;
+    // must be power of 2
+    static const uint32_t kSentHistorySize = 1024;
+    static const uint32_t kMinBitrate = 64000;
+    static const int64_t kAckedBitrateWindowUs = 500000ll;
+    // overuse lasting this long is a real congestion, not a single delayed group
+    static const int64_t kOveruseTimeThresholdUs = 10000ll;
+    // sender queue longer than this means the encoder outruns the network
+    static const uint32_t kQueueDelayHighWaterUs = 300000;
+
+    RTPDelayGradientController();
+    virtual ~RTPDelayGradientController();
+
+    virtual const char* getName() const { return "delay_gradient"; }
+
+    virtual void setMaxBitrate(uint32_t maxBitrate);
+
+    virtual void onPacketSent(uint16_t seqNum, uint32_t size, int64_t sendTimeUs);
+    virtual bool onPacketFeedback(const PacketFeedback* feedbacks, size_t count, int64_t nowUs,
+                                  uint32_t* target);
+
+    virtual bool onReportBlock(uint8_t* data, int32_t containTMMBR, int64_t rttUs,
+                               signalInfo sigInfo, int64_t nowUs, uint32_t* target,
+                               bool* needForceI);
+    virtual bool onTMMBR(uint8_t* fci, uint32_t queueDurationUs, signalInfo sigInfo,
+                         int64_t nowUs, uint32_t* target);
+    virtual bool onQueueDelay(uint32_t queueDurationUs, int64_t nowUs, uint32_t* target);
+
+    virtual void reset();
+
+  private:
+    enum BandwidthUsage {
+        kUsageNormal,
+        kUsageUnderusing,
+        kUsageOverusing,
+    };
+
+    enum RateControlState {
+        kStateHold,
+        kStateIncrease,
+        kStateDecrease,
+    };
+
+    struct SentPacket {
+        bool mValid;
+        uint16_t mSeqNum;
+        uint32_t mSize;
+        int64_t mSendTimeUs;
+    };
+
+    struct PacketGroup {
+        bool mValid;
+        int64_t mFirstSendTimeUs;
+        int64_t mSendTimeUs;  // of the last packet
+        int64_t mArrivalTimeUs;
+    };
+
+    SentPacket* mSentPackets;
+
+    PacketGroup mCurrentGroup;
+    PacketGroup mPrevGroup;
+
+    // trendline filter
+    int64_t mFirstArrivalTimeUs;
+    double mAccumulatedDelayMs;
+    double mSmoothedDelayMs;
+    double mTrendX[kTrendlineWindowSize];
+    double mTrendY[kTrendlineWindowSize];
+    size_t mTrendCount;
+    size_t mTrendIndex;
+    uint32_t mNumDeltas;
+    double mPrevTrend;
+
+    // overuse detector
+    double mThresholdMs;
+    int64_t mLastThresholdUpdateUs;
+    double mTimeOverUsingMs;
+    uint32_t mOveruseCount;
+    BandwidthUsage mUsage;
+
+    // acked bit rate
+    int64_t mAckedWindowStartUs;
+    uint64_t mAckedBytes;
+    uint32_t mAckedBitrate;
+
+    // rate control
+    RateControlState mState;
+    uint32_t mDelayBasedBitrate;
+    int64_t mLastRateUpdateUs;
+    int64_t mLastDecreaseUs;
+    // acked bit rate at the last decrease, 0 if not known
+    uint32_t mLinkCapacity;
+    int64_t mRTTUs;
+    bool mHasFeedback;
+
+    uint32_t mLossBasedBitrate;
+    // packets of the per packet feedback since the last loss based update
+    uint32_t mLossReceived;
+    uint32_t mLossLost;
+    int64_t mLastLossDecreaseUs;
+    int64_t mLastLossIncreaseUs;
+
+    uint32_t mTMMBRBitrate;
+    uint32_t mMaxBitrate;
+
+    uint32_t mLastTarget;
+    int64_t mLastTargetUs;
+
+    void onGroupComplete(const PacketGroup& group, int64_t nowUs);
+    void updateTrendline(double recvDeltaMs, double sendDeltaMs, int64_t arrivalTimeUs,
+                         int64_t nowUs);
+    void detect(double trend, double sendDeltaMs, int64_t nowUs);
+    void updateThreshold(double modifiedTrend, int64_t nowUs);
+    void updateAckedBitrate(uint32_t size, int64_t arrivalTimeUs);
+    void updateDelayBasedBitrate(int64_t nowUs);
+    void updateLossBasedBitrate(uint32_t lossPermille, int64_t nowUs);
+    bool updateTarget(int64_t nowUs, uint32_t* target);
+
+    DISALLOW_EVIL_CONSTRUCTORS(RTPDelayGradientController);
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_DELAY_GRADIENT_CONTROLLER_H_
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_JITTER_ESTIMATOR_H_
+
+#define _IMS_RTP_JITTER_ESTIMATOR_H_
+
+#include <stdint.h>
+
+#include <media/stagefright/foundation/ABase.h>
+
+namespace imsma {
+
+// Target depth of the RTPSource jitter buffer, the packets stay in RTPReorderQueue.
+// The depth is how long a missing packet is waited before the assembler skips it:
+// kJitterFactor times the RFC 3550 interarrival jitter, raised when packets come
+// after being skipped (late loss) and covering one retransmission while NACK is
+// recovering losses.
+// Not thread safe, RTPSource uses it from the RTPReceiver looper.
+class RTPJitterEstimator {
+  public:
+    // same as the fixed first packet wait used before the estimate
+    static const int64_t kInitialTargetUs = 50000ll;
+    // same as the reorder tolerance of RTPAssembler used before
+    static const int64_t kMinTargetUs = 5000ll;
+    static const int64_t kMaxTargetUs = 300000ll;
+    static const int64_t kJitterFactor = 3;
+    // larger transit time difference is a discontinuity of rtp time
+    static const int64_t kMaxTransitDiffUs = 1000000ll;
+    // packets needed before the jitter estimate is trusted
+    static const uint32_t kMinPacketsForEstimate = 64;
+
+    // late loss is counted over this window
+    static const int64_t kLateLossWindowUs = 2000000ll;
+    // 1%, raise the target by kLateStepUs when late loss is above it in a window
+    static const uint32_t kLateLossHighPermille = 10;
+    static const int64_t kLateStepUs = 10000ll;
+
+    RTPJitterEstimator();
+
+    void setClockRate(uint32_t clockRate) { mClockRate = clockRate; }
+
+    void onPacketArrived(uint32_t rtpTime, int64_t recvTimeUs);
+    // a packet arrived after the assembler had skipped it
+    void onLatePacket() { mWindowLate++; }
+
+    // extra depth for one retransmission, 0 if NACK is not recovering losses
+    void setRetransmissionDelayUs(int64_t delayUs);
+
+    int64_t getTargetDelayUs() const { return mTargetDelayUs; }
+    int64_t getJitterUs() const { return mJitterUs; }
+    // late loss of the last complete window, in 1/1000
+    uint32_t getLateLossPermille() const { return mLateLossPermille; }
+
+    void reset();
+
+  private:
+    uint32_t mClockRate;
+
+    bool mHasLastPacket;
+    uint32_t mLastRtpTime;
+    int64_t mLastRecvTimeUs;
+    uint32_t mPacketCount;
+    int64_t mJitterUs;
+
+    int64_t mWindowStartUs;
+    uint32_t mWindowReceived;
+    uint32_t mWindowLate;
+    uint32_t mLateLossPermille;
+    int64_t mLateBoostUs;
+
+    int64_t mRetransmissionDelayUs;
+    int64_t mTargetDelayUs;
+
+    void updateLateLoss(int64_t nowUs);
+    void updateTarget();
+
+    DISALLOW_EVIL_CONSTRUCTORS(RTPJitterEstimator);
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_JITTER_ESTIMATOR_H_
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_NACK_TRACKER_H_
+
+#define _IMS_RTP_NACK_TRACKER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <media/stagefright/foundation/ABase.h>
+#include <media/stagefright/foundation/ABuffer.h>
+#include <utils/KeyedVector.h>
+#include <utils/StrongPointer.h>
+
+using namespace android;
+
+namespace imsma {
+
+// Missing packet list of RTPSource for Generic NACK (RFC 4585).
+// Holes in the extended seqNum are requested after a short reorder hold,
+// then requested again every RTT until kMaxRetries, and are given up when
+// the deadline (the delay the jitter buffer can afford) has passed.
+// Not thread safe, RTPSource uses it from the RTPReceiver looper.
+class RTPNackTracker {
+  public:
+    // same as the reorder tolerance of RTPAssembler
+    static const int64_t kReorderHoldUs = 5000ll;
+    static const int64_t kDefaultRTTUs = 100000ll;
+    static const int64_t kMinRetryIntervalUs = 20000ll;
+    static const uint32_t kMaxRetries = 3;
+    // larger gap is cheaper to recover by a key frame
+    static const size_t kMaxMissing = 256;
+    // FCIs of one NACK, 16 FCIs cover at least 16 and at most 272 packets
+    static const size_t kMaxFCIs = 16;
+
+    RTPNackTracker();
+
+    void setDeadlineUs(int64_t deadlineUs) { mDeadlineUs = deadlineUs; }
+    int64_t getDeadlineUs() const { return mDeadlineUs; }
+    void setRTTUs(int64_t rttUs);
+    int64_t getRTTUs() const { return mRTTUs; }
+
+    // seqNum is the extended seqNum just received,
+    // highestSeqNum is the highest extended seqNum received before it
+    void onPacketReceived(uint32_t seqNum, uint32_t highestSeqNum, int64_t nowUs);
+
+    // FCIs(PID + BLP) of the missing packets due to request, NULL if none is due
+    sp<ABuffer> buildFCIs(int64_t nowUs);
+
+    // forget the missing packets past deadline, return the count given up
+    size_t removeExpired(int64_t nowUs);
+
+    // whether a missing packet before seqNum can still be retransmitted in time
+    bool isPendingBefore(uint32_t seqNum, int64_t nowUs) const;
+
+    // time of the next request or expiry, -1 if no missing packet
+    int64_t nextEventUs() const;
+
+    size_t size() const { return mMissing.size(); }
+    void clear() { mMissing.clear(); }
+
+    uint32_t getRequestedCount() const { return mRequestedCount; }
+    uint32_t getRecoveredCount() const { return mRecoveredCount; }
+    uint32_t getGivenUpCount() const { return mGivenUpCount; }
+
+  private:
+    struct MissingInfo {
+        int64_t mDetectedUs;
+        int64_t mNextRequestUs;
+        uint32_t mRetries;
+    };
+
+    // sorted by extended seqNum, which is also the order of mDetectedUs
+    KeyedVector<uint32_t, MissingInfo> mMissing;
+
+    int64_t mDeadlineUs;
+    int64_t mRTTUs;
+    bool mRTTMeasured;
+
+    uint32_t mRequestedCount;
+    uint32_t mRecoveredCount;
+    uint32_t mGivenUpCount;
+
+    int64_t retryIntervalUs() const;
+
+    DISALLOW_EVIL_CONSTRUCTORS(RTPNackTracker);
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_NACK_TRACKER_H_
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_PACER_H_
+
+#define _IMS_RTP_PACER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <media/stagefright/foundation/ABase.h>
+
+namespace imsma {
+
+// Token bucket pacing of the RTP packets of RTPSender.
+// The budget grows at the pacing rate (target bitrate * pacing factor) and is
+// capped to kMaxBurstUs of it, a packet goes out while the budget is positive
+// and is billed after being sent, so the budget may go into debt by one packet.
+// An I frame is spread over several ms instead of leaving as one burst.
+// Not thread safe, RTPSender uses it from its own looper.
+class RTPPacer {
+  public:
+    // 2.5 times of the target bitrate, keeps the frame delay short
+    static const uint32_t kDefaultPacingFactorPercent = 250;
+    // budget kept while idle, about one MTU at 2 Mbps
+    static const int64_t kMaxBurstUs = 5000ll;
+    // shorter wait is not worth a looper message
+    static const int64_t kMinWaitUs = 1000ll;
+    // longer queue means the encoder is above the pacing rate, drain it unpaced
+    static const int64_t kMaxQueueDurationUs = 200000ll;
+
+    RTPPacer();
+
+    // 0 disables pacing
+    void setPacingFactor(uint32_t percent);
+    // in bps, 0 disables pacing
+    void setTargetBitrate(uint32_t bitrate);
+
+    bool isEnabled() const { return mPacingRate > 0; }
+    uint32_t getPacingRate() const { return mPacingRate; }
+
+    // refill the budget up to nowUs
+    void updateBudget(int64_t nowUs);
+    // whether one more packet can go after billedBytes already gathered
+    bool canSend(size_t billedBytes = 0) const {
+        return !isEnabled() || mBudget > (int64_t)billedBytes * 8 * 1000000ll;
+    }
+    void onPacketSent(size_t size);
+    // wait until the budget is positive again
+    int64_t getWaitUs() const;
+
+    void reset();
+
+  private:
+    uint32_t mPacingFactorPercent;
+    uint32_t mTargetBitrate;
+    uint32_t mPacingRate;  // in bps
+
+    // in 1/1000000 bit, so the budget of a short interval is not truncated
+    int64_t mBudget;
+    int64_t mLastUpdateUs;
+
+    void updatePacingRate();
+
+    DISALLOW_EVIL_CONSTRUCTORS(RTPPacer);
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_PACER_H_
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_PACKET_INFO_H_
+
+#define _IMS_RTP_PACKET_INFO_H_
+
+#include <stdint.h>
+
+namespace imsma {
+
+// Header fields of a received RTP packet.
+// RTPReceiver fills it once, it is kept next to the payload in RTPReorderQueue
+// and read by RTPSource and the assemblers without the string keyed
+// ABuffer::meta() lookups. Only the access units going to the sink carry meta.
+struct RTPPacketInfo {
+    uint32_t mSSRC;
+    uint32_t mRtpTime;
+    // seqNum before extending
+    int32_t mToken;
+    uint8_t mPT;
+    uint8_t mMarker;
+
+    // CVO of the video packets
+    int32_t mCCWRotation;
+    int32_t mCameraFacing;
+    int32_t mFlip;
+
+    // for adaptation
+    int32_t mRtpSize;
+    int32_t mRtpOverhead;
+
+    // set by RTPSource when the packet is queued
+    int64_t mRecvTimeUs;
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_PACKET_INFO_H_
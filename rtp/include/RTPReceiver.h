@@ -30,6 +30,7 @@
 
 #include <utils/Errors.h>
 #include "RTPSource.h"
+#include "RTPTransportFeedback.h"
 
 using namespace android;
 using android::status_t;
@@ -57,6 +58,7 @@ class RTPReceiver : public AHandler {
         kWhatNoRTP = 'noda',
         kWhatTriggerPli = 'tpli',
         kWhatTriggerFir = 'tfir',
+        kWhatTransportFeedback = 'twfb',
     };
     /**
      *@ Description: static function of get RTP module capability, RTP may supporte serveral media
@@ -208,6 +210,7 @@ class RTPReceiver : public AHandler {
     // status_t queueRTCPPacket(sp<ABuffer> &packet,int32_t trackIndex = IMSMA_RTP_VIDEO);
 
     static int videoRTPPacketCallBack(void* cookie, const sp<ABuffer>& buffer);
+    static int videoRTPPacketBatchCallBack(void* cookie, const sp<ABuffer>* buffers, int count);
 
     bool isActive(uint8_t trackIndex);
 
@@ -237,6 +240,10 @@ class RTPReceiver : public AHandler {
 
     uint8_t addReceiveReportBlocks(const sp<ABuffer>& buffer, uint8_t trackIndex = IMSMA_RTP_VIDEO);
 
+    // RTT measured by RTPSender from the LSR/DLSR of peer's report block,
+    // used to schedule the Generic NACK retries and size the jitter buffer
+    status_t updateRoundTripTime(int64_t rttUs, int32_t trackIndex = IMSMA_RTP_VIDEO);
+
     // status_t getSrcSSRC(uint32_t* ssrc,uint8_t trackIndex = IMSMA_RTP_VIDEO);
 
     Vector<sp<ABuffer> >* video_queue() { return &mVideoRTPQueue; }
@@ -281,6 +288,8 @@ class RTPReceiver : public AHandler {
     status_t changeSSRC(sp<ABuffer>& packet, int32_t trackIndex, uint32_t newSsrc);
 
     status_t onProcessSenderInfo(const sp<ABuffer>& buffer, uint32_t uSSRC, uint8_t trackIndex);
+    void pollSource(int32_t trackIndex);
+    void sendTransportFeedback(int32_t trackIndex);
     status_t onPeerPausedSendStream(uint8_t trackIndex);
     status_t onPeerResumedSendStream(uint8_t trackIndex);
     // status_t onGetSrcSSRC(uint32_t* ssrc,uint8_t trackIndex);
@@ -313,7 +322,16 @@ class RTPReceiver : public AHandler {
         uint32_t mLastAccuRtpTime;
         uint32_t mRtpTimeCycles;
         // int64_t mNtpTimeUs;
-        List<uint32_t> mLostPacketSeqNumList;
+        // time of the posted kWhatPollSource, -1 if none
+        int64_t mPollTimeUs;
+        int32_t mPollGeneration;
+
+        // transport wide seq extension id, 0 if not negotiated
+        uint8_t mTransportCCExtId;
+        RTPTransportFeedback mTransportFeedback;
+        // kWhatSendTransportFeedback is posted, stops when no packet arrives
+        bool mFeedbackScheduled;
+        int32_t mFeedbackGeneration;
 
         bool mIsFirstAccu;
         uint32_t mRtpTimeAnchor;
@@ -343,7 +361,12 @@ class RTPReceiver : public AHandler {
             mLastAccuRtpTime = 0;
             mRtpTimeCycles = 0;
 
-            mLostPacketSeqNumList.clear();
+            mPollTimeUs = -1;
+            mPollGeneration = 0;
+
+            mTransportCCExtId = 0;
+            mFeedbackScheduled = false;
+            mFeedbackGeneration = 0;
 
             mIsFirstAccu = true;
             mRtpTimeAnchor = 0;
@@ -363,7 +386,6 @@ class RTPReceiver : public AHandler {
       protected:
         ~TrackInfo() {
             // if(extension_header)
-            mLostPacketSeqNumList.clear();
         }
     };
     Vector<sp<TrackInfo> > mpTrackInfos;
@@ -413,6 +435,9 @@ class RTPReceiver : public AHandler {
         kWhatRTPPacket = 'RTPp',
 
         kWhatProcessSR = 'pssr',
+        kWhatUpdateRTT = 'uRTT',
+        kWhatPollSource = 'poSr',
+        kWhatSendTransportFeedback = 'sdtf',
         kWhatProcessTMMBN = 'tmbn',
 
         kWhatHoldOn = 'hold',
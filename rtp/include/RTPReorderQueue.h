@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_REORDER_QUEUE_H_
+
+#define _IMS_RTP_REORDER_QUEUE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <media/stagefright/foundation/ABase.h>
+#include <media/stagefright/foundation/ABuffer.h>
+#include <utils/StrongPointer.h>
+
+#include "RTPPacketInfo.h"
+
+using namespace android;
+
+namespace imsma {
+
+// Fixed-capacity jitter buffer for RTPSource.
+// Packets are stored in the slot (extended seqNum % kCapacity), so insert,
+// duplicate check and head pop are O(1) instead of walking a sorted List.
+// The extended seqNum of each packet is kept in ABuffer::int32Data() as before,
+// its RTPPacketInfo is kept in the same slot of a POD array.
+// Not thread safe, RTPSource and the assemblers use it from the same looper.
+class RTPReorderQueue {
+  public:
+    enum InsertResult {
+        INSERTED,
+        DUPLICATE,
+        TOO_OLD,
+    };
+
+    // must be power of 2, ~1.2MB of 1200 bytes packets
+    static const uint32_t kCapacity = 1024;
+
+    RTPReorderQueue();
+    ~RTPReorderQueue();
+
+    InsertResult insert(const sp<ABuffer>& buffer, const RTPPacketInfo& info);
+
+    bool empty() const { return mCount == 0; }
+    size_t size() const { return mCount; }
+
+    // packet with the lowest seqNum, queue must not be empty
+    const sp<ABuffer>& front() const { return mSlots[mHeadSeq & kMask]; }
+    const RTPPacketInfo& frontInfo() const { return mInfos[mHeadSeq & kMask]; }
+    // packet with the highest seqNum, queue must not be empty
+    const sp<ABuffer>& back() const { return mSlots[(mTailSeq - 1) & kMask]; }
+
+    void pop_front();
+    void clear();
+
+  private:
+    static const uint32_t kMask = kCapacity - 1;
+
+    sp<ABuffer>* mSlots;
+    RTPPacketInfo* mInfos;
+    size_t mCount;
+    // [mHeadSeq, mTailSeq) is the seqNum window held in mSlots,
+    // the slots of both ends are always occupied when not empty
+    uint32_t mHeadSeq;
+    uint32_t mTailSeq;
+
+    void dropFrontUntil(uint32_t seqNum);
+
+    DISALLOW_EVIL_CONSTRUCTORS(RTPReorderQueue);
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_REORDER_QUEUE_H_
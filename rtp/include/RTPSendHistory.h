@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_SEND_HISTORY_H_
+
+#define _IMS_RTP_SEND_HISTORY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <media/stagefright/foundation/ABase.h>
+#include <media/stagefright/foundation/ABuffer.h>
+#include <utils/StrongPointer.h>
+
+using namespace android;
+
+namespace imsma {
+
+// History of sent RTP packets, so RTPSender can answer Generic NACK with resends.
+// Packets are stored in the slot (16 bits seqNum % kCapacity) with their send time,
+// insert and lookup are O(1). Packets older than the window are not resent any more,
+// and the caller falls back to an intra refresh for them.
+// The zero copy FU packets keep their payload referenced by the meta "payload" buffer.
+// Not thread safe, RTPSender uses it from its own looper.
+class RTPSendHistory {
+  public:
+    enum LookupResult {
+        FOUND,
+        RESENT_RECENTLY,  // resent within kMinResendIntervalUs, NACK is a repeat
+        NOT_FOUND,        // never sent, overwritten or aged out
+    };
+
+    // must be power of 2, ~600KB of MTU packets
+    static const uint32_t kCapacity = 512;
+    // avoid resending the same packet for every NACK repetition
+    static const int64_t kMinResendIntervalUs = 50000ll;
+
+    RTPSendHistory();
+    ~RTPSendHistory();
+
+    void setWindowUs(int64_t windowUs) { mWindowUs = windowUs; }
+    int64_t getWindowUs() const { return mWindowUs; }
+
+    void insert(const sp<ABuffer>& rtpPacket, uint16_t seqNum, int64_t sentUs);
+
+    // on FOUND, *rtpPacket is set and the packet is marked as resent at nowUs
+    LookupResult lookup(uint16_t seqNum, int64_t nowUs, sp<ABuffer>* rtpPacket);
+
+    void clear();
+
+  private:
+    struct Entry {
+        sp<ABuffer> packet;
+        uint16_t seqNum;
+        int64_t sentUs;
+        int64_t resentUs;
+    };
+
+    static const uint32_t kMask = kCapacity - 1;
+
+    Entry* mSlots;
+    int64_t mWindowUs;
+
+    DISALLOW_EVIL_CONSTRUCTORS(RTPSendHistory);
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_SEND_HISTORY_H_
@@ -18,6 +18,10 @@
 #define _IMS_RTP_SENDER_H_
 
 #include "RTPBase.h"
+#include "RTPCongestionController.h"
+#include "RTPPacer.h"
+#include "RTPSendHistory.h"
+#include "RTPTransportFeedback.h"
 #include "TxAdaptationInfo.h"
 #include <SocketWrapper.h>
 
@@ -187,13 +191,16 @@ class RTPSender : public AHandler {
     uint32_t getRTPSentCount();
     void addSenderInfo(const sp<ABuffer>& buffer);
 
-    status_t processReportBlock(const sp<ABuffer>& packet);
+    // rttUs: RTT measured from LSR/DLSR of the report block, -1 if not available
+    status_t processReportBlock(const sp<ABuffer>& packet, int64_t* rttUs = NULL);
     // for FIR
     void processFIR(uint8_t seqNum);
     void processGenericNACKFB(sp<ABuffer> nack_fcis);
 
     // for adaptation
     void processTMMBR(sp<ABuffer> tmmbr_fci);
+    // FCI of RTPFB FMT=15, arrival times of the transport wide seqs
+    void processTransportFeedback(sp<ABuffer> fb_fci);
 
     // ToDo: maybe not usable
     // RTPSender should keep align with RTPController's ssrc
@@ -226,17 +233,25 @@ class RTPSender : public AHandler {
                                              sp<ABuffer>& out, int32_t* packetCount);
 
     void queueRTPPacket(sp<ABuffer> rtpPacket);
+    int sendRTPPacketBatch(int maxCount);
+    bool isRTPQueueOverdue();
+    void fillIoPacket(const sp<ABuffer>& rtpPacket, Sock_iopacket_t* packet);
+    size_t getRTPPacketSize(const sp<ABuffer>& rtpPacket);
     status_t addRTPFixHeader(sp<ABuffer> rtpPacket);
     status_t addRTPExtHeader(sp<ABuffer> rtpPacket);
     void postSendRTPMessage();
 
     void onAddSenderInfo(const sp<ABuffer>& buffer);
     status_t onProcessReportBlock(const sp<ABuffer>& packet);
+    int64_t calculateRoundTripTime(const uint8_t* reportBlock);
     void onProcessFIR(uint8_t seqNum);
     void onProcessGenericNACK(const sp<ABuffer> nack_fcis);
+    bool resendNACKedPackets(const sp<ABuffer>& nack_fcis);
+    int resendRTPPacket(const sp<ABuffer>& rtpPacket);
 
     /*******for adaptation start*****/
     void onProcessTMMBR(const sp<ABuffer> tmmbr_fci);
+    void onProcessTransportFeedback(const sp<ABuffer> fb_fci);
     void updateStatisticInfo(sp<ABuffer> rtpPacket);
     void updateEncBitRate(const sp<ABuffer> accessUnit);
     bool checkAllowIncrEncBR();
@@ -250,6 +265,22 @@ class RTPSender : public AHandler {
     uint32_t getMaxBitrate();
 
     int32_t mMTUSize;  // Need check whether can get from modem or other network AL
+    // FU payload stays in the accu and is gathered by sendmmsg, no memcpy
+    bool mZeroCopyTx;
+    static const int32_t kRTPHeaderBufferSize = 64;  // fix + ext + FU headers
+    // sent packets kept for Generic NACK, window 0 means NACK is always answered by intra refresh
+    RTPSendHistory mSendHistory;
+    static const int32_t kDefaultNACKHistoryMs = 1000;
+    // spreads the packets of a frame, vendor.vt.imsma.rtp_pacing_factor in percent, 0 disables
+    RTPPacer mPacer;
+    uint32_t mResentCount;
+    uint64_t mResentBytes;
+    // middle 32 bits of NTP timestamp and sent time of the recent SRs, for RTT
+    static const size_t kSRHistorySize = 4;
+    uint32_t mSRNtpMid[kSRHistorySize];
+    int64_t mSRSentTimeUs[kSRHistorySize];
+    size_t mSRHistoryIndex;
+    int64_t mLastRTTUs;
     rtp_rtcp_config_t mConfigParam;
 
     sp<AMessage> mNotify;
@@ -274,6 +305,10 @@ class RTPSender : public AHandler {
     uint8_t m_extmap_CVO_supported;
     uint8_t m_extmap_CVO_id;
 
+    uint8_t m_extmap_TWCC_supported;
+    uint8_t m_extmap_TWCC_id;
+    uint16_t mTransportSeqNum;
+
     uint8_t m_rtp_fix_header_len;
     uint8_t m_rtp_ext_header_len;
 
@@ -283,6 +318,8 @@ class RTPSender : public AHandler {
     uint32_t mSSRC;
 
     TxAdaptationInfo* mAdaInfo;
+    // decides the encoding bit rate, vendor.vt.imsma.rtp_cc selects the backend
+    RTPCongestionController* mCongestionController;
     uint32_t mSimID;
     uint32_t mOperatorID;
 #ifdef DEBUG_DUMP_PACKET
@@ -315,6 +352,7 @@ class RTPSender : public AHandler {
         kWhatProcessFIR = 'pfir',
         kWhatProcessNACK = 'pnak',
         kWhatProcessTMMBR = 'ptmr',
+        kWhatProcessTransportFeedback = 'ptfb',
 
         kWhatUpdateSSRC = 'upsr',
         kWhatGetSSRC = 'gtsr',
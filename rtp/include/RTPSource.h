@@ -31,6 +31,9 @@
 #include <media/stagefright/foundation/AHandler.h>
 #include <media/stagefright/foundation/ALooper.h>
 #include "RTPBase.h"
+#include "RTPJitterEstimator.h"
+#include "RTPNackTracker.h"
+#include "RTPReorderQueue.h"
 #include "RxAdaptationInfo.h"
 
 using namespace android;
@@ -53,12 +56,12 @@ class RTPSource : public RefBase {
     RTPSource(uint32_t srcId, rtp_rtcp_config_t* pConfigPram, int32_t iTrackIndex,
               sp<AMessage>& notify);
 
-    void processRTPPacket(const sp<ABuffer>& buffer);
+    void processRTPPacket(const sp<ABuffer>& buffer, RTPPacketInfo* info);
     status_t processSenderInfo(const sp<ABuffer>& buffer);
     // void timeUpdate(uint32_t rtpTime, uint64_t ntpTime);
     // void byeReceived();
 
-    List<sp<ABuffer> >* queue() { return &mQueue; }
+    RTPReorderQueue* queue() { return &mQueue; }
     void setSsrc(uint32_t newSsrc) { mID = newSsrc; }
 
     bool isCSD(const sp<ABuffer>& accessUnit);
@@ -66,6 +69,21 @@ class RTPSource : public RefBase {
     void reset();
 
     status_t addReceiverReportBlock(const sp<ABuffer>& buffer);
+
+    // time driven work of jitter buffer and Generic NACK:
+    // release the packets whose wait expired and return NACK FCIs due to send,
+    // *nextCheckUs is the delay of the next poll or -1
+    sp<ABuffer> poll(int64_t* nextCheckUs);
+    // whether the assembler should keep waiting for a NACKed packet
+    bool isRetransmissionPending();
+    void updateRoundTripTime(int64_t rttUs);
+
+    // for jitter buffer
+    // how long the assembler waits for a missing packet
+    int64_t getReorderWaitUs() const { return mJitterEstimator.getTargetDelayUs(); }
+    void onLatePacket() { mJitterEstimator.onLatePacket(); }
+    int64_t getJitterBufferDepthUs() const { return mJitterEstimator.getTargetDelayUs(); }
+    uint32_t getLateLossPermille() const { return mJitterEstimator.getLateLossPermille(); }
     // void addSDES(const AString& cname, const sp<ABuffer> &buffer);
     // void addFIR(const sp<ABuffer> &buffer);
 
@@ -106,9 +124,23 @@ class RTPSource : public RefBase {
     uint32_t mFirstPacketSeqNum;
     uint32_t mClockRate;
 
-    List<sp<ABuffer> > mQueue;
+    RTPReorderQueue mQueue;
     sp<RTPAssembler> mAssembler;
 
+    // packets are held until the first packet waited for the jitter buffer depth
+    bool mReleaseStarted;
+    RTPJitterEstimator mJitterEstimator;
+
+    // missing packets are only tracked when peer accepts Generic NACK
+    bool mSupportGenericNACK;
+    RTPNackTracker mNackTracker;
+    // most depth the jitter buffer may add for a retransmission
+    int64_t mMaxRetransmissionDelayUs;
+    static const int32_t kDefaultMaxRetransmissionDelayMs = 150;
+    // depth for retransmission is kept this long after the last gap
+    static const int64_t kLossMemoryUs = 10000000ll;
+    int64_t mLastGapUs;
+
     uint32_t getLostCount();
     uint32_t getIDamageCount();
 
@@ -116,14 +148,18 @@ class RTPSource : public RefBase {
     // int64_t mLastFIRRequestUs;
     // uint8_t mNextFIRSeqNo;
 
-    bool queuePacket(const sp<ABuffer>& buffer);
+    bool queuePacket(const sp<ABuffer>& buffer, RTPPacketInfo* info);
     uint32_t extendSeqNumber(uint32_t seqNum, uint32_t mHighestSeqNumber);
-    void calculateArrivalJitter(const sp<ABuffer>& buffer);
+    void calculateArrivalJitter(RTPPacketInfo* info);
 
     void flushQueue();
 
+    void updateGenericNACKSupport(rtp_rtcp_config_t* pConfigPram);
+    void updatePlayoutTarget(int64_t nowUs);
+    int64_t getReleaseTimeUs();
+
     /******for adaptation start********/
-    void updateStatisticInfo(const sp<ABuffer> buffer);
+    void updateStatisticInfo(const sp<ABuffer> buffer, RTPPacketInfo* info);
     bool checkAllowIncrEncBR();
     void NotifyTMMBR();
     /******for adaptation end********/
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IMS_RTP_TRANSPORT_FEEDBACK_H_
+
+#define _IMS_RTP_TRANSPORT_FEEDBACK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "RTPBase.h"
+#include "RTPCongestionController.h"
+
+#include <media/stagefright/foundation/ABase.h>
+#include <media/stagefright/foundation/ABuffer.h>
+#include <utils/StrongPointer.h>
+#include <utils/Vector.h>
+
+using namespace android;
+
+namespace imsma {
+
+// Transport wide congestion control feedback,
+// draft-holmer-rmcat-transport-wide-cc-extensions-01.
+// The sender numbers every RTP packet in the one-byte header extension,
+// the receiver records the arrival time of each number and reports them in
+// RTPFB FMT=15 every kFeedbackIntervalUs: packet status chunks
+// (run length, 1 bit or 2 bits vector) and receive deltas in 250us.
+// Not thread safe, RTPReceiver uses it from its own looper.
+class RTPTransportFeedback {
+  public:
+    static const char* const kExtensionURI;
+    static const uint8_t kFMT = 15;
+    static const int64_t kFeedbackIntervalUs = 100000ll;
+    // must be power of 2
+    static const uint32_t kHistorySize = 1024;
+    // packets of one FCI, keeps the RTCP packet far below MTU
+    static const uint32_t kMaxStatusCount = 256;
+
+    RTPTransportFeedback();
+    ~RTPTransportFeedback();
+
+    // id of the negotiated extension, 0 if not negotiated
+    static uint8_t getExtensionId(const rtp_rtcp_config_t* config);
+
+    // receiver side
+    void onPacketArrived(uint16_t transportSeq, int64_t arrivalTimeUs);
+    // FCI of the packets since the last FCI, NULL if nothing to report
+    sp<ABuffer> buildFCI();
+    void reset();
+
+    // sender side, arrival times are in the receiver clock
+    static bool parseFCI(const uint8_t* data, size_t size,
+                         Vector<RTPCongestionController::PacketFeedback>* feedbacks);
+
+  private:
+    enum {
+        kStatusNotReceived = 0,
+        kStatusSmallDelta = 1,
+        kStatusLargeDelta = 2,
+    };
+
+    int64_t* mArrivalTimeUs;  // -1 if not arrived
+    bool mStarted;
+    // extended transport seq
+    int64_t mNextSeq;
+    int64_t mHighestSeq;
+    int64_t mLastReferenceTime;
+    uint8_t mFeedbackCount;
+
+    int64_t extendSeq(uint16_t seq) const;
+
+    DISALLOW_EVIL_CONSTRUCTORS(RTPTransportFeedback);
+};
+
+}  // namespace imsma
+
+#endif  // _IMS_RTP_TRANSPORT_FEEDBACK_H_
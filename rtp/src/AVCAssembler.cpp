@@ -50,6 +50,7 @@ AVCAssembler::AVCAssembler(const sp<AMessage> notify)
 
     mAccuCount = 0;
     mpNALFragmentInfo = NULL;
+    mNALSizeHint = 0;
 
     mLastLost = -1;
     mLastPacketReceiveTime = 0;
@@ -95,7 +96,7 @@ AVCAssembler::~AVCAssembler() {
 RTPAssembler::AssemblyStatus AVCAssembler::addNALUnit(const sp<RTPSource>& source) {
     ATRACE_CALL();
     ALOGV("%s", __FUNCTION__);
-    List<sp<ABuffer> >* queue = source->queue();
+    RTPReorderQueue* queue = source->queue();
 
     if (queue->empty()) {
         ALOGV("%s,source queue is empty", __FUNCTION__);
@@ -103,16 +104,15 @@ RTPAssembler::AssemblyStatus AVCAssembler::addNALUnit(const sp<RTPSource>& sourc
     }
 
     if (mNextExpectedSeqNoValid) {
-        List<sp<ABuffer> >::iterator it = queue->begin();
-
-        while (it != queue->end()) {
-            if ((uint32_t)(*it)->int32Data() >= mNextExpectedSeqNo) {
+        while (!queue->empty()) {
+            if ((uint32_t)queue->front()->int32Data() >= mNextExpectedSeqNo) {
                 break;
             }
 
             ALOGD("%s,drop unexpected SeqNo(%d) of source queue, mNextExpectedSeqNo(%d)",
-                  __FUNCTION__, (uint32_t)(*it)->int32Data(), mNextExpectedSeqNo);
-            it = queue->erase(it);
+                  __FUNCTION__, (uint32_t)queue->front()->int32Data(), mNextExpectedSeqNo);
+            queue->pop_front();
+            source->onLatePacket();
         }
 
         if (queue->empty()) {
@@ -120,66 +120,53 @@ RTPAssembler::AssemblyStatus AVCAssembler::addNALUnit(const sp<RTPSource>& sourc
         }
     }
 
-    sp<ABuffer> buffer = *queue->begin();
+    sp<ABuffer> buffer = queue->front();
+    const RTPPacketInfo& info = queue->frontInfo();
 
     if (!mNextExpectedSeqNoValid) {
         mNextExpectedSeqNoValid = true;
         mNextExpectedSeqNo = (uint32_t)buffer->int32Data();
         ALOGI("%s,first seq = %d", __FUNCTION__, mNextExpectedSeqNo);
     } else if ((uint32_t)buffer->int32Data() != mNextExpectedSeqNo) {
-        int64_t recv_time = 0;
-
-        if (buffer->meta()->findInt64("recv-time", &recv_time)) {
-            uint32_t nowseq = (uint32_t)buffer->int32Data();
-            uint32_t nowexpectseq = mNextExpectedSeqNo;
-
-            int64_t diff_time = recv_time - mLastPacketReceiveTime;
-            if (diff_time < 0) {
-                ALOGD("change diff_time for skip all lost judge %lld", (long long)diff_time);
-                diff_time = -diff_time;
-            }
+        int64_t recv_time = info.mRecvTimeUs;
+        uint32_t nowseq = (uint32_t)buffer->int32Data();
+        uint32_t nowexpectseq = mNextExpectedSeqNo;
+
+        int64_t diff_time = recv_time - mLastPacketReceiveTime;
+        if (diff_time < 0) {
+            ALOGD("change diff_time for skip all lost judge %lld", (long long)diff_time);
+            diff_time = -diff_time;
+        }
 
-            if ((mLastPacketReceiveTime != 0) && (diff_time > 200000)) {
-                ALOGD("skip all lost, NextExpectedSeqNo=%d, NowSeq=%d, time now(%lld)  last(%lld) "
-                      "diff=%lld",
-                      mNextExpectedSeqNo, nowseq, (long long)recv_time,
-                      (long long)mLastPacketReceiveTime, (long long)diff_time);
+        if ((mLastPacketReceiveTime != 0) && (diff_time > 200000)) {
+            ALOGD("skip all lost, NextExpectedSeqNo=%d, NowSeq=%d, time now(%lld)  last(%lld) "
+                  "diff=%lld",
+                  mNextExpectedSeqNo, nowseq, (long long)recv_time,
+                  (long long)mLastPacketReceiveTime, (long long)diff_time);
 
-                if (nowseq > nowexpectseq) {
-                    for (uint32_t i = nowexpectseq; i < nowseq; i++) {
-                        packetLostRegister();
-                    }
+            if (nowseq > nowexpectseq) {
+                for (uint32_t i = nowexpectseq; i < nowseq; i++) {
+                    packetLostRegister();
                 }
-
-                return SKIP_MISS_PACKET;
             }
 
-            AssemblyStatus assemble_status = getAssembleStatus(queue, mNextExpectedSeqNo);
-            ALOGV("%s,%d is not the sequence number %d I expected,status=%d", __FUNCTION__,
-                  buffer->int32Data(), mNextExpectedSeqNo, assemble_status);
-            return assemble_status;
-            // return WRONG_SEQUENCE_NUMBER;
-        } else {
-            ALOGE("receive data not rece-time!!");
+            return SKIP_MISS_PACKET;
         }
+
+        AssemblyStatus assemble_status = getAssembleStatus(queue, mNextExpectedSeqNo);
+        ALOGV("%s,%d is not the sequence number %d I expected,status=%d", __FUNCTION__,
+              buffer->int32Data(), mNextExpectedSeqNo, assemble_status);
+        return assemble_status;
+        // return WRONG_SEQUENCE_NUMBER;
     }
 
     // record last vaild receive time
-    int64_t recv_time = 0;
-
-    if (buffer->meta()->findInt64("recv-time", &recv_time)) {
-        mLastPacketReceiveTime = recv_time;
-    } else {
-        mLastPacketReceiveTime = 0;
-        ALOGE("record last vaild time fail");
-    }
+    mLastPacketReceiveTime = info.mRecvTimeUs;
 
     // ATRACE_INT64("RTR:AVCAsmb:deqSqN",(int64_t)(uint32_t)(buffer->int32Data()));
 
-    sp<AMessage> buffer_meta = buffer->meta();
     // use seqNum before extending
-    int32_t seqNum = 0;
-    buffer_meta->findInt32("token", &seqNum);
+    int32_t seqNum = info.mToken;
     ATRACE_ASYNC_END("RTR-MAR:SeqN", seqNum);
 
     const uint8_t* data = buffer->data();
@@ -189,7 +176,7 @@ RTPAssembler::AssemblyStatus AVCAssembler::addNALUnit(const sp<RTPSource>& sourc
         // Corrupt.
 
         ALOGW("Ignoring corrupt buffer.");
-        queue->erase(queue->begin());
+        queue->pop_front();
 
         ++mNextExpectedSeqNo;
         return MALFORMED_PACKET;
@@ -215,12 +202,15 @@ RTPAssembler::AssemblyStatus AVCAssembler::addNALUnit(const sp<RTPSource>& sourc
         }
 
         ATRACE_ASYNC_BEGIN("RTR-MAR", mAccuCount);
+        CopyMetas(buffer, info);
+
+        sp<AMessage> buffer_meta = buffer->meta();
         buffer_meta->setInt32("EarliestPacket_token", seqNum);
         buffer_meta->setInt32("FirstPacket_token", seqNum);
         buffer_meta->setInt32("latestPacekt_token", seqNum);
 
         addSingleNALUnit(buffer);
-        queue->erase(queue->begin());
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return OK;
     } else if (nalType == 28) {
@@ -245,20 +235,20 @@ RTPAssembler::AssemblyStatus AVCAssembler::addNALUnit(const sp<RTPSource>& sourc
             mpNALFragmentInfo = NULL;
         }
 
-        bool success = addSingleTimeAggregationPacket(buffer);
-        queue->erase(queue->begin());
+        bool success = addSingleTimeAggregationPacket(buffer, info);
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return success ? OK : MALFORMED_PACKET;
     } else if (nalType == 0) {
         ALOGW("%s,Ignoring undefined nal type.", __FUNCTION__);
 
-        queue->erase(queue->begin());
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return OK;
     } else {
         ALOGW("%s,Ignoring unsupported buffer (nalType=%d)", __FUNCTION__, nalType);
 
-        queue->erase(queue->begin());
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return MALFORMED_PACKET;
     }
@@ -266,11 +256,13 @@ RTPAssembler::AssemblyStatus AVCAssembler::addNALUnit(const sp<RTPSource>& sourc
 
 void AVCAssembler::addSingleNALUnit(const sp<ABuffer>& buffer) {
     // ALOGD("addSingleNALUnit of size %zu", buffer->size());
+    // the RTP header in front of the payload is the start code headroom
     submitAccessUnit(buffer);
     return;
 }
 
-bool AVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer) {
+bool AVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer,
+                                                  const RTPPacketInfo& info) {
     const uint8_t* data = buffer->data();
     size_t size = buffer->size();
     // ALOGD("%s,buffer size(%d)",__FUNCTION__,size);
@@ -280,9 +272,7 @@ bool AVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer) {
         return false;
     }
 
-    sp<AMessage> meta = buffer->meta();
-    int32_t token = 0;
-    meta->findInt32("token", &token);
+    int32_t token = info.mToken;
 
     ++data;
     --size;
@@ -297,10 +287,12 @@ bool AVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer) {
 
         ATRACE_ASYNC_BEGIN("RTR-MAR", mAccuCount);
 
-        sp<ABuffer> unit = new ABuffer(nalSize);
+        sp<ABuffer> unit = acquireNALBuffer(nalSize);
         memcpy(unit->data(), &data[2], nalSize);
+        unit->setRange(unit->offset(), nalSize);
 
-        CopyMetas(unit, buffer);
+        CopyMetas(unit, info);
+        unit->setInt32Data(buffer->int32Data());
 
         data += 2 + nalSize;
         size -= 2 + nalSize;
@@ -326,11 +318,11 @@ bool AVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer) {
     return true;
 }
 
-RTPAssembler::AssemblyStatus AVCAssembler::addFragmentedNALUnit(List<sp<ABuffer> >* queue) {
+RTPAssembler::AssemblyStatus AVCAssembler::addFragmentedNALUnit(RTPReorderQueue* queue) {
     ATRACE_CALL();
     CHECK(!queue->empty());
 
-    sp<ABuffer> buffer = *queue->begin();
+    sp<ABuffer> buffer = queue->front();
     const uint8_t* data = buffer->data();
     size_t size = buffer->size();
     ALOGV("%s,buffer size(%zu)", __FUNCTION__, size);
@@ -343,7 +335,7 @@ RTPAssembler::AssemblyStatus AVCAssembler::addFragmentedNALUnit(List<sp<ABuffer>
     if (size < 2) {
         ALOGW("Ignoring malformed FU buffer (size = %zu)", size);
 
-        queue->erase(queue->begin());
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return MALFORMED_PACKET;
     }
@@ -355,7 +347,7 @@ RTPAssembler::AssemblyStatus AVCAssembler::addFragmentedNALUnit(List<sp<ABuffer>
         if (!(data[1] & 0x80)) {
             // ALOGW("Start bit not set on first buffer");
 
-            queue->erase(queue->begin());
+            queue->pop_front();
             ++mNextExpectedSeqNo;
             return MALFORMED_PACKET;
         } else {
@@ -393,7 +385,7 @@ RTPAssembler::AssemblyStatus AVCAssembler::addFragmentedNALUnit(List<sp<ABuffer>
             if (nalType != mpNALFragmentInfo->mNALType) {
                 ALOGE("Ignoring malformed FU buffer(fragment nal_type(%d) != %d)", nalType,
                       mpNALFragmentInfo->mNALType);
-                queue->erase(queue->begin());
+                queue->pop_front();
                 ++mNextExpectedSeqNo;
                 return MALFORMED_PACKET;
             }
@@ -407,9 +399,7 @@ RTPAssembler::AssemblyStatus AVCAssembler::addFragmentedNALUnit(List<sp<ABuffer>
         // mpNALFragmentInfo->mNRI = nri;
     }
 
-    mpNALFragmentInfo->mNALFragments.push_back(buffer);
-    mpNALFragmentInfo->mNALSize += size - 2;
-    mpNALFragmentInfo->mTotalCount++;
+    appendFragment(buffer, queue->frontInfo());
     ALOGV("%s,Nal-FU-A(count:%d,total_size(%d))", __FUNCTION__, mpNALFragmentInfo->mTotalCount,
           mpNALFragmentInfo->mNALSize);
 
@@ -432,78 +422,83 @@ RTPAssembler::AssemblyStatus AVCAssembler::addFragmentedNALUnit(List<sp<ABuffer>
         mpNALFragmentInfo = NULL;
     }
 
-    queue->erase(queue->begin());
+    queue->pop_front();
     ++mNextExpectedSeqNo;
     // ALOGD("%s,mNextExpectedSeqNo(%d)",__FUNCTION__,mNextExpectedSeqNo);
 
     return OK;
 }
-sp<ABuffer> AVCAssembler::assembleToNAL(sp<NALFragMentsInfo> nalFragmentInfo) {
-    uint32_t nal_size = nalFragmentInfo->mNALSize + 1;  // for 1 byte NAL header
+void AVCAssembler::appendFragment(const sp<ABuffer>& buffer, const RTPPacketInfo& packetInfo) {
+    sp<NALFragMentsInfo> info = mpNALFragmentInfo;
+    const uint8_t* data = buffer->data();
+    size_t payloadSize = buffer->size() - 2;
 
-    List<sp<ABuffer> >* queue =
-            &(nalFragmentInfo->mNALFragments);  // ToDo: can we assigne list this way
-    // ALOGI("%s,nal fragments in list(num = %d,
-    // total_size=%d)",__FUNCTION__,queue->size(),nal_size);
+    int32_t token = packetInfo.mToken;
+    int64_t recvTimeUs = packetInfo.mRecvTimeUs;
 
-    ATRACE_ASYNC_BEGIN("RTR-MAR", mAccuCount);
+    if (info->mTotalCount == 0) {
+        size_t capacity = 1 + payloadSize;
 
-    sp<ABuffer> unit = new ABuffer(nal_size);
+        if (capacity < mNALSizeHint) {
+            capacity = mNALSizeHint;
+        }
 
-    if (nalFragmentInfo->mIsDamaged) {
-        unit->meta()->setInt32("damaged", true);
+        info->mNAL = acquireNALBuffer(capacity);
+        // NAL header from the FU indicator and the type of the FU header
+        info->mNRI = (data[0] >> 5) & 3;
+        info->mNAL->data()[0] = (info->mNRI << 5) | info->mNALType;
+        info->mNAL->setRange(info->mNAL->offset(), 1);
+
+        info->mFirstToken = token;
+        info->mEarliestToken = token;
+        info->mEarliestRecvTimeUs = recvTimeUs;
+    } else if (recvTimeUs <= info->mEarliestRecvTimeUs) {
+        info->mEarliestToken = token;
+        info->mEarliestRecvTimeUs = recvTimeUs;
     }
 
-    sp<ABuffer> beginFragment = *queue->begin();
-    sp<ABuffer> endFragment = *--queue->end();
-    uint8_t* data = beginFragment->data();
-
-    uint32_t nalType = data[1] & 0x1f;
-    uint32_t nri = (data[0] >> 5) & 3;
-    unit->meta()->setInt32("importance", nri);
-
-    CopyMetas(unit, endFragment);
-
-    unit->data()[0] = (nri << 5) | nalType;
-
-    size_t offset = 1;
-    List<sp<ABuffer> >::iterator it = queue->begin();
-    sp<AMessage> meta = (*it)->meta();
-    int64_t earliest_recv_time = 0;
-    meta->findInt64("recv-time", &earliest_recv_time);
-
-    int32_t tokenF = 0;
-    (*it)->meta()->findInt32("token", &tokenF);
-    unit->meta()->setInt32("FirstPacket_token", tokenF);
+    // the payload is copied once, straight to its place in the NAL
+    sp<ABuffer> nal = growNALBuffer(info->mNAL, info->mNAL->size() + payloadSize);
+    memcpy(nal->data() + nal->size(), data + 2, payloadSize);
+    nal->setRange(nal->offset(), nal->size() + payloadSize);
+
+    info->mNAL = nal;
+    info->mStopSeqNum = (uint32_t)buffer->int32Data();
+    info->mLastPacketInfo = packetInfo;
+    info->mLatestToken = token;
+    info->mNALSize += payloadSize;
+    info->mTotalCount++;
+}
 
-    while (it != queue->end()) {
-        const sp<ABuffer>& buffer = *it;
+sp<ABuffer> AVCAssembler::assembleToNAL(sp<NALFragMentsInfo> nalFragmentInfo) {
+    ALOGV("%s,nal fragments(num = %d, total_size=%d)", __FUNCTION__,
+          nalFragmentInfo->mTotalCount, nalFragmentInfo->mNALSize + 1);
 
-        sp<AMessage> meta = buffer->meta();
-        int64_t recv_time = 0;
-        meta->findInt64("recv-time", &recv_time);
+    ATRACE_ASYNC_BEGIN("RTR-MAR", mAccuCount);
 
-        int32_t token = 0;
-        meta->findInt32("token", &token);
+    sp<ABuffer> unit = nalFragmentInfo->mNAL;
 
-        if (recv_time <= earliest_recv_time) {
-            unit->meta()->setInt32("EarliestPacket_token", token);
-            earliest_recv_time = recv_time;
-        }
+    if (nalFragmentInfo->mIsDamaged) {
+        unit->meta()->setInt32("damaged", true);
+    }
 
-        memcpy(unit->data() + offset, buffer->data() + 2, buffer->size() - 2);
-        offset += buffer->size() - 2;
+    unit->meta()->setInt32("importance", nalFragmentInfo->mNRI);
+    CopyMetas(unit, nalFragmentInfo->mLastPacketInfo);
+    unit->setInt32Data(nalFragmentInfo->mStopSeqNum);
 
-        it = queue->erase(it);
+    unit->meta()->setInt32("FirstPacket_token", nalFragmentInfo->mFirstToken);
+    unit->meta()->setInt32("EarliestPacket_token", nalFragmentInfo->mEarliestToken);
+    unit->meta()->setInt32("latestPacekt_token", nalFragmentInfo->mLatestToken);
+    ALOGV("F=%d L=%d", nalFragmentInfo->mFirstToken, nalFragmentInfo->mLatestToken);
 
-        if (it == queue->end()) {
-            unit->meta()->setInt32("latestPacekt_token", token);
-            ALOGV("F=%d L=%d", tokenF, token);
-        }
+    // follow the NAL size down slowly, the next I frame should not have to grow its buffer
+    if (unit->size() > mNALSizeHint) {
+        mNALSizeHint = unit->size();
+    } else {
+        mNALSizeHint -= (mNALSizeHint - unit->size()) / 8;
     }
 
-    unit->setRange(0, nal_size);  // ToDo: assign uint32_t to size_t,ok?
-    // ALOGD("successfully assembled a NAL unit(size:%d) from fragments.",nal_size);
+    nalFragmentInfo->mNAL = NULL;
     return unit;
 }
 void AVCAssembler::submitAccessUnit(const sp<ABuffer>& accessUnit) {
@@ -625,10 +620,7 @@ void AVCAssembler::packetLostRegister() {
 void AVCAssembler::flushQueue() {
     // because RTPSource will lock the operation with packetReceive
     // so Assembler need not lock
-    if (mpNALFragmentInfo.get()) {
-        mpNALFragmentInfo->mNALFragments.clear();
-        mpNALFragmentInfo = NULL;
-    }
+    mpNALFragmentInfo = NULL;
 }
 void AVCAssembler::reset() {
     // flushQueue();
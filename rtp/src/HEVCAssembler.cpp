@@ -50,6 +50,7 @@ HEVCAssembler::HEVCAssembler(const sp<AMessage> notify)
 
     mAccuCount = 0;
     mpNALFragmentInfo = NULL;
+    mNALSizeHint = 0;
 
     mLastLost = -1;
 
@@ -94,7 +95,7 @@ HEVCAssembler::~HEVCAssembler() {
 RTPAssembler::AssemblyStatus HEVCAssembler::addNALUnit(const sp<RTPSource>& source) {
     ATRACE_CALL();
     ALOGV("%s", __FUNCTION__);
-    List<sp<ABuffer> >* queue = source->queue();
+    RTPReorderQueue* queue = source->queue();
 
     if (queue->empty()) {
         ALOGW("%s,source queue is empty", __FUNCTION__);
@@ -102,16 +103,15 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addNALUnit(const sp<RTPSource>& sour
     }
 
     if (mNextExpectedSeqNoValid) {
-        List<sp<ABuffer> >::iterator it = queue->begin();
-
-        while (it != queue->end()) {
-            if ((uint32_t)(*it)->int32Data() >= mNextExpectedSeqNo) {
+        while (!queue->empty()) {
+            if ((uint32_t)queue->front()->int32Data() >= mNextExpectedSeqNo) {
                 break;
             }
 
             ALOGD("%s,drop unexpected SeqNo(%d) of source queue, mNextExpectedSeqNo(%d)",
-                  __FUNCTION__, (uint32_t)(*it)->int32Data(), mNextExpectedSeqNo);
-            it = queue->erase(it);
+                  __FUNCTION__, (uint32_t)queue->front()->int32Data(), mNextExpectedSeqNo);
+            queue->pop_front();
+            source->onLatePacket();
         }
 
         if (queue->empty()) {
@@ -119,7 +119,8 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addNALUnit(const sp<RTPSource>& sour
         }
     }
 
-    sp<ABuffer> buffer = *queue->begin();
+    sp<ABuffer> buffer = queue->front();
+    const RTPPacketInfo& info = queue->frontInfo();
 
     if (!mNextExpectedSeqNoValid) {
         mNextExpectedSeqNoValid = true;
@@ -135,10 +136,8 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addNALUnit(const sp<RTPSource>& sour
 
     // ATRACE_INT64("RTR:AVCAsmb:deqSqN",(int64_t)(uint32_t)(buffer->int32Data()));
 
-    sp<AMessage> buffer_meta = buffer->meta();
     // use seqNum before extending
-    int32_t seqNum = 0;
-    buffer_meta->findInt32("token", &seqNum);
+    int32_t seqNum = info.mToken;
     ATRACE_ASYNC_END("RTR-MAR:SeqN", seqNum);
 
     const uint8_t* data = buffer->data();
@@ -148,7 +147,7 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addNALUnit(const sp<RTPSource>& sour
         // Corrupt.
 
         ALOGW("Ignoring corrupt buffer.");
-        queue->erase(queue->begin());
+        queue->pop_front();
 
         ++mNextExpectedSeqNo;
         return MALFORMED_PACKET;
@@ -176,12 +175,15 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addNALUnit(const sp<RTPSource>& sour
         }
 
         ATRACE_ASYNC_BEGIN("RTR-MAR", mAccuCount);
+        CopyMetas(buffer, info);
+
+        sp<AMessage> buffer_meta = buffer->meta();
         buffer_meta->setInt32("EarliestPacket_token", seqNum);
         buffer_meta->setInt32("FirstPacket_token", seqNum);
         buffer_meta->setInt32("latestPacekt_token", seqNum);
 
         addSingleNALUnit(buffer);
-        queue->erase(queue->begin());
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return OK;
     } else if (nalType == 49) {
@@ -207,20 +209,20 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addNALUnit(const sp<RTPSource>& sour
             mpNALFragmentInfo = NULL;
         }
 
-        bool success = addSingleTimeAggregationPacket(buffer);
-        queue->erase(queue->begin());
+        bool success = addSingleTimeAggregationPacket(buffer, info);
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return success ? OK : MALFORMED_PACKET;
     } else if (nalType == 50) {
         ALOGE("%s,not support PACI nal type.", __FUNCTION__);
 
-        queue->erase(queue->begin());
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return MALFORMED_PACKET;
     } else {
         ALOGW("%s,Ignoring unsupported buffer (nalType=%d)", __FUNCTION__, nalType);
 
-        queue->erase(queue->begin());
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return MALFORMED_PACKET;
     }
@@ -228,11 +230,13 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addNALUnit(const sp<RTPSource>& sour
 
 void HEVCAssembler::addSingleNALUnit(const sp<ABuffer>& buffer) {
     // ALOGD("addSingleNALUnit of size %zu", buffer->size());
+    // the RTP header in front of the payload is the start code headroom
     submitAccessUnit(buffer);
     return;
 }
 
-bool HEVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer) {
+bool HEVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer,
+                                                   const RTPPacketInfo& info) {
     const uint8_t* data = buffer->data();
     size_t size = buffer->size();
     // ALOGD("%s,buffer size(%d)",__FUNCTION__,size);
@@ -242,9 +246,7 @@ bool HEVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer) {
         return false;
     }
 
-    sp<AMessage> meta = buffer->meta();
-    int32_t token = 0;
-    meta->findInt32("token", &token);
+    int32_t token = info.mToken;
 
     data += 2;
     size -= 2;
@@ -261,10 +263,12 @@ bool HEVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer) {
 
         ALOGV("%s type=%d nalSize=%zu", __FUNCTION__, (data[3] & 0x7E) >> 1, nalSize);
 
-        sp<ABuffer> unit = new ABuffer(nalSize);
+        sp<ABuffer> unit = acquireNALBuffer(nalSize);
         memcpy(unit->data(), &data[2], nalSize);
+        unit->setRange(unit->offset(), nalSize);
 
-        CopyMetas(unit, buffer);
+        CopyMetas(unit, info);
+        unit->setInt32Data(buffer->int32Data());
 
         data += 2 + nalSize;
         size -= 2 + nalSize;
@@ -290,11 +294,11 @@ bool HEVCAssembler::addSingleTimeAggregationPacket(const sp<ABuffer>& buffer) {
     return true;
 }
 
-RTPAssembler::AssemblyStatus HEVCAssembler::addFragmentedNALUnit(List<sp<ABuffer> >* queue) {
+RTPAssembler::AssemblyStatus HEVCAssembler::addFragmentedNALUnit(RTPReorderQueue* queue) {
     ATRACE_CALL();
     CHECK(!queue->empty());
 
-    sp<ABuffer> buffer = *queue->begin();
+    sp<ABuffer> buffer = queue->front();
     const uint8_t* data = buffer->data();
     size_t size = buffer->size();
     ALOGV("%s,buffer size(%zu)", __FUNCTION__, size);
@@ -306,7 +310,7 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addFragmentedNALUnit(List<sp<ABuffer
     if (size < 3) {
         ALOGW("Ignoring malformed FU buffer (size = %zu)", size);
 
-        queue->erase(queue->begin());
+        queue->pop_front();
         ++mNextExpectedSeqNo;
         return MALFORMED_PACKET;
     }
@@ -317,7 +321,7 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addFragmentedNALUnit(List<sp<ABuffer
         if (!(data[2] & 0x80)) {
             ALOGV("Start bit not set on first buffer");
 
-            queue->erase(queue->begin());
+            queue->pop_front();
             ++mNextExpectedSeqNo;
             return MALFORMED_PACKET;
         } else {
@@ -357,7 +361,7 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addFragmentedNALUnit(List<sp<ABuffer
             if (nalType != mpNALFragmentInfo->mNALType) {
                 ALOGE("Ignoring malformed FU buffer(fragment nal_type(%d) != %d)", nalType,
                       mpNALFragmentInfo->mNALType);
-                queue->erase(queue->begin());
+                queue->pop_front();
                 ++mNextExpectedSeqNo;
                 return MALFORMED_PACKET;
             }
@@ -370,9 +374,7 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addFragmentedNALUnit(List<sp<ABuffer
         mpNALFragmentInfo->mNALType = nalType;
     }
 
-    mpNALFragmentInfo->mNALFragments.push_back(buffer);
-    mpNALFragmentInfo->mNALSize += size - 3;
-    mpNALFragmentInfo->mTotalCount++;
+    appendFragment(buffer, queue->frontInfo());
     ALOGV("%s,Nal-FU-A(count:%d,total_size(%d))", __FUNCTION__, mpNALFragmentInfo->mTotalCount,
           mpNALFragmentInfo->mNALSize);
 
@@ -395,82 +397,82 @@ RTPAssembler::AssemblyStatus HEVCAssembler::addFragmentedNALUnit(List<sp<ABuffer
         mpNALFragmentInfo = NULL;
     }
 
-    queue->erase(queue->begin());
+    queue->pop_front();
     ++mNextExpectedSeqNo;
     ALOGV("%s,mNextExpectedSeqNo(%d)", __FUNCTION__, mNextExpectedSeqNo);
 
     return OK;
 }
-sp<ABuffer> HEVCAssembler::assembleToNAL(sp<NALFragMentsInfo> nalFragmentInfo) {
-    uint32_t nal_size = nalFragmentInfo->mNALSize + 2;  // for 1 byte NAL header
+void HEVCAssembler::appendFragment(const sp<ABuffer>& buffer, const RTPPacketInfo& packetInfo) {
+    sp<NALFragMentsInfo> info = mpNALFragmentInfo;
+    const uint8_t* data = buffer->data();
+    size_t payloadSize = buffer->size() - 3;
 
-    List<sp<ABuffer> >* queue =
-            &(nalFragmentInfo->mNALFragments);  // ToDo: can we assigne list this way
-    ALOGI("%s,nal fragments in list(num = %zu, total_size=%d)", __FUNCTION__, queue->size(),
-          nal_size);
+    int32_t token = packetInfo.mToken;
+    int64_t recvTimeUs = packetInfo.mRecvTimeUs;
 
-    ATRACE_ASYNC_BEGIN("RTR-MAR", mAccuCount);
+    if (info->mTotalCount == 0) {
+        size_t capacity = 2 + payloadSize;
 
-    sp<ABuffer> unit = new ABuffer(nal_size);
+        if (capacity < mNALSizeHint) {
+            capacity = mNALSizeHint;
+        }
 
-    if (nalFragmentInfo->mIsDamaged) {
-        unit->meta()->setInt32("damaged", true);
+        info->mNAL = acquireNALBuffer(capacity);
+        // NAL header from the payload header with the type of the FU header
+        info->mNAL->data()[0] = (data[0] & 0x81) | ((data[2] & 0x1f) << 1);
+        info->mNAL->data()[1] = data[1];
+        info->mNAL->setRange(info->mNAL->offset(), 2);
+
+        info->mFirstToken = token;
+        info->mEarliestToken = token;
+        info->mEarliestRecvTimeUs = recvTimeUs;
+    } else if (recvTimeUs <= info->mEarliestRecvTimeUs) {
+        info->mEarliestToken = token;
+        info->mEarliestRecvTimeUs = recvTimeUs;
     }
 
-    sp<ABuffer> beginFragment = *queue->begin();
-    sp<ABuffer> endFragment = *--queue->end();
-    uint8_t* data = beginFragment->data();
-
-    uint32_t nalType = data[2] & 0x1f;
-
-    CopyMetas(unit, endFragment);
-
-    unit->data()[0] = data[0];
-    unit->data()[0] &= 0x81;
-    unit->data()[0] |= (nalType << 1);
-    unit->data()[1] = data[1];
-
-    ALOGV("%s,nal fragments nalType=%d, header1=0x%x header2=0x%x", __FUNCTION__, nalType,
-          unit->data()[0], unit->data()[1]);
-
-    size_t offset = 2;
-    List<sp<ABuffer> >::iterator it = queue->begin();
-    sp<AMessage> meta = (*it)->meta();
-    int64_t earliest_recv_time = 0;
-    meta->findInt64("recv-time", &earliest_recv_time);
-
-    int32_t tokenF = 0;
-    (*it)->meta()->findInt32("token", &tokenF);
-    unit->meta()->setInt32("FirstPacket_token", tokenF);
+    // the payload is copied once, straight to its place in the NAL
+    sp<ABuffer> nal = growNALBuffer(info->mNAL, info->mNAL->size() + payloadSize);
+    memcpy(nal->data() + nal->size(), data + 3, payloadSize);
+    nal->setRange(nal->offset(), nal->size() + payloadSize);
+
+    info->mNAL = nal;
+    info->mStopSeqNum = (uint32_t)buffer->int32Data();
+    info->mLastPacketInfo = packetInfo;
+    info->mLatestToken = token;
+    info->mNALSize += payloadSize;
+    info->mTotalCount++;
+}
 
-    while (it != queue->end()) {
-        const sp<ABuffer>& buffer = *it;
+sp<ABuffer> HEVCAssembler::assembleToNAL(sp<NALFragMentsInfo> nalFragmentInfo) {
+    ALOGI("%s,nal fragments(num = %d, total_size=%d)", __FUNCTION__,
+          nalFragmentInfo->mTotalCount, nalFragmentInfo->mNALSize + 2);
 
-        sp<AMessage> meta = buffer->meta();
-        int64_t recv_time = 0;
-        meta->findInt64("recv-time", &recv_time);
+    ATRACE_ASYNC_BEGIN("RTR-MAR", mAccuCount);
 
-        int32_t token = 0;
-        meta->findInt32("token", &token);
+    sp<ABuffer> unit = nalFragmentInfo->mNAL;
 
-        if (recv_time <= earliest_recv_time) {
-            unit->meta()->setInt32("EarliestPacket_token", token);
-            earliest_recv_time = recv_time;
-        }
+    if (nalFragmentInfo->mIsDamaged) {
+        unit->meta()->setInt32("damaged", true);
+    }
 
-        memcpy(unit->data() + offset, buffer->data() + 3, buffer->size() - 3);
-        offset += buffer->size() - 3;
+    CopyMetas(unit, nalFragmentInfo->mLastPacketInfo);
+    unit->setInt32Data(nalFragmentInfo->mStopSeqNum);
 
-        it = queue->erase(it);
+    unit->meta()->setInt32("FirstPacket_token", nalFragmentInfo->mFirstToken);
+    unit->meta()->setInt32("EarliestPacket_token", nalFragmentInfo->mEarliestToken);
+    unit->meta()->setInt32("latestPacekt_token", nalFragmentInfo->mLatestToken);
+    ALOGV("F=%d L=%d", nalFragmentInfo->mFirstToken, nalFragmentInfo->mLatestToken);
 
-        if (it == queue->end()) {
-            unit->meta()->setInt32("latestPacekt_token", token);
-            ALOGV("F=%d L=%d", tokenF, token);
-        }
+    // follow the NAL size down slowly, the next I frame should not have to grow its buffer
+    if (unit->size() > mNALSizeHint) {
+        mNALSizeHint = unit->size();
+    } else {
+        mNALSizeHint -= (mNALSizeHint - unit->size()) / 8;
     }
 
-    unit->setRange(0, nal_size);  // ToDo: assign uint32_t to size_t,ok?
-    // ALOGD("successfully assembled a NAL unit(size:%d) from fragments.",nal_size);
+    nalFragmentInfo->mNAL = NULL;
     return unit;
 }
 void HEVCAssembler::submitAccessUnit(const sp<ABuffer>& accessUnit) {
@@ -594,10 +596,7 @@ void HEVCAssembler::packetLostRegister() {
 void HEVCAssembler::flushQueue() {
     // because RTPSource will lock the operation with packetReceive
     // so Assembler need not lock
-    if (mpNALFragmentInfo.get()) {
-        mpNALFragmentInfo->mNALFragments.clear();
-        mpNALFragmentInfo = NULL;
-    }
+    mpNALFragmentInfo = NULL;
 }
 void HEVCAssembler::reset() {
     // flushQueue();
@@ -111,6 +111,15 @@ status_t IRTPController::getCapability(rtp_rtcp_capability_t** pRTPCapArray, uin
             memcpy(rtp_cap[0].rtp_ext_map[0].extension_uri, extension_uri,
                    26);  // sizeof(extension_uri));
 
+            // a=extmap:5 transport wide seq for per packet arrival feedback
+            rtp_cap[0].rtp_header_extension_num = 2;
+            rtp_cap[0].rtp_ext_map[1].extension_id = 5;
+            rtp_cap[0].rtp_ext_map[1].direction = ViLTE_RTP_DIRECTION_SENDRECV;
+            memset(rtp_cap[0].rtp_ext_map[1].extension_uri, 0,
+                   sizeof(rtp_cap[0].rtp_ext_map[1].extension_uri));
+            strncpy(rtp_cap[0].rtp_ext_map[1].extension_uri, RTPTransportFeedback::kExtensionURI,
+                    sizeof(rtp_cap[0].rtp_ext_map[1].extension_uri) - 1);
+
             // rtp_cap[0].rtcp_sender_bandwidth = 25.6*1024; //b=RS in bps,1.25%*(b=AS)
             // rtp_cap[0].rtcp_receiver_bandwidth = 76.8 * 1024; //b=RR in bps, 3.75%*(b=AS)
             rtp_cap[0].rtcp_reduce_size = 0;
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPAdaptationLibController"
+#include <utils/Log.h>
+
+#include "RTPAdaptationLibController.h"
+
+namespace imsma {
+
+RTPAdaptationLibController::RTPAdaptationLibController(TxAdaptationInfo* adaInfo) {
+    mAdaInfo = adaInfo;
+}
+
+bool RTPAdaptationLibController::onReportBlock(uint8_t* data, int32_t containTMMBR,
+                                               int64_t rttUs, signalInfo sigInfo, int64_t nowUs,
+                                               uint32_t* target, bool* needForceI) {
+    *target = 0;
+    mAdaInfo->processReportBlock(data, containTMMBR, sigInfo, target, needForceI);
+
+    // report block only raises the bit rate on good signal
+    return *target != 0 && sigInfo.canExpand == true;
+}
+
+bool RTPAdaptationLibController::onTMMBR(uint8_t* fci, uint32_t queueDurationUs,
+                                         signalInfo sigInfo, int64_t nowUs, uint32_t* target) {
+    return mAdaInfo->processTMMBR(fci, target, queueDurationUs, sigInfo);
+}
+
+bool RTPAdaptationLibController::onQueueDelay(uint32_t queueDurationUs, int64_t nowUs,
+                                              uint32_t* target) {
+    return mAdaInfo->checkFallBack(target, queueDurationUs);
+}
+
+}  // namespace imsma
@@ -26,6 +26,7 @@
 #include <media/stagefright/foundation/AMessage.h>
 
 #include <stdint.h>
+#include <string.h>
 
 namespace imsma {
 
@@ -45,9 +46,19 @@ void RTPAssembler::onPacketReceived(const sp<RTPSource>& source) {
     for (;;) {
         status = assembleMore(source);
 
+        if ((status == WRONG_SEQUENCE_NUMBER || status == LARGE_SEQUENCE_GAP) &&
+            source->isRetransmissionPending()) {
+            // the missing packet has been NACKed, RTPSource tells when to give up
+            if (mFirstFailureTimeUs < 0) {
+                mFirstFailureTimeUs = ALooper::GetNowUs();
+            }
+
+            break;
+        }
+
         if (status == WRONG_SEQUENCE_NUMBER) {
             if (mFirstFailureTimeUs >= 0) {
-                if (ALooper::GetNowUs() - mFirstFailureTimeUs > 5000ll) {
+                if (ALooper::GetNowUs() - mFirstFailureTimeUs > source->getReorderWaitUs()) {
                     mFirstFailureTimeUs = -1;
 
                     // LOG(VERBOSE) << "waited too long for packet.";
@@ -78,39 +89,77 @@ void RTPAssembler::onPacketReceived(const sp<RTPSource>& source) {
 }
 
 // static
-void RTPAssembler::CopyMetas(const sp<ABuffer>& to, const sp<ABuffer>& from) {
+void RTPAssembler::CopyMetas(const sp<ABuffer>& to, const RTPPacketInfo& from) {
     sp<AMessage> to_meta = to->meta();
-    sp<AMessage> from_meta = from->meta();
 
     // copy rtp-time meta
-    uint32_t rtpTime;
-    CHECK(from_meta->findInt32("rtp-time", (int32_t*)&rtpTime));
-    to_meta->setInt32("rtp-time", rtpTime);
-
-    // Copy the seq number.
-    to->setInt32Data(from->int32Data());
+    to_meta->setInt32("rtp-time", from.mRtpTime);
 
     // copy the rotation,facing,flip info
-    int32_t ccw_rotation = 0;
-    int32_t camera_facing = IMSMA_CAMERA_FACING_UNKNOW;
-    int32_t flip = IMSMA_CAMERA_NO_FLIP;
+    to_meta->setInt32("ccw_rotation", from.mCCWRotation);
+    to_meta->setInt32("camera_facing", from.mCameraFacing);
+    to_meta->setInt32("flip", from.mFlip);
 
-    from_meta->findInt32("ccw_rotation", &ccw_rotation);
-    from_meta->findInt32("camera_facing", &camera_facing);
-    from_meta->findInt32("flip", &flip);
+    // copy maker info
+    if (from.mMarker > 0) {
+        ALOGV("%s,last accu of frame", __FUNCTION__);
+        to_meta->setInt32("M", from.mMarker);
+    }
+}
 
-    to_meta->setInt32("ccw_rotation", ccw_rotation);
-    to_meta->setInt32("camera_facing", camera_facing);
-    to_meta->setInt32("flip", flip);
+sp<ABuffer> RTPAssembler::acquireNALBuffer(size_t capacity) {
+    if (capacity < kMinNALCapacity) {
+        capacity = kMinNALCapacity;
+    }
 
-    // copy maker info
-    int32_t marker_bit = 0;
-    from_meta->findInt32("M", &marker_bit);
+    ssize_t freeIndex = -1;
 
-    if (marker_bit > 0) {
-        ALOGV("%s,last accu of frame", __FUNCTION__);
-        to_meta->setInt32("M", marker_bit);
+    for (size_t i = 0; i < mNALBufferPool.size(); i++) {
+        const sp<ABuffer>& buffer = mNALBufferPool.itemAt(i);
+
+        // only the pool holds it, nobody downstream can still see the data
+        if (buffer->getStrongCount() != 1) {
+            continue;
+        }
+
+        if (buffer->capacity() >= capacity + kStartCodeHeadroom) {
+            buffer->meta()->clear();
+            buffer->setInt32Data(0);
+            buffer->setRange(kStartCodeHeadroom, 0);
+            return buffer;
+        }
+
+        freeIndex = i;
+    }
+
+    sp<ABuffer> buffer = new ABuffer(capacity + kStartCodeHeadroom);
+    buffer->setRange(kStartCodeHeadroom, 0);
+
+    if (mNALBufferPool.size() < kNALBufferPoolSize) {
+        mNALBufferPool.push_back(buffer);
+    } else if (freeIndex >= 0) {
+        // the free one is too small for the NALs now received
+        mNALBufferPool.replaceAt(buffer, freeIndex);
     }
+
+    ALOGV("%s,new buffer of %zu bytes, pool size %zu", __FUNCTION__, buffer->capacity(),
+          mNALBufferPool.size());
+    return buffer;
+}
+
+sp<ABuffer> RTPAssembler::growNALBuffer(const sp<ABuffer>& buffer, size_t capacity) {
+    if (buffer->capacity() >= capacity + buffer->offset()) {
+        return buffer;
+    }
+
+    if (capacity < 2 * buffer->size()) {
+        capacity = 2 * buffer->size();
+    }
+
+    sp<ABuffer> grown = acquireNALBuffer(capacity);
+    memcpy(grown->data(), buffer->data(), buffer->size());
+    grown->setRange(grown->offset(), buffer->size());
+    return grown;
 }
 
 // static
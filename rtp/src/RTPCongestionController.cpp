@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPCongestionController"
+#include <utils/Log.h>
+
+#include "RTPCongestionController.h"
+#include "RTPAdaptationLibController.h"
+#include "RTPDelayGradientController.h"
+
+namespace imsma {
+
+// static
+RTPCongestionController* RTPCongestionController::create(int32_t type,
+                                                         TxAdaptationInfo* adaInfo) {
+    RTPCongestionController* controller = NULL;
+
+    switch (type) {
+        case kTypeDelayGradient:
+            controller = new RTPDelayGradientController();
+            break;
+        case kTypeAdaptationLib:
+            controller = new RTPAdaptationLibController(adaInfo);
+            break;
+        default:
+            ALOGW("%s,unknown type(%d), use adaptation lib", __FUNCTION__, type);
+            controller = new RTPAdaptationLibController(adaInfo);
+            break;
+    }
+
+    ALOGI("%s,congestion controller: %s", __FUNCTION__, controller->getName());
+    return controller;
+}
+
+}  // namespace imsma
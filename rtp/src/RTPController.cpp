@@ -38,6 +38,10 @@
 using namespace imsma;
 using android::status_t;
 
+// receive blocks of the socket wrappers hold a whole datagram of the link,
+// peers packetize to their own MTU, not to our mMTUSize
+static const uint32_t kRxDatagramSize = SOCKETWRAPPER_DEFAULT_MTU;
+
 namespace android {
 
 // Need Check: whether need to release the memory for mpVideoCapParams,mpAudioCapParams
@@ -926,6 +930,15 @@ void RTPController::onMessageReceived(const sp<AMessage>& msg) {
                 sp<ABuffer> nack_fci;
                 msg->findBuffer("nack_fci", &nack_fci);
                 onSendGenericNack(nack_fci);
+            } else if (what == RTPReceiver::kWhatTransportFeedback) {
+                if (mVideoConfigParam.rtp_profile == IMSMA_RTP_AVP) {
+                    ALOGW("kWhatReceiverNotify,AVP not support FBs");
+                    break;
+                }
+
+                sp<ABuffer> fci;
+                msg->findBuffer("fci", &fci);
+                onSendTransportFeedback(fci);
             } else if (what == RTPReceiver::kWhatTriggerPli) {
                 if (mVideoConfigParam.rtp_profile == IMSMA_RTP_AVP) {
                     ALOGW("kWhatReceiverNotify,AVP not support FBs");
@@ -1816,6 +1829,7 @@ status_t RTPController::onUpdateConfigParams(rtp_rtcp_config_t* pRTPNegotiatedPa
             param_rtcp.isBlock = false;
             param_rtcp.sendBufferSize = 512 * 1024;
             param_rtcp.receiveBufferSize = 512 * 1024;
+            param_rtcp.mtu = kRxDatagramSize;
             param_rtcp.dscp = mVideoConfigParam.network_info.dscp;
             param_rtcp.priority = mVideoConfigParam.network_info.soc_priority;
             param_rtcp.network_id = mVideoConfigParam.network_info.network_id;
@@ -1846,6 +1860,7 @@ status_t RTPController::onUpdateConfigParams(rtp_rtcp_config_t* pRTPNegotiatedPa
             param_rtp.isBlock = false;
             param_rtp.sendBufferSize = 2048 * 1024;
             param_rtp.receiveBufferSize = 2048 * 1024;
+            param_rtp.mtu = kRxDatagramSize;
             param_rtp.dscp = mVideoConfigParam.network_info.dscp;
             param_rtp.priority = mVideoConfigParam.network_info.soc_priority;
             param_rtp.network_id = mVideoConfigParam.network_info.network_id;
@@ -1974,6 +1989,7 @@ status_t RTPController::onAddStream(int32_t rtpPath, int32_t trackIndex) {
             param.isBlock = false;
             param.sendBufferSize = 512 * 1024;
             param.receiveBufferSize = 512 * 1024;
+            param.mtu = kRxDatagramSize;
 
             param.dscp = mVideoConfigParam.network_info.dscp;
             param.priority = mVideoConfigParam.network_info.soc_priority;
@@ -2018,6 +2034,7 @@ status_t RTPController::onAddStream(int32_t rtpPath, int32_t trackIndex) {
             param.isBlock = false;
             param.sendBufferSize = 2048 * 1024;
             param.receiveBufferSize = 2048 * 1024;
+            param.mtu = kRxDatagramSize;
             ALOGI("%s,isBlock=%d,sendBufferSize:%d,receiveBufferSize:%d", __FUNCTION__,
                   param.isBlock, param.sendBufferSize, param.receiveBufferSize);
             param.dscp = mVideoConfigParam.network_info.dscp;
@@ -2201,6 +2218,7 @@ status_t RTPController::onStart(int32_t rtpPath, int32_t trackIndex) {
             param.isBlock = false;
             param.sendBufferSize = 2048 * 1024;
             param.receiveBufferSize = 2048 * 1024;
+            param.mtu = kRxDatagramSize;
             ALOGI("%s,isBlock=%d,sendBufferSize:%d,receiveBufferSize:%d", __FUNCTION__,
                   param.isBlock, param.sendBufferSize, param.receiveBufferSize);
             param.dscp = mVideoConfigParam.network_info.dscp;
@@ -2305,6 +2323,7 @@ status_t RTPController::onStart(int32_t rtpPath, int32_t trackIndex) {
             param.isBlock = false;
             param.sendBufferSize = 512 * 1024;
             param.receiveBufferSize = 512 * 1024;
+            param.mtu = kRxDatagramSize;
 
             param.dscp = mVideoConfigParam.network_info.dscp;
             param.priority = mVideoConfigParam.network_info.soc_priority;
@@ -2582,7 +2601,12 @@ status_t RTPController::queueRTCPPacket(sp<ABuffer>& packet, uint8_t trackIndex)
                         if (mVideoRTPSender.get()) {
                             sp<AMessage> meta = reportBlockBuffer->meta();
                             meta->setInt32("contain_tmmbr", contain_TMMBR);
-                            mVideoRTPSender->processReportBlock(reportBlockBuffer);
+                            int64_t rttUs = -1;
+                            mVideoRTPSender->processReportBlock(reportBlockBuffer, &rttUs);
+
+                            if (rttUs >= 0 && mRTPReceiver.get()) {
+                                mRTPReceiver->updateRoundTripTime(rttUs, IMSMA_RTP_VIDEO);
+                            }
                         }
                     }
                 }
@@ -2630,7 +2654,12 @@ status_t RTPController::queueRTCPPacket(sp<ABuffer>& packet, uint8_t trackIndex)
                         if (mVideoRTPSender.get()) {
                             sp<AMessage> meta = reportBlockBuffer->meta();
                             meta->setInt32("contain_tmmbr", contain_TMMBR);
-                            mVideoRTPSender->processReportBlock(reportBlockBuffer);
+                            int64_t rttUs = -1;
+                            mVideoRTPSender->processReportBlock(reportBlockBuffer, &rttUs);
+
+                            if (rttUs >= 0 && mRTPReceiver.get()) {
+                                mRTPReceiver->updateRoundTripTime(rttUs, IMSMA_RTP_VIDEO);
+                            }
                         }
                     }
                 }
@@ -2674,6 +2703,9 @@ status_t RTPController::queueRTCPPacket(sp<ABuffer>& packet, uint8_t trackIndex)
                 case 4:  // TMMBN
                     onReceiveTMMBN(tsfb);
                     break;
+                case 15:  // transport wide congestion control feedback
+                    onReceiveTransportFeedback(tsfb);
+                    break;
                 default:
                     break;
             }
@@ -2782,6 +2814,7 @@ status_t RTPController::stopScheduleRTCP(uint8_t trackIndex) {
         // clear AVPF related buffer
         mSliBuffer = NULL;
         mGenericNACKBuffer = NULL;
+        mTransportFeedbackFCIs.clear();
     }
 
     return OK;
@@ -3151,6 +3184,10 @@ status_t RTPController::makeAndsendRTCP(uint8_t trackIndex) {
             if (uFeedBackFlag & kKeyTMMBR) {
                 addTMMBR(buffer);
             }
+
+            if (uFeedBackFlag & kKeyTWCC) {
+                addTransportFeedback(buffer);
+            }
         }
 
         if (uFeedBackFlag & kKeyTMMBN) {
@@ -3449,6 +3486,70 @@ void RTPController::addNACK(const sp<ABuffer>& buffer) {
     ALOGI("%s --,nack fci num(%d)", __FUNCTION__, nack_fci_num);
 }
 
+void RTPController::addTransportFeedback(const sp<ABuffer>& buffer) {
+    if ((!mRTPReceiver.get()) || !mVideoPeerSSRC_set) {
+        ALOGW("no packet received,ssrc hasn't set");
+        return;
+    }
+
+    size_t added = 0;
+
+    while (added < mTransportFeedbackFCIs.size()) {
+        sp<ABuffer> fci = mTransportFeedbackFCIs[added];
+        // pad FCI to 32-bit words, the last padding byte is the padding count
+        size_t padding = (4 - (fci->size() & 0x03)) & 0x03;
+
+        if ((buffer->size() + 12 + fci->size() + padding) > buffer->capacity()) {
+            // the rest goes with the next RTCP
+            ALOGW("RTCP buffer too small to accomodate transport feedback.");
+            break;
+        }
+
+        uint8_t* data = buffer->data() + buffer->size();
+        uint16_t length = (12 + fci->size() + padding) / 4 - 1;
+
+        data[0] = 0x80 | RTPTransportFeedback::kFMT;  // FMT=15
+
+        if (padding > 0) {
+            data[0] |= 0x20;  // P=1
+        }
+
+        data[1] = 205;  // RTPFB
+
+        data[2] = (length >> 8) & 0x00ff;
+        data[3] = length & 0x00ff;
+
+        data[4] = mSSRC >> 24;
+        data[5] = (mSSRC >> 16) & 0xff;
+        data[6] = (mSSRC >> 8) & 0xff;
+        data[7] = mSSRC & 0xff;
+
+        // SSRC of media source
+        data[8] = mVideoPeerSSRC >> 24;
+        data[9] = (mVideoPeerSSRC >> 16) & 0xff;
+        data[10] = (mVideoPeerSSRC >> 8) & 0xff;
+        data[11] = mVideoPeerSSRC & 0xff;
+
+        memcpy((void*)&data[12], (void*)fci->data(), fci->size());
+
+        if (padding > 0) {
+            memset(&data[12 + fci->size()], 0, padding);
+            data[12 + fci->size() + padding - 1] = padding;
+        }
+
+        buffer->setRange(buffer->offset(), buffer->size() + 12 + fci->size() + padding);
+        added++;
+    }
+
+    mTransportFeedbackFCIs.removeItemsAt(0, added);
+
+    if (mTransportFeedbackFCIs.isEmpty()) {
+        mNextScheduleRTCPinfo.mFeedBackFlag &= (~kKeyTWCC);
+    }
+
+    ALOGV("%s,add %zu fcis, %zu left", __FUNCTION__, added, mTransportFeedbackFCIs.size());
+}
+
 void RTPController::addTMMBR(const sp<ABuffer>& buffer) {
     ALOGI("%s ++", __FUNCTION__);
 
@@ -3781,6 +3882,47 @@ void RTPController::onReceiveTMMBN(const sp<ABuffer> buffer) {
     m_isWaitingTMMBN = false;
     ALOGI("%s --,feeback_flag = 0x%x", __FUNCTION__, mNextScheduleRTCPinfo.mFeedBackFlag);
 }
+void RTPController::onReceiveTransportFeedback(const sp<ABuffer> buffer) {
+    if (buffer->size() < 20) {
+        ALOGE("Invalid transport feedback buffer");
+        return;
+    }
+
+    uint8_t* data = buffer->data();
+    uint8_t FMT = data[0] & 0x1F;
+    uint8_t pt = data[1];
+
+    if ((FMT != RTPTransportFeedback::kFMT) || (pt != 205)) {
+        ALOGE("%s,not valid transport feedback(FMT:%d,pt:%d)", __FUNCTION__, FMT, pt);
+        return;
+    }
+
+    size_t size = buffer->size();
+
+    // padding count is in the last byte
+    if (data[0] & 0x20) {
+        uint8_t padding = data[size - 1];
+
+        if (padding == 0 || padding > size - 20) {
+            ALOGE("%s,invalid padding(%d)", __FUNCTION__, padding);
+            return;
+        }
+
+        size -= padding;
+    }
+
+    uint32_t ssrc = u32at(&data[8]);
+
+    if (ssrc == mSSRC) {
+        sp<ABuffer> fb_fci = new ABuffer(size - 12);
+        memcpy(fb_fci->data(), data + 12, size - 12);
+
+        if (mVideoRTPSender.get()) {
+            mVideoRTPSender->processTransportFeedback(fb_fci);
+        }
+    }
+}
+
 void RTPController::onReceiveTMMBR(const sp<ABuffer> buffer) {
     ALOGI("%s", __FUNCTION__);
 
@@ -4051,11 +4193,37 @@ void RTPController::onSendGenericNack(sp<ABuffer> buffer) {
         return;
     }
 
-    mGenericNACKBuffer = buffer;
+    // RTPReceiver may send NACKs faster than RTCP can go out, merge them into one
+    if (mGenericNACKBuffer.get() && (mNextScheduleRTCPinfo.mFeedBackFlag & kKeyGNACK) &&
+        mGenericNACKBuffer->size() + buffer->size() <= kMaxGenericNACKFCISize) {
+        sp<ABuffer> merged = new ABuffer(mGenericNACKBuffer->size() + buffer->size());
+        memcpy(merged->data(), mGenericNACKBuffer->data(), mGenericNACKBuffer->size());
+        memcpy(merged->data() + mGenericNACKBuffer->size(), buffer->data(), buffer->size());
+        mGenericNACKBuffer = merged;
+    } else {
+        mGenericNACKBuffer = buffer;
+    }
 
     checkAndAddFB(kKeyGNACK, 100000);
 }
 
+void RTPController::onSendTransportFeedback(sp<ABuffer> buffer) {
+    if (!buffer.get()) {
+        ALOGE("%s,transport feedback fci buffer is NULL", __FUNCTION__);
+        return;
+    }
+
+    if (mTransportFeedbackFCIs.size() >= kMaxTransportFeedbackFCIs) {
+        ALOGW("%s,too many pending transport feedbacks, drop the oldest", __FUNCTION__);
+        mTransportFeedbackFCIs.removeAt(0);
+    }
+
+    mTransportFeedbackFCIs.push(buffer);
+
+    // arrival times stay valid when late, never drop it for delay
+    checkAndAddFB(kKeyTWCC, -1);
+}
+
 void RTPController::onSendTMMBR(sp<ABuffer> buffer, bool isReduce) {
     ALOGI("%s ++: buffer(%p),isReduce=%d", __FUNCTION__, buffer.get(), isReduce);
 
@@ -0,0 +1,588 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPDelayGradientController"
+#include <utils/Log.h>
+
+#include "RTPDelayGradientController.h"
+
+#include <inttypes.h>
+#include <math.h>
+
+namespace imsma {
+
+// trendline filter and overuse detector parameters of the draft
+static const double kSmoothingCoef = 0.9;
+static const double kThresholdGain = 4.0;
+static const uint32_t kMaxNumDeltas = 60;
+static const double kInitialThresholdMs = 12.5;
+static const double kMinThresholdMs = 6.0;
+static const double kMaxThresholdMs = 600.0;
+static const double kThresholdUp = 0.0087;
+static const double kThresholdDown = 0.039;
+
+// AIMD rate control
+static const double kMultiplicativeIncrease = 1.08;  // per second
+static const double kDecreaseFactor = 0.85;
+static const uint32_t kPacketSizeBits = 1200 * 8;
+
+// loss based control, in 1/1000
+static const uint32_t kLossHighPermille = 100;
+static const uint32_t kLossLowPermille = 20;
+static const uint32_t kMinFeedbackPacketsForLoss = 20;
+
+// encoder change thresholds, same as the adaptation lib
+static const uint32_t kMinIncreaseStep = 10000;
+static const uint32_t kMinDecreaseStep = 5000;
+static const int64_t kMinIncreaseIntervalUs = 1000000ll;
+
+static const int64_t kDefaultRTTUs = 100000ll;
+
+RTPDelayGradientController::RTPDelayGradientController() {
+    mSentPackets = new SentPacket[kSentHistorySize];
+    mMaxBitrate = 0;
+    reset();
+}
+
+RTPDelayGradientController::~RTPDelayGradientController() {
+    delete[] mSentPackets;
+}
+
+void RTPDelayGradientController::reset() {
+    for (uint32_t i = 0; i < kSentHistorySize; i++) {
+        mSentPackets[i].mValid = false;
+    }
+
+    mCurrentGroup.mValid = false;
+    mPrevGroup.mValid = false;
+
+    mFirstArrivalTimeUs = -1;
+    mAccumulatedDelayMs = 0;
+    mSmoothedDelayMs = 0;
+    mTrendCount = 0;
+    mTrendIndex = 0;
+    mNumDeltas = 0;
+    mPrevTrend = 0;
+
+    mThresholdMs = kInitialThresholdMs;
+    mLastThresholdUpdateUs = -1;
+    mTimeOverUsingMs = -1;
+    mOveruseCount = 0;
+    mUsage = kUsageNormal;
+
+    mAckedWindowStartUs = -1;
+    mAckedBytes = 0;
+    mAckedBitrate = 0;
+
+    mState = kStateHold;
+    mDelayBasedBitrate = mMaxBitrate;
+    mLastRateUpdateUs = -1;
+    mLastDecreaseUs = -1;
+    mLinkCapacity = 0;
+    mRTTUs = kDefaultRTTUs;
+    mHasFeedback = false;
+
+    mLossBasedBitrate = mMaxBitrate;
+    mLossReceived = 0;
+    mLossLost = 0;
+    mLastLossDecreaseUs = -1;
+    mLastLossIncreaseUs = -1;
+
+    mTMMBRBitrate = 0;
+
+    // the encoder starts from the max bit rate
+    mLastTarget = mMaxBitrate;
+    mLastTargetUs = -1;
+}
+
+void RTPDelayGradientController::setMaxBitrate(uint32_t maxBitrate) {
+    if (maxBitrate == 0 || maxBitrate == mMaxBitrate) {
+        return;
+    }
+
+    ALOGD("%s,max bit rate %u -> %u", __FUNCTION__, mMaxBitrate, maxBitrate);
+
+    if (mDelayBasedBitrate == 0 || mDelayBasedBitrate > maxBitrate) {
+        mDelayBasedBitrate = maxBitrate;
+    }
+
+    if (mLossBasedBitrate == 0 || mLossBasedBitrate > maxBitrate) {
+        mLossBasedBitrate = maxBitrate;
+    }
+
+    if (mLastTarget == 0) {
+        mLastTarget = maxBitrate;
+    }
+
+    mMaxBitrate = maxBitrate;
+}
+
+void RTPDelayGradientController::onPacketSent(uint16_t seqNum, uint32_t size,
+                                              int64_t sendTimeUs) {
+    SentPacket* packet = &mSentPackets[seqNum & (kSentHistorySize - 1)];
+
+    packet->mValid = true;
+    packet->mSeqNum = seqNum;
+    packet->mSize = size;
+    packet->mSendTimeUs = sendTimeUs;
+}
+
+bool RTPDelayGradientController::onPacketFeedback(const PacketFeedback* feedbacks, size_t count,
+                                                  int64_t nowUs, uint32_t* target) {
+    uint32_t received = 0;
+    uint32_t lost = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        SentPacket* packet = &mSentPackets[feedbacks[i].mSeqNum & (kSentHistorySize - 1)];
+
+        if (!packet->mValid || packet->mSeqNum != feedbacks[i].mSeqNum) {
+            continue;
+        }
+
+        if (feedbacks[i].mArrivalTimeUs < 0) {
+            lost++;
+            continue;
+        }
+
+        received++;
+        packet->mValid = false;
+
+        int64_t sendTimeUs = packet->mSendTimeUs;
+        int64_t arrivalTimeUs = feedbacks[i].mArrivalTimeUs;
+
+        updateAckedBitrate(packet->mSize, arrivalTimeUs);
+
+        if (!mCurrentGroup.mValid) {
+            mCurrentGroup.mValid = true;
+            mCurrentGroup.mFirstSendTimeUs = sendTimeUs;
+            mCurrentGroup.mSendTimeUs = sendTimeUs;
+            mCurrentGroup.mArrivalTimeUs = arrivalTimeUs;
+            continue;
+        }
+
+        // reordered from a group already done
+        if (sendTimeUs < mCurrentGroup.mFirstSendTimeUs) {
+            continue;
+        }
+
+        if (sendTimeUs - mCurrentGroup.mFirstSendTimeUs > kBurstIntervalUs) {
+            onGroupComplete(mCurrentGroup, nowUs);
+
+            mCurrentGroup.mFirstSendTimeUs = sendTimeUs;
+            mCurrentGroup.mSendTimeUs = sendTimeUs;
+            mCurrentGroup.mArrivalTimeUs = arrivalTimeUs;
+            continue;
+        }
+
+        if (sendTimeUs > mCurrentGroup.mSendTimeUs) {
+            mCurrentGroup.mSendTimeUs = sendTimeUs;
+        }
+
+        if (arrivalTimeUs > mCurrentGroup.mArrivalTimeUs) {
+            mCurrentGroup.mArrivalTimeUs = arrivalTimeUs;
+        }
+    }
+
+    // a low rate stream needs several feedbacks for a meaningful fraction lost
+    mLossReceived += received;
+    mLossLost += lost;
+
+    if (mLossReceived + mLossLost >= kMinFeedbackPacketsForLoss) {
+        updateLossBasedBitrate(mLossLost * 1000 / (mLossReceived + mLossLost), nowUs);
+        mLossReceived = 0;
+        mLossLost = 0;
+    }
+
+    if (received == 0) {
+        return updateTarget(nowUs, target);
+    }
+
+    mHasFeedback = true;
+    updateDelayBasedBitrate(nowUs);
+
+    return updateTarget(nowUs, target);
+}
+
+void RTPDelayGradientController::onGroupComplete(const PacketGroup& group, int64_t nowUs) {
+    if (mPrevGroup.mValid) {
+        int64_t sendDeltaUs = group.mSendTimeUs - mPrevGroup.mSendTimeUs;
+        int64_t recvDeltaUs = group.mArrivalTimeUs - mPrevGroup.mArrivalTimeUs;
+
+        if (sendDeltaUs > 0) {
+            updateTrendline(recvDeltaUs / 1000.0, sendDeltaUs / 1000.0, group.mArrivalTimeUs,
+                            nowUs);
+        }
+    }
+
+    mPrevGroup = group;
+}
+
+void RTPDelayGradientController::updateTrendline(double recvDeltaMs, double sendDeltaMs,
+                                                 int64_t arrivalTimeUs, int64_t nowUs) {
+    if (mFirstArrivalTimeUs < 0) {
+        mFirstArrivalTimeUs = arrivalTimeUs;
+    }
+
+    if (mNumDeltas < kMaxNumDeltas) {
+        mNumDeltas++;
+    }
+
+    mAccumulatedDelayMs += recvDeltaMs - sendDeltaMs;
+    mSmoothedDelayMs = kSmoothingCoef * mSmoothedDelayMs +
+                       (1 - kSmoothingCoef) * mAccumulatedDelayMs;
+
+    mTrendX[mTrendIndex] = (arrivalTimeUs - mFirstArrivalTimeUs) / 1000.0;
+    mTrendY[mTrendIndex] = mSmoothedDelayMs;
+    mTrendIndex = (mTrendIndex + 1) % kTrendlineWindowSize;
+
+    if (mTrendCount < kTrendlineWindowSize) {
+        mTrendCount++;
+    }
+
+    double trend = mPrevTrend;
+
+    // least squares slope of the smoothed delay over arrival time
+    if (mTrendCount == kTrendlineWindowSize) {
+        double avgX = 0;
+        double avgY = 0;
+
+        for (size_t i = 0; i < kTrendlineWindowSize; i++) {
+            avgX += mTrendX[i];
+            avgY += mTrendY[i];
+        }
+
+        avgX /= kTrendlineWindowSize;
+        avgY /= kTrendlineWindowSize;
+
+        double numerator = 0;
+        double denominator = 0;
+
+        for (size_t i = 0; i < kTrendlineWindowSize; i++) {
+            numerator += (mTrendX[i] - avgX) * (mTrendY[i] - avgY);
+            denominator += (mTrendX[i] - avgX) * (mTrendX[i] - avgX);
+        }
+
+        if (denominator != 0) {
+            trend = numerator / denominator;
+        }
+    }
+
+    detect(trend, sendDeltaMs, nowUs);
+}
+
+void RTPDelayGradientController::detect(double trend, double sendDeltaMs, int64_t nowUs) {
+    double modifiedTrend = mNumDeltas * trend * kThresholdGain;
+
+    if (modifiedTrend > mThresholdMs) {
+        if (mTimeOverUsingMs < 0) {
+            // the overuse started in the middle of the last interval
+            mTimeOverUsingMs = sendDeltaMs / 2;
+        } else {
+            mTimeOverUsingMs += sendDeltaMs;
+        }
+
+        mOveruseCount++;
+
+        if (mTimeOverUsingMs > kOveruseTimeThresholdUs / 1000.0 && mOveruseCount > 1 &&
+            trend >= mPrevTrend) {
+            mTimeOverUsingMs = 0;
+            mOveruseCount = 0;
+
+            if (mUsage != kUsageOverusing) {
+                ALOGD("%s,overusing, trend %.2f threshold %.2f ms", __FUNCTION__, modifiedTrend,
+                      mThresholdMs);
+            }
+
+            mUsage = kUsageOverusing;
+        }
+    } else if (modifiedTrend < -mThresholdMs) {
+        mTimeOverUsingMs = -1;
+        mOveruseCount = 0;
+        mUsage = kUsageUnderusing;
+    } else {
+        mTimeOverUsingMs = -1;
+        mOveruseCount = 0;
+        mUsage = kUsageNormal;
+    }
+
+    mPrevTrend = trend;
+    updateThreshold(modifiedTrend, nowUs);
+}
+
+// the threshold follows the trend slowly, so competing TCP flows do not starve us
+void RTPDelayGradientController::updateThreshold(double modifiedTrend, int64_t nowUs) {
+    if (mLastThresholdUpdateUs < 0) {
+        mLastThresholdUpdateUs = nowUs;
+    }
+
+    double absTrend = fabs(modifiedTrend);
+
+    // a spike like a route change should not move the threshold
+    if (absTrend > mThresholdMs + 15.0) {
+        mLastThresholdUpdateUs = nowUs;
+        return;
+    }
+
+    double k = absTrend < mThresholdMs ? kThresholdDown : kThresholdUp;
+    int64_t elapsedUs = nowUs - mLastThresholdUpdateUs;
+
+    if (elapsedUs > 100000ll) {
+        elapsedUs = 100000ll;
+    }
+
+    mThresholdMs += k * (absTrend - mThresholdMs) * (elapsedUs / 1000.0);
+
+    if (mThresholdMs < kMinThresholdMs) {
+        mThresholdMs = kMinThresholdMs;
+    } else if (mThresholdMs > kMaxThresholdMs) {
+        mThresholdMs = kMaxThresholdMs;
+    }
+
+    mLastThresholdUpdateUs = nowUs;
+}
+
+// measured in the receiver clock, the rate the bottleneck has delivered
+void RTPDelayGradientController::updateAckedBitrate(uint32_t size, int64_t arrivalTimeUs) {
+    if (mAckedWindowStartUs < 0 || arrivalTimeUs < mAckedWindowStartUs) {
+        mAckedWindowStartUs = arrivalTimeUs;
+        mAckedBytes = 0;
+    }
+
+    if (arrivalTimeUs - mAckedWindowStartUs >= kAckedBitrateWindowUs) {
+        mAckedBitrate = mAckedBytes * 8 * 1000000ll / (arrivalTimeUs - mAckedWindowStartUs);
+        mAckedWindowStartUs = arrivalTimeUs;
+        mAckedBytes = 0;
+    }
+
+    mAckedBytes += size;
+}
+
+void RTPDelayGradientController::updateDelayBasedBitrate(int64_t nowUs) {
+    switch (mUsage) {
+        case kUsageOverusing:
+            mState = kStateDecrease;
+            break;
+        case kUsageNormal:
+            if (mState == kStateHold) {
+                mState = kStateIncrease;
+            }
+            break;
+        case kUsageUnderusing:
+            // queues are draining, wait until they are empty
+            mState = kStateHold;
+            break;
+    }
+
+    int64_t elapsedUs = mLastRateUpdateUs < 0 ? 0 : nowUs - mLastRateUpdateUs;
+
+    if (elapsedUs > 1000000ll) {
+        elapsedUs = 1000000ll;
+    }
+
+    mLastRateUpdateUs = nowUs;
+
+    uint32_t bitrate = mDelayBasedBitrate;
+
+    if (mState == kStateIncrease) {
+        double increase = 0;
+
+        if (mLinkCapacity > 0 && bitrate > mLinkCapacity * 3 / 2) {
+            // far above the last congestion point, the link has changed
+            mLinkCapacity = 0;
+        }
+
+        if (mLinkCapacity > 0 && bitrate > mLinkCapacity * 9 / 10) {
+            // near the last congestion point, about one packet per response time
+            double responseTimeMs = mRTTUs / 1000.0 + 100.0;
+            increase = kPacketSizeBits * 1000.0 / responseTimeMs * elapsedUs / 1000000.0;
+        } else {
+            increase = bitrate * (pow(kMultiplicativeIncrease, elapsedUs / 1000000.0) - 1.0);
+        }
+
+        bitrate += (uint32_t)increase;
+
+        // do not run far ahead of what the network has delivered
+        if (mAckedBitrate > 0 && bitrate > mAckedBitrate * 3 / 2 + kMinIncreaseStep) {
+            bitrate = mAckedBitrate * 3 / 2 + kMinIncreaseStep;
+        }
+
+        if (bitrate < mDelayBasedBitrate) {
+            bitrate = mDelayBasedBitrate;
+        }
+    } else if (mState == kStateDecrease) {
+        // once per RTT, the queue needs that long to show the last decrease
+        if (mLastDecreaseUs < 0 || nowUs - mLastDecreaseUs >= mRTTUs) {
+            uint32_t base = mAckedBitrate > 0 ? mAckedBitrate : bitrate;
+            uint32_t decreased = base * kDecreaseFactor;
+
+            if (decreased < bitrate) {
+                bitrate = decreased;
+            }
+
+            mLinkCapacity = base;
+            mLastDecreaseUs = nowUs;
+
+            ALOGI("%s,overuse, %u -> %u bps, acked %u bps", __FUNCTION__, mDelayBasedBitrate,
+                  bitrate, mAckedBitrate);
+        }
+
+        mState = kStateHold;
+    }
+
+    if (bitrate < kMinBitrate) {
+        bitrate = kMinBitrate;
+    }
+
+    if (mMaxBitrate > 0 && bitrate > mMaxBitrate) {
+        bitrate = mMaxBitrate;
+    }
+
+    mDelayBasedBitrate = bitrate;
+}
+
+void RTPDelayGradientController::updateLossBasedBitrate(uint32_t lossPermille, int64_t nowUs) {
+    uint32_t bitrate = mLossBasedBitrate;
+
+    if (lossPermille > kLossHighPermille) {
+        if (mLastLossDecreaseUs < 0 || nowUs - mLastLossDecreaseUs >= 300000ll + mRTTUs) {
+            bitrate = (uint64_t)bitrate * (2000 - lossPermille) / 2000;
+            mLastLossDecreaseUs = nowUs;
+
+            ALOGI("%s,loss %u/1000, %u -> %u bps", __FUNCTION__, lossPermille, mLossBasedBitrate,
+                  bitrate);
+        }
+    } else if (lossPermille < kLossLowPermille) {
+        if (mLastLossIncreaseUs < 0 || nowUs - mLastLossIncreaseUs >= 1000000ll) {
+            bitrate = (uint64_t)bitrate * 105 / 100 + 1000;
+            mLastLossIncreaseUs = nowUs;
+        }
+    }
+
+    if (bitrate < kMinBitrate) {
+        bitrate = kMinBitrate;
+    }
+
+    if (mMaxBitrate > 0 && bitrate > mMaxBitrate) {
+        bitrate = mMaxBitrate;
+    }
+
+    mLossBasedBitrate = bitrate;
+}
+
+bool RTPDelayGradientController::onReportBlock(uint8_t* data, int32_t containTMMBR,
+                                               int64_t rttUs, signalInfo sigInfo, int64_t nowUs,
+                                               uint32_t* target, bool* needForceI) {
+    // lost packets are recovered by NACK and PLI, not by the bit rate
+    *needForceI = false;
+
+    setMaxBitrate(sigInfo.maxBitrate);
+
+    if (rttUs > 0) {
+        mRTTUs = rttUs;
+    }
+
+    uint8_t fractionLost = data[0];
+    updateLossBasedBitrate(fractionLost * 1000 / 256, nowUs);
+
+    return updateTarget(nowUs, target);
+}
+
+bool RTPDelayGradientController::onTMMBR(uint8_t* fci, uint32_t queueDurationUs,
+                                         signalInfo sigInfo, int64_t nowUs, uint32_t* target) {
+    if (sigInfo.needRecord != NULL) {
+        *sigInfo.needRecord = false;
+    }
+
+    if (sigInfo.active != NULL) {
+        *sigInfo.active = false;
+    }
+
+    setMaxBitrate(sigInfo.maxBitrate);
+
+    // RFC 5104 4.2.1.1: MxTBR Exp(6 bits), Mantissa(17 bits), Measured Overhead(9 bits)
+    uint32_t exp = fci[0] >> 2;
+    uint32_t mantissa = ((fci[0] & 0x03) << 15) | (fci[1] << 7) | (fci[2] >> 1);
+    uint64_t bitrate = (uint64_t)mantissa << exp;
+
+    mTMMBRBitrate = bitrate > 0xffffffff ? 0xffffffff : (uint32_t)bitrate;
+
+    ALOGI("%s,tmmbr %u bps, queue %u us", __FUNCTION__, mTMMBRBitrate, queueDurationUs);
+
+    return updateTarget(nowUs, target);
+}
+
+bool RTPDelayGradientController::onQueueDelay(uint32_t queueDurationUs, int64_t nowUs,
+                                              uint32_t* target) {
+    if (queueDurationUs > kQueueDelayHighWaterUs &&
+        (mLastDecreaseUs < 0 || nowUs - mLastDecreaseUs >= mRTTUs)) {
+        uint32_t bitrate = mLastTarget * kDecreaseFactor;
+
+        if (bitrate < mDelayBasedBitrate) {
+            ALOGI("%s,queue %u us, %u -> %u bps", __FUNCTION__, queueDurationUs,
+                  mDelayBasedBitrate, bitrate);
+            mDelayBasedBitrate = bitrate < kMinBitrate ? kMinBitrate : bitrate;
+            mLastDecreaseUs = nowUs;
+        }
+    }
+
+    return updateTarget(nowUs, target);
+}
+
+bool RTPDelayGradientController::updateTarget(int64_t nowUs, uint32_t* target) {
+    if (mMaxBitrate == 0) {
+        return false;
+    }
+
+    uint32_t bitrate = mMaxBitrate;
+
+    if (mDelayBasedBitrate < bitrate) {
+        bitrate = mDelayBasedBitrate;
+    }
+
+    if (mLossBasedBitrate < bitrate) {
+        bitrate = mLossBasedBitrate;
+    }
+
+    if (mTMMBRBitrate > 0 && mTMMBRBitrate < bitrate) {
+        bitrate = mTMMBRBitrate;
+    }
+
+    bool changed = false;
+
+    if (bitrate + kMinDecreaseStep <= mLastTarget) {
+        changed = true;
+    } else if (bitrate >= mLastTarget + kMinIncreaseStep &&
+               (mLastTargetUs < 0 || nowUs - mLastTargetUs >= kMinIncreaseIntervalUs)) {
+        changed = true;
+    }
+
+    if (!changed) {
+        return false;
+    }
+
+    ALOGD("%s,%u -> %u bps(delay %u, loss %u, tmmbr %u, acked %u, feedback %d)", __FUNCTION__,
+          mLastTarget, bitrate, mDelayBasedBitrate, mLossBasedBitrate, mTMMBRBitrate,
+          mAckedBitrate, mHasFeedback);
+
+    mLastTarget = bitrate;
+    mLastTargetUs = nowUs;
+    *target = bitrate;
+
+    return true;
+}
+
+}  // namespace imsma
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPJitterEstimator"
+#include <utils/Log.h>
+
+#include "RTPJitterEstimator.h"
+
+#include <inttypes.h>
+
+namespace imsma {
+
+RTPJitterEstimator::RTPJitterEstimator() {
+    mClockRate = 0;
+    mRetransmissionDelayUs = 0;
+    reset();
+}
+
+void RTPJitterEstimator::reset() {
+    mHasLastPacket = false;
+    mLastRtpTime = 0;
+    mLastRecvTimeUs = 0;
+    mPacketCount = 0;
+    mJitterUs = 0;
+
+    mWindowStartUs = -1;
+    mWindowReceived = 0;
+    mWindowLate = 0;
+    mLateLossPermille = 0;
+    mLateBoostUs = 0;
+
+    mTargetDelayUs = kInitialTargetUs;
+}
+
+void RTPJitterEstimator::onPacketArrived(uint32_t rtpTime, int64_t recvTimeUs) {
+    if (mClockRate == 0) {
+        return;
+    }
+
+    // RFC 3550 A.8, in us instead of timestamp unit
+    if (mHasLastPacket) {
+        int32_t rtpDiff = (int32_t)(rtpTime - mLastRtpTime);
+        int64_t d = (recvTimeUs - mLastRecvTimeUs) - (int64_t)rtpDiff * 1000000ll / mClockRate;
+
+        if (d < 0) {
+            d = -d;
+        }
+
+        // rtp time jumps after hold or ssrc change, not jitter
+        if (d < kMaxTransitDiffUs) {
+            mJitterUs += (d - mJitterUs) / 16;
+        }
+    }
+
+    mHasLastPacket = true;
+    mLastRtpTime = rtpTime;
+    mLastRecvTimeUs = recvTimeUs;
+    mPacketCount++;
+    mWindowReceived++;
+
+    updateLateLoss(recvTimeUs);
+    updateTarget();
+}
+
+void RTPJitterEstimator::setRetransmissionDelayUs(int64_t delayUs) {
+    if (delayUs == mRetransmissionDelayUs) {
+        return;
+    }
+
+    mRetransmissionDelayUs = delayUs;
+    updateTarget();
+}
+
+void RTPJitterEstimator::updateLateLoss(int64_t nowUs) {
+    if (mWindowStartUs < 0) {
+        mWindowStartUs = nowUs;
+        return;
+    }
+
+    if (nowUs - mWindowStartUs < kLateLossWindowUs) {
+        return;
+    }
+
+    mLateLossPermille = mWindowReceived > 0 ? mWindowLate * 1000 / mWindowReceived : 0;
+
+    if (mLateLossPermille > kLateLossHighPermille) {
+        if (mLateBoostUs < kMaxTargetUs) {
+            mLateBoostUs += kLateStepUs;
+        }
+    } else if (mWindowLate == 0) {
+        mLateBoostUs /= 2;
+    }
+
+    if (mLateLossPermille > 0) {
+        ALOGI("%s,late %u of %u packets, jitter %" PRId64 " us, late boost %" PRId64 " us",
+              __FUNCTION__, mWindowLate, mWindowReceived, mJitterUs, mLateBoostUs);
+    }
+
+    mWindowStartUs = nowUs;
+    mWindowReceived = 0;
+    mWindowLate = 0;
+}
+
+void RTPJitterEstimator::updateTarget() {
+    int64_t targetUs = kInitialTargetUs;
+
+    if (mPacketCount >= kMinPacketsForEstimate) {
+        targetUs = kJitterFactor * mJitterUs + mLateBoostUs;
+    }
+
+    if (targetUs < mRetransmissionDelayUs) {
+        targetUs = mRetransmissionDelayUs;
+    }
+
+    if (targetUs < kMinTargetUs) {
+        targetUs = kMinTargetUs;
+    } else if (targetUs > kMaxTargetUs) {
+        targetUs = kMaxTargetUs;
+    }
+
+    mTargetDelayUs = targetUs;
+}
+
+}  // namespace imsma
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPNackTracker"
+#include <utils/Log.h>
+
+#include "RTPNackTracker.h"
+
+#include <inttypes.h>
+
+namespace imsma {
+
+RTPNackTracker::RTPNackTracker() {
+    mDeadlineUs = 0;
+    mRTTUs = kDefaultRTTUs;
+    mRTTMeasured = false;
+    mRequestedCount = 0;
+    mRecoveredCount = 0;
+    mGivenUpCount = 0;
+}
+
+void RTPNackTracker::setRTTUs(int64_t rttUs) {
+    if (rttUs <= 0) {
+        return;
+    }
+
+    // smooth like the RFC 6298 SRTT, one report block should not move it too far
+    if (!mRTTMeasured) {
+        mRTTUs = rttUs;
+        mRTTMeasured = true;
+    } else {
+        mRTTUs = (7 * mRTTUs + rttUs) / 8;
+    }
+
+    ALOGV("%s,rtt sample %" PRId64 " us, smoothed %" PRId64 " us", __FUNCTION__, rttUs, mRTTUs);
+}
+
+int64_t RTPNackTracker::retryIntervalUs() const {
+    return mRTTUs > kMinRetryIntervalUs ? mRTTUs : kMinRetryIntervalUs;
+}
+
+void RTPNackTracker::onPacketReceived(uint32_t seqNum, uint32_t highestSeqNum, int64_t nowUs) {
+    int32_t delta = (int32_t)(seqNum - highestSeqNum);
+
+    if (delta <= 0) {
+        // reordered or retransmitted
+        ssize_t index = mMissing.indexOfKey(seqNum);
+
+        if (index >= 0) {
+            if (mMissing.valueAt(index).mRetries > 0) {
+                mRecoveredCount++;
+            }
+
+            mMissing.removeItemsAt(index);
+        }
+
+        return;
+    }
+
+    if (delta == 1) {
+        return;
+    }
+
+    uint32_t gap = (uint32_t)delta - 1;
+
+    if (gap > kMaxMissing) {
+        ALOGW("%s,gap(%u) before seqNum(%u) too large, leave it to key frame", __FUNCTION__, gap,
+              seqNum);
+        mGivenUpCount += mMissing.size();
+        mMissing.clear();
+        return;
+    }
+
+    // the retransmission can not arrive before the jitter buffer gives up
+    if (mRTTUs >= mDeadlineUs) {
+        return;
+    }
+
+    MissingInfo info;
+    info.mDetectedUs = nowUs;
+    info.mNextRequestUs = nowUs + kReorderHoldUs;
+    info.mRetries = 0;
+
+    for (uint32_t seq = highestSeqNum + 1; seq != seqNum; seq++) {
+        mMissing.add(seq, info);
+    }
+
+    if (mMissing.size() > kMaxMissing) {
+        size_t count = mMissing.size() - kMaxMissing;
+        mGivenUpCount += count;
+        mMissing.removeItemsAt(0, count);
+    }
+}
+
+sp<ABuffer> RTPNackTracker::buildFCIs(int64_t nowUs) {
+    sp<ABuffer> fcis;
+    uint8_t* data = NULL;
+    size_t fciCount = 0;
+
+    bool hasFCI = false;
+    uint32_t pid = 0;
+    uint16_t blp = 0;
+
+    for (size_t i = 0; i < mMissing.size(); i++) {
+        MissingInfo& info = mMissing.editValueAt(i);
+
+        if (info.mNextRequestUs > nowUs || nowUs - info.mDetectedUs >= mDeadlineUs) {
+            continue;
+        }
+
+        uint32_t seq = mMissing.keyAt(i);
+
+        if (hasFCI && seq - pid <= 16) {
+            blp |= (uint16_t)(0x0001 << (seq - pid - 1));
+        } else {
+            if (hasFCI) {
+                data[0] = (pid >> 8) & 0xff;
+                data[1] = pid & 0xff;
+                data[2] = (blp >> 8) & 0xff;
+                data[3] = blp & 0xff;
+                data += 4;
+
+                if (++fciCount == kMaxFCIs) {
+                    hasFCI = false;
+                    break;
+                }
+            } else {
+                fcis = new ABuffer(kMaxFCIs * 4);
+                data = fcis->data();
+            }
+
+            hasFCI = true;
+            pid = seq;
+            blp = 0;
+        }
+
+        info.mRetries++;
+        mRequestedCount++;
+
+        if (info.mRetries < kMaxRetries) {
+            info.mNextRequestUs = nowUs + retryIntervalUs();
+        } else {
+            // no more request, wait until the deadline
+            info.mNextRequestUs = info.mDetectedUs + mDeadlineUs;
+        }
+    }
+
+    if (hasFCI) {
+        data[0] = (pid >> 8) & 0xff;
+        data[1] = pid & 0xff;
+        data[2] = (blp >> 8) & 0xff;
+        data[3] = blp & 0xff;
+        fciCount++;
+    }
+
+    if (fcis.get()) {
+        fcis->setRange(0, fciCount * 4);
+    }
+
+    return fcis;
+}
+
+size_t RTPNackTracker::removeExpired(int64_t nowUs) {
+    size_t count = 0;
+
+    while (count < mMissing.size() && nowUs - mMissing.valueAt(count).mDetectedUs >= mDeadlineUs) {
+        count++;
+    }
+
+    if (count > 0) {
+        ALOGI("%s,give up %zu packets from seqNum(%u), rtt %" PRId64 " us", __FUNCTION__, count,
+              mMissing.keyAt(0), mRTTUs);
+        mGivenUpCount += count;
+        mMissing.removeItemsAt(0, count);
+    }
+
+    return count;
+}
+
+bool RTPNackTracker::isPendingBefore(uint32_t seqNum, int64_t nowUs) const {
+    for (size_t i = 0; i < mMissing.size(); i++) {
+        if ((int32_t)(mMissing.keyAt(i) - seqNum) >= 0) {
+            return false;
+        }
+
+        if (nowUs - mMissing.valueAt(i).mDetectedUs < mDeadlineUs) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int64_t RTPNackTracker::nextEventUs() const {
+    int64_t eventUs = -1;
+
+    for (size_t i = 0; i < mMissing.size(); i++) {
+        const MissingInfo& info = mMissing.valueAt(i);
+        int64_t timeUs = info.mNextRequestUs;
+
+        if (timeUs > info.mDetectedUs + mDeadlineUs) {
+            timeUs = info.mDetectedUs + mDeadlineUs;
+        }
+
+        if (eventUs < 0 || timeUs < eventUs) {
+            eventUs = timeUs;
+        }
+    }
+
+    return eventUs;
+}
+
+}  // namespace imsma
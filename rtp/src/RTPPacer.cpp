@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPPacer"
+#include <utils/Log.h>
+
+#include "RTPPacer.h"
+
+namespace imsma {
+
+RTPPacer::RTPPacer() {
+    mPacingFactorPercent = kDefaultPacingFactorPercent;
+    mTargetBitrate = 0;
+    mPacingRate = 0;
+    reset();
+}
+
+void RTPPacer::reset() {
+    mBudget = 0;
+    mLastUpdateUs = -1;
+}
+
+void RTPPacer::setPacingFactor(uint32_t percent) {
+    mPacingFactorPercent = percent;
+    updatePacingRate();
+}
+
+void RTPPacer::setTargetBitrate(uint32_t bitrate) {
+    mTargetBitrate = bitrate;
+    updatePacingRate();
+}
+
+void RTPPacer::updatePacingRate() {
+    uint32_t rate = (uint64_t)mTargetBitrate * mPacingFactorPercent / 100;
+
+    if (rate != mPacingRate) {
+        ALOGD("%s,target %u bps,factor %u%%,pacing rate %u bps", __FUNCTION__, mTargetBitrate,
+              mPacingFactorPercent, rate);
+        mPacingRate = rate;
+    }
+}
+
+void RTPPacer::updateBudget(int64_t nowUs) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    int64_t maxBudget = (int64_t)mPacingRate * kMaxBurstUs;
+
+    if (mLastUpdateUs < 0) {
+        mLastUpdateUs = nowUs;
+        mBudget = maxBudget;
+        return;
+    }
+
+    int64_t elapsedUs = nowUs - mLastUpdateUs;
+
+    if (elapsedUs <= 0) {
+        return;
+    }
+
+    mLastUpdateUs = nowUs;
+
+    // the debt of one packet is paid in far less, avoid overflow after a long idle
+    if (elapsedUs > 1000000ll) {
+        elapsedUs = 1000000ll;
+    }
+
+    mBudget += (int64_t)mPacingRate * elapsedUs;
+
+    // an idle period only gives kMaxBurstUs of budget
+    if (mBudget > maxBudget) {
+        mBudget = maxBudget;
+    }
+}
+
+void RTPPacer::onPacketSent(size_t size) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    mBudget -= (int64_t)size * 8 * 1000000ll;
+}
+
+int64_t RTPPacer::getWaitUs() const {
+    if (canSend()) {
+        return 0;
+    }
+
+    // time to pay the debt
+    int64_t waitUs = -mBudget / mPacingRate + 1;
+
+    return waitUs > kMinWaitUs ? waitUs : kMinWaitUs;
+}
+
+}  // namespace imsma
@@ -277,6 +277,36 @@ int RTPReceiver::videoRTPPacketCallBack(void* cookie, const sp<ABuffer>& buffer)
     return OK;
 }
 
+// one lock and at most one kWhatRTPPacket for a whole recvmmsg batch
+int RTPReceiver::videoRTPPacketBatchCallBack(void* cookie, const sp<ABuffer>* buffers,
+                                             int count) {
+    ALOGV("%s,count(%d)", __FUNCTION__, count);
+
+    RTPReceiver* rtpRecv = static_cast<RTPReceiver*>(cookie);
+
+    if (rtpRecv == NULL) {
+        ALOGW("%s,cookie = NULL", __FUNCTION__);
+        return UNKNOWN_ERROR;
+    }
+
+    Mutex::Autolock autoLock(rtpRecv->mVideoRTPQueueLock);
+    Vector<sp<ABuffer> >* videoRTPQueue = rtpRecv->video_queue();
+
+    for (int i = 0; i < count; i++) {
+        videoRTPQueue->push_back(buffers[i]);
+    }
+
+    if (rtpRecv->mVideoRTPPending) {
+        return OK;
+    }
+
+    sp<AMessage> msg = new AMessage(kWhatRTPPacket, rtpRecv);
+    msg->setInt32("trackIndex", IMSMA_RTP_VIDEO);
+    msg->post();
+    rtpRecv->mVideoRTPPending = true;
+    return OK;
+}
+
 status_t RTPReceiver::processSenderInfo(const sp<ABuffer>& buffer, uint32_t uSSRC,
                                         uint8_t trackIndex) {
     sp<AMessage> msg = new AMessage(kWhatProcessSR, this);
@@ -287,6 +317,14 @@ status_t RTPReceiver::processSenderInfo(const sp<ABuffer>& buffer, uint32_t uSSR
     return OK;
 }
 
+status_t RTPReceiver::updateRoundTripTime(int64_t rttUs, int32_t trackIndex) {
+    sp<AMessage> msg = new AMessage(kWhatUpdateRTT, this);
+    msg->setInt64("rtt_us", rttUs);
+    msg->setInt32("trackIndex", trackIndex);
+    msg->post();
+    return OK;
+}
+
 status_t RTPReceiver::postTimeUpdate(uint32_t rtpTime, uint64_t ntpTime, int32_t trackIndex) {
     sp<AMessage> msg = new AMessage(kWhatTimeUpdate, this);
     msg->setInt32("trackIndex", trackIndex);
@@ -553,6 +591,69 @@ void RTPReceiver::onMessageReceived(const sp<AMessage>& msg) {
                 }
             }
 
+            // one NACK for the holes found in the whole batch
+            pollSource(trackIndex);
+            break;
+        }
+
+        case kWhatPollSource: {
+            int32_t trackIndex = IMSMA_RTP_VIDEO;
+            msg->findInt32("trackIndex", &trackIndex);
+
+            int32_t generation = 0;
+            msg->findInt32("generation", &generation);
+
+            for (size_t i = 0; i < mpTrackInfos.size(); i++) {
+                if (mpTrackInfos[i]->mTrackIndex == trackIndex) {
+                    if (generation != mpTrackInfos[i]->mPollGeneration) {
+                        // replaced by an earlier poll
+                        break;
+                    }
+
+                    mpTrackInfos[i]->mPollTimeUs = -1;
+                    pollSource(trackIndex);
+                    break;
+                }
+            }
+
+            break;
+        }
+
+        case kWhatSendTransportFeedback: {
+            int32_t trackIndex = IMSMA_RTP_VIDEO;
+            msg->findInt32("trackIndex", &trackIndex);
+
+            int32_t generation = 0;
+            msg->findInt32("generation", &generation);
+
+            for (size_t i = 0; i < mpTrackInfos.size(); i++) {
+                if (mpTrackInfos[i]->mTrackIndex == trackIndex) {
+                    if (generation == mpTrackInfos[i]->mFeedbackGeneration) {
+                        sendTransportFeedback(trackIndex);
+                    }
+
+                    break;
+                }
+            }
+
+            break;
+        }
+
+        case kWhatUpdateRTT: {
+            int32_t trackIndex = IMSMA_RTP_VIDEO;
+            msg->findInt32("trackIndex", &trackIndex);
+
+            int64_t rttUs = 0;
+            msg->findInt64("rtt_us", &rttUs);
+
+            for (size_t i = 0; i < mpTrackInfos.size(); i++) {
+                if (mpTrackInfos[i]->mTrackIndex == trackIndex &&
+                    (mpTrackInfos[i]->mRTPSource).get()) {
+                    mpTrackInfos[i]->mRTPSource->updateRoundTripTime(rttUs);
+                    break;
+                }
+            }
+
             break;
         }
 
@@ -823,7 +924,7 @@ void RTPReceiver::onMessageReceived(const sp<AMessage>& msg) {
                 // msg->findInt32("orig_seqNum",&packetLostOrigSeqNum);
                 ALOGI("assembler detect packet lost, Num:%d pli limit: 1", LostCount);
 
-                // trigger pli
+                // trigger pli, retransmission has not recovered them in time
                 if (LostCount >= 1) {
                     sp<AMessage> msg = mNotify->dup();
                     msg->setInt32("trackIndex", trackIndex);
@@ -833,65 +934,10 @@ void RTPReceiver::onMessageReceived(const sp<AMessage>& msg) {
 
                 uint8_t* pTmBuf = TmBuf->base();
 
+                // missing packets are NACKed by RTPSource as soon as detected,
+                // the assembler only reports the ones given up after the NACK deadline
                 for (int32_t i = 0; i < LostCount; i++) {
                     ALOGI("kWhatPacketLost, count:%d seq=%d", i, ((uint32_t*)pTmBuf)[i]);
-
-                    pTrack->mLostPacketSeqNumList.push_back(((uint32_t*)pTmBuf)[i]);
-
-                    for (List<uint32_t>::iterator j = (pTrack->mLostPacketSeqNumList).begin();
-                         j != (pTrack->mLostPacketSeqNumList).end();) {
-                        if ((((uint32_t*)pTmBuf)[i] - (*j)) > 16) {
-                            j = (pTrack->mLostPacketSeqNumList).erase(j);
-                        } else {
-                            break;
-                        }
-                    }
-                }
-
-                uint8_t list_size = (pTrack->mLostPacketSeqNumList).size();
-
-                // not feedback nack too frequent,
-                // only many continues packet lost,we trigger nack
-                if (list_size >= 8) {
-                    ALOGI("more than 8 continues packet lost");
-                    sp<ABuffer> nack_fci = new ABuffer(4);
-                    memset(nack_fci->data(), 0, nack_fci->size());
-
-                    uint8_t* data = nack_fci->data();
-                    List<uint32_t>::iterator it = (pTrack->mLostPacketSeqNumList).begin();
-                    uint32_t u32firstSeqNum = *it;
-                    uint16_t u16firstSeqNum = (uint16_t)u32firstSeqNum;
-
-                    data[0] = (u16firstSeqNum >> 8) & 0x00FF;
-                    data[1] = u16firstSeqNum & 0x00FF;
-
-                    ALOGD("packet lost: first seqN = %d", u16firstSeqNum);
-
-                    (pTrack->mLostPacketSeqNumList).erase(it);
-
-                    // uint16_t* blp_data =(uint16_t*)&data[2];
-                    uint16_t blp_data = 0;
-
-                    for (List<uint32_t>::iterator i = (pTrack->mLostPacketSeqNumList).begin();
-                         i != (pTrack->mLostPacketSeqNumList).end(); i++) {
-                        uint8_t seqNumDelta = (*i) - u32firstSeqNum;
-
-                        if (seqNumDelta >= 1) {
-                            blp_data |= (0x0001 << (seqNumDelta - 1));
-                        }
-                    }
-
-                    data[2] = (blp_data >> 8) & 0xff;
-                    data[3] = blp_data & 0xff;
-
-                    ALOGI("following packet lost seqNums:0x%x", blp_data);
-                    (pTrack->mLostPacketSeqNumList).clear();
-
-                    sp<AMessage> msg = mNotify->dup();
-                    msg->setInt32("trackIndex", trackIndex);
-                    msg->setInt32("what", kWhatGenericNACK);
-                    msg->setBuffer("nack_fci", nack_fci);
-                    msg->post();
                 }
             }
 
@@ -1052,6 +1098,7 @@ status_t RTPReceiver::onAddStream(rtp_rtcp_config_t* pRTPNegotiatedParams,
     pTrack->mTrackIndex = trackIndex;
     // pTrack->mConfigParam = *pRTPNegotiatedParams;//ToDo: can we assign struct this way
     copyConfigParams(pRTPNegotiatedParams, &(pTrack->mConfigParam));
+    pTrack->mTransportCCExtId = RTPTransportFeedback::getExtensionId(&(pTrack->mConfigParam));
     pTrack->mRTPSource = NULL;
     pTrack->mSSRCset = false;
     pTrack->mSSRCid = 0;
@@ -1164,6 +1211,7 @@ status_t RTPReceiver::onUpdateConfigParams(rtp_rtcp_config_t* pRTPNegotiatedPara
     }
 
     copyConfigParams(pRTPNegotiatedParams, &(pTrack->mConfigParam));
+    pTrack->mTransportCCExtId = RTPTransportFeedback::getExtensionId(&(pTrack->mConfigParam));
 
     // no need update to RTPSource
     // RTPSource will not use the params except mime_type
@@ -1221,6 +1269,11 @@ status_t RTPReceiver::onStart(int32_t trackIndex) {
 
     pTrack->mStarted = true;
 
+    // the peer may restart the transport wide seq after hold
+    pTrack->mTransportFeedback.reset();
+    pTrack->mFeedbackScheduled = false;
+    pTrack->mFeedbackGeneration++;
+
     ALOGD("sim=%d op id %d,name = %s", mSimID, mOperatorID, getOperatorName(mOperatorID));
 
     // before listen new RTP packet,clear the old RTP packets
@@ -1235,7 +1288,7 @@ status_t RTPReceiver::onStart(int32_t trackIndex) {
     sp<SocketWrapper> socketWrapper = pTrack->mSocketWrapper;
 
     if (trackIndex == IMSMA_RTP_VIDEO) {
-        socketWrapper->setRxCallBack(this, videoRTPPacketCallBack);
+        socketWrapper->setRxBatchCallBack(this, videoRTPPacketBatchCallBack);
     }
 
     ALOGD("%s,track(%d)", __FUNCTION__, trackIndex);
@@ -1306,9 +1359,12 @@ status_t RTPReceiver::onStop(int32_t trackIndex) {
     pTrack->mIsFirstAccu = true;
     pTrack->mRtpTimeCycles = 0;
 
-    pTrack->mLostPacketSeqNumList.clear();
     pTrack->mSRRtpTimeCycles = 0;
 
+    // drop the arrivals not reported yet
+    pTrack->mFeedbackScheduled = false;
+    pTrack->mFeedbackGeneration++;
+
     // stop listen rtp packet
     sp<SocketWrapper> socketWrapper = pTrack->mSocketWrapper;
     socketWrapper->setRxCallBack(0, 0);
@@ -1458,8 +1514,6 @@ status_t RTPReceiver::changeSSRC(sp<ABuffer>& packet, int32_t trackIndex, uint32
         pTrack->mLastAccuRtpTime = 0;
         pTrack->mRtpTimeCycles = 0;
 
-        pTrack->mLostPacketSeqNumList.clear();
-
         pTrack->mIsFirstAccu = true;
         pTrack->mRtpTimeAnchor = 0;
         pTrack->mExtenedRtpTimeAnchor = -1;
@@ -1521,6 +1575,10 @@ status_t RTPReceiver::queueRTPPacket(sp<ABuffer>& packet, int32_t trackIndex, ui
 
     int64_t time_startUs = ALooper::GetNowUs();
 
+    /* transport-cc reports when the packet hit the socket, not when the looper got to it */
+    int64_t arrivalTimeUs = time_startUs;
+    packet->meta()->findInt64(SOCKETWRAPPER_META_RECV_TIME_US, &arrivalTimeUs);
+
     ALOGV("%s,track(%d),seqN(%d),size(%zu)", __FUNCTION__, trackIndex, seqN, size);
 
     if (seqN - mLastSeqN != 1) {
@@ -1632,6 +1690,28 @@ status_t RTPReceiver::queueRTPPacket(sp<ABuffer>& packet, int32_t trackIndex, ui
                 memcpy(&extension_data, &_data[offset], extension_length);
                 offset += extension_length;
 
+                if (pTrack->mTransportCCExtId > 0 && extension_id == pTrack->mTransportCCExtId) {
+                    if (extension_length == 2) {
+                        uint16_t transport_seq = extension_data[0] << 8 | extension_data[1];
+                        pTrack->mTransportFeedback.onPacketArrived(transport_seq, arrivalTimeUs);
+
+                        if (!pTrack->mFeedbackScheduled) {
+                            pTrack->mFeedbackScheduled = true;
+
+                            sp<AMessage> msg = new AMessage(kWhatSendTransportFeedback, this);
+                            msg->setInt32("trackIndex", trackIndex);
+                            msg->setInt32("generation", pTrack->mFeedbackGeneration);
+                            msg->post(RTPTransportFeedback::kFeedbackIntervalUs);
+                        }
+                    }
+
+                    while (offset < extensionLength && _data[offset] == 0) {
+                        offset++;
+                    }
+
+                    continue;
+                }
+
                 // find extetion name according extension id
                 // ToDo:we know we support sendrecv for CVO
                 // avoid peer set wrong direction capability, we will not filter cvo info as
@@ -1707,11 +1787,14 @@ status_t RTPReceiver::queueRTPPacket(sp<ABuffer>& packet, int32_t trackIndex, ui
 
     uint32_t rtpTime = u32at(&data[4]);
 
-    sp<AMessage> meta = packet->meta();
-    meta->setInt32("ssrc", srcId);
-    meta->setInt32("rtp-time", rtpTime);  // ToDo: uint32_t set to int32,whill drop data?
-    meta->setInt32("PT", pt);
-    meta->setInt32("M", data[1] >> 7);
+    RTPPacketInfo info;
+    memset(&info, 0, sizeof(info));
+    info.mSSRC = srcId;
+    info.mRtpTime = rtpTime;
+    info.mPT = pt;
+    info.mMarker = data[1] >> 7;
+    info.mCameraFacing = IMSMA_CAMERA_FACING_UNKNOW;
+    info.mFlip = IMSMA_CAMERA_NO_FLIP;
 
     if (trackIndex == IMSMA_RTP_VIDEO) {
         int32_t ccw_rotation = 0;  // counter clockwise rotation
@@ -1740,24 +1823,24 @@ status_t RTPReceiver::queueRTPPacket(sp<ABuffer>& packet, int32_t trackIndex, ui
             flip = mLastCVOinfo & 0x04;
         }
 
-        meta->setInt32("ccw_rotation", ccw_rotation);
-        meta->setInt32("camera_facing", camera_facing);
-        meta->setInt32("flip", flip);
+        info.mCCWRotation = ccw_rotation;
+        info.mCameraFacing = camera_facing;
+        info.mFlip = flip;
     }
 
     // int32_t seqNum = (int32_t)u16at(&data[2]);
-    meta->setInt32("token", seqN);
+    info.mToken = seqN;
 
     // for adaptation
     int32_t rtp_whole_size = packet->size();
-    meta->setInt32("rtp_size", rtp_whole_size);
-    meta->setInt32("rtp_overhead", rtp_whole_size - (size - payloadOffset));
+    info.mRtpSize = rtp_whole_size;
+    info.mRtpOverhead = rtp_whole_size - (size - payloadOffset);
 
     packet->setInt32Data(seqN);
     ALOGV("%s,payloadOffset:%zu", __FUNCTION__, payloadOffset);
     packet->setRange(packet->offset() + payloadOffset, size - payloadOffset);
 
-    source->processRTPPacket(packet);
+    source->processRTPPacket(packet, &info);
 
     int64_t time_endUs = ALooper::GetNowUs();
 
@@ -1767,6 +1850,85 @@ status_t RTPReceiver::queueRTPPacket(sp<ABuffer>& packet, int32_t trackIndex, ui
     return OK;
 }
 
+// jitter buffer release and NACK retries are driven by time, not only by packet arrival
+void RTPReceiver::pollSource(int32_t trackIndex) {
+    sp<TrackInfo> pTrack;
+
+    for (size_t i = 0; i < mpTrackInfos.size(); i++) {
+        if (mpTrackInfos[i]->mTrackIndex == trackIndex) {
+            pTrack = mpTrackInfos[i];
+            break;
+        }
+    }
+
+    if (!pTrack.get() || !pTrack->mStarted || !(pTrack->mRTPSource).get()) {
+        return;
+    }
+
+    int64_t nextCheckUs = -1;
+    sp<ABuffer> nack_fci = pTrack->mRTPSource->poll(&nextCheckUs);
+
+    if (nack_fci.get()) {
+        ALOGI("%s,track(%d) nack fci num(%zu)", __FUNCTION__, trackIndex, nack_fci->size() / 4);
+
+        sp<AMessage> notify = mNotify->dup();
+        notify->setInt32("trackIndex", trackIndex);
+        notify->setInt32("what", kWhatGenericNACK);
+        notify->setBuffer("nack_fci", nack_fci);
+        notify->post();
+    }
+
+    if (nextCheckUs < 0) {
+        return;
+    }
+
+    int64_t pollTimeUs = ALooper::GetNowUs() + nextCheckUs;
+
+    if (pTrack->mPollTimeUs < 0 || pollTimeUs < pTrack->mPollTimeUs) {
+        pTrack->mPollGeneration++;
+        pTrack->mPollTimeUs = pollTimeUs;
+
+        sp<AMessage> msg = new AMessage(kWhatPollSource, this);
+        msg->setInt32("trackIndex", trackIndex);
+        msg->setInt32("generation", pTrack->mPollGeneration);
+        msg->post(nextCheckUs);
+    }
+}
+
+void RTPReceiver::sendTransportFeedback(int32_t trackIndex) {
+    sp<TrackInfo> pTrack;
+
+    for (size_t i = 0; i < mpTrackInfos.size(); i++) {
+        if (mpTrackInfos[i]->mTrackIndex == trackIndex) {
+            pTrack = mpTrackInfos[i];
+            break;
+        }
+    }
+
+    if (!pTrack.get()) {
+        return;
+    }
+
+    sp<ABuffer> fci = pTrack->mTransportFeedback.buildFCI();
+
+    if (!fci.get()) {
+        // no packet since the last feedback, restart on the next arrival
+        pTrack->mFeedbackScheduled = false;
+        return;
+    }
+
+    sp<AMessage> notify = mNotify->dup();
+    notify->setInt32("trackIndex", trackIndex);
+    notify->setInt32("what", kWhatTransportFeedback);
+    notify->setBuffer("fci", fci);
+    notify->post();
+
+    sp<AMessage> msg = new AMessage(kWhatSendTransportFeedback, this);
+    msg->setInt32("trackIndex", trackIndex);
+    msg->setInt32("generation", pTrack->mFeedbackGeneration);
+    msg->post(RTPTransportFeedback::kFeedbackIntervalUs);
+}
+
 status_t RTPReceiver::onProcessSenderInfo(const sp<ABuffer>& buffer, uint32_t uSSRC,
                                           uint8_t trackIndex) {
     // find related track and RTPSource
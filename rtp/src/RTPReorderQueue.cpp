@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPReorderQueue"
+#include <utils/Log.h>
+
+#include "RTPReorderQueue.h"
+
+#include <media/stagefright/foundation/ADebug.h>
+
+namespace imsma {
+
+RTPReorderQueue::RTPReorderQueue() {
+    mSlots = new sp<ABuffer>[kCapacity];
+    mInfos = new RTPPacketInfo[kCapacity];
+    mCount = 0;
+    mHeadSeq = 0;
+    mTailSeq = 0;
+}
+
+RTPReorderQueue::~RTPReorderQueue() {
+    delete[] mSlots;
+    delete[] mInfos;
+}
+
+RTPReorderQueue::InsertResult RTPReorderQueue::insert(const sp<ABuffer>& buffer,
+                                                      const RTPPacketInfo& info) {
+    uint32_t seqNum = (uint32_t)buffer->int32Data();
+
+    if (mCount == 0) {
+        mHeadSeq = seqNum;
+        mTailSeq = seqNum + 1;
+        mSlots[seqNum & kMask] = buffer;
+        mInfos[seqNum & kMask] = info;
+        mCount = 1;
+        return INSERTED;
+    }
+
+    // use signed distance, extended seqNum may be wrapped around 0
+    if ((int32_t)(seqNum - mHeadSeq) < 0) {
+        if (mTailSeq - seqNum > kCapacity) {
+            ALOGW("%s,seqNum(%u) too old, head(%u) tail(%u)", __FUNCTION__, seqNum, mHeadSeq,
+                  mTailSeq);
+            return TOO_OLD;
+        }
+
+        mHeadSeq = seqNum;
+    } else if ((int32_t)(seqNum - mTailSeq) < 0) {
+        if (mSlots[seqNum & kMask].get() != NULL) {
+            return DUPLICATE;
+        }
+    } else {
+        if (seqNum - mHeadSeq >= kCapacity) {
+            ALOGW("%s,seqNum(%u) out of window, drop packets before %u", __FUNCTION__, seqNum,
+                  seqNum - kCapacity + 1);
+            dropFrontUntil(seqNum - kCapacity + 1);
+
+            if (mCount == 0) {
+                mHeadSeq = seqNum;
+            }
+        }
+
+        mTailSeq = seqNum + 1;
+    }
+
+    mSlots[seqNum & kMask] = buffer;
+    mInfos[seqNum & kMask] = info;
+    mCount++;
+    return INSERTED;
+}
+
+void RTPReorderQueue::pop_front() {
+    CHECK(mCount > 0);
+
+    mSlots[mHeadSeq & kMask].clear();
+    mCount--;
+
+    if (mCount == 0) {
+        mHeadSeq = mTailSeq;
+        return;
+    }
+
+    // skip the holes of lost packets, bounded by the window size
+    do {
+        mHeadSeq++;
+    } while (mSlots[mHeadSeq & kMask].get() == NULL);
+}
+
+void RTPReorderQueue::dropFrontUntil(uint32_t seqNum) {
+    while (mCount > 0 && (int32_t)(mHeadSeq - seqNum) < 0) {
+        pop_front();
+    }
+}
+
+void RTPReorderQueue::clear() {
+    while (mCount > 0) {
+        pop_front();
+    }
+}
+
+}  // namespace imsma
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPSendHistory"
+#include <utils/Log.h>
+
+#include "RTPSendHistory.h"
+
+#include <inttypes.h>
+
+namespace imsma {
+
+RTPSendHistory::RTPSendHistory() {
+    mSlots = new Entry[kCapacity];
+    mWindowUs = 0;
+    clear();
+}
+
+RTPSendHistory::~RTPSendHistory() {
+    delete[] mSlots;
+}
+
+void RTPSendHistory::insert(const sp<ABuffer>& rtpPacket, uint16_t seqNum, int64_t sentUs) {
+    Entry* entry = &mSlots[seqNum & kMask];
+
+    entry->packet = rtpPacket;
+    entry->seqNum = seqNum;
+    entry->sentUs = sentUs;
+    entry->resentUs = -1;
+}
+
+RTPSendHistory::LookupResult RTPSendHistory::lookup(uint16_t seqNum, int64_t nowUs,
+                                                    sp<ABuffer>* rtpPacket) {
+    Entry* entry = &mSlots[seqNum & kMask];
+
+    if (entry->packet.get() == NULL || entry->seqNum != seqNum) {
+        return NOT_FOUND;
+    }
+
+    if (nowUs - entry->sentUs > mWindowUs) {
+        ALOGV("%s,seqNum(%u) aged out, sent %" PRId64 " us ago", __FUNCTION__, seqNum,
+              nowUs - entry->sentUs);
+        // no need to hold the payload any more
+        entry->packet.clear();
+        return NOT_FOUND;
+    }
+
+    if (entry->resentUs >= 0 && nowUs - entry->resentUs < kMinResendIntervalUs) {
+        return RESENT_RECENTLY;
+    }
+
+    entry->resentUs = nowUs;
+    *rtpPacket = entry->packet;
+    return FOUND;
+}
+
+void RTPSendHistory::clear() {
+    for (uint32_t i = 0; i < kCapacity; i++) {
+        mSlots[i].packet.clear();
+        mSlots[i].seqNum = 0;
+        mSlots[i].sentUs = 0;
+        mSlots[i].resentUs = -1;
+    }
+}
+
+}  // namespace imsma
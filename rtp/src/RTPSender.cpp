@@ -37,6 +37,7 @@
 
 #include "IVcodecCap.h"
 #include "VcodecCap.h"
+#include "comutils.h"
 
 using namespace android;
 using android::status_t;
@@ -58,6 +59,11 @@ RTPSender::RTPSender(uint32_t ssrc, sp<SocketWrapper> spRTPSocketWrapper, sp<AMe
 
     mAdaInfo = new TxAdaptationInfo();
 
+    char cc_param[PROPERTY_VALUE_MAX];
+    memset(cc_param, 0, sizeof(cc_param));
+    property_get("vendor.vt.imsma.rtp_cc", cc_param, "0");
+    mCongestionController = RTPCongestionController::create(atoi(cc_param), mAdaInfo);
+
     // ToDo:
     // need dup mNotify before using mNotify
 
@@ -73,6 +79,9 @@ RTPSender::RTPSender(uint32_t ssrc, sp<SocketWrapper> spRTPSocketWrapper, sp<AMe
 
     m_extmap_CVO_supported = 0;
     m_extmap_CVO_id = 0;
+    m_extmap_TWCC_supported = 0;
+    m_extmap_TWCC_id = 0;
+    mTransportSeqNum = 0;
 
     m_rtp_fix_header_len = 12;
     m_rtp_ext_header_len = 0;
@@ -95,6 +104,36 @@ RTPSender::RTPSender(uint32_t ssrc, sp<SocketWrapper> spRTPSocketWrapper, sp<AMe
 
     mLastReduceSignal = ImsSignal::Signal_STRENGTH_NONE_OR_UNKNOWN;
 
+    char zerocopy_param[PROPERTY_VALUE_MAX];
+    memset(zerocopy_param, 0, sizeof(zerocopy_param));
+    property_get("vendor.vt.imsma.rtp_zerocopy_tx", zerocopy_param, "1");
+    mZeroCopyTx = (atoi(zerocopy_param) > 0);
+    ALOGD("mZeroCopyTx=%d", mZeroCopyTx);
+
+    char nack_history_param[PROPERTY_VALUE_MAX];
+    memset(nack_history_param, 0, sizeof(nack_history_param));
+    snprintf(nack_history_param, sizeof(nack_history_param), "%d", kDefaultNACKHistoryMs);
+    property_get("vendor.vt.imsma.rtp_nack_history_ms", nack_history_param, nack_history_param);
+    int32_t nack_history_ms = atoi(nack_history_param);
+    mSendHistory.setWindowUs(nack_history_ms > 0 ? nack_history_ms * 1000ll : 0);
+    ALOGD("nack history window=%d ms", nack_history_ms);
+
+    char pacing_param[PROPERTY_VALUE_MAX];
+    memset(pacing_param, 0, sizeof(pacing_param));
+    snprintf(pacing_param, sizeof(pacing_param), "%u", RTPPacer::kDefaultPacingFactorPercent);
+    property_get("vendor.vt.imsma.rtp_pacing_factor", pacing_param, pacing_param);
+    int32_t pacing_factor = atoi(pacing_param);
+    mPacer.setPacingFactor(pacing_factor > 0 ? pacing_factor : 0);
+    ALOGD("pacing factor=%d%%", pacing_factor);
+
+    mResentCount = 0;
+    mResentBytes = 0;
+
+    memset(mSRNtpMid, 0, sizeof(mSRNtpMid));
+    memset(mSRSentTimeUs, 0, sizeof(mSRSentTimeUs));
+    mSRHistoryIndex = 0;
+    mLastRTTUs = -1;
+
 #ifdef DEBUG_DUMP_PACKET
     mDumpUpLinkPacket = 0;  // ToDo: 1 not work
     mRTPFd = -1;
@@ -126,6 +165,7 @@ RTPSender::RTPSender(uint32_t ssrc, sp<SocketWrapper> spRTPSocketWrapper, sp<AMe
 RTPSender::~RTPSender() {
     ALOGI("%s", __FUNCTION__);
 
+    delete mCongestionController;
     delete mAdaInfo;
 
 #ifdef DEBUG_DUMP_PACKET
@@ -246,7 +286,7 @@ void RTPSender::addSenderInfo(const sp<ABuffer>& buffer) {
     ALOGV("%s --", __FUNCTION__);
     return;
 }
-status_t RTPSender::processReportBlock(const sp<ABuffer>& packet) {
+status_t RTPSender::processReportBlock(const sp<ABuffer>& packet, int64_t* rttUs) {
     ALOGV("%s ++", __FUNCTION__);
     sp<AMessage> msg = new AMessage(kWhatProcessRecvReport, this);
     msg->setBuffer("buffer", packet);
@@ -254,6 +294,14 @@ status_t RTPSender::processReportBlock(const sp<ABuffer>& packet) {
     sp<AMessage> response;
     status_t err = msg->postAndAwaitResponse(&response);
 
+    if (rttUs != NULL) {
+        *rttUs = -1;
+
+        if (err == OK && response.get()) {
+            response->findInt64("rtt_us", rttUs);
+        }
+    }
+
     ALOGV("%s --", __FUNCTION__);
     return OK;
 }
@@ -289,6 +337,12 @@ void RTPSender::processTMMBR(sp<ABuffer> tmmbr_fci) {
     return;
 }
 
+void RTPSender::processTransportFeedback(sp<ABuffer> fb_fci) {
+    sp<AMessage> msg = new AMessage(kWhatProcessTransportFeedback, this);
+    msg->setBuffer("fb_fci", fb_fci);
+    msg->post();
+}
+
 uint32_t RTPSender::getSSRC() {
     ALOGI("%s ++", __FUNCTION__);
     sp<AMessage> msg = new AMessage(kWhatGetSSRC, this);
@@ -455,9 +509,26 @@ void RTPSender::onMessageReceived(const sp<AMessage>& msg) {
             msg->findInt32("generation", &rtp_generation);
             bool loop_once = false;
             uint32_t firstSeq = 0;
+            // packets from queue head already sent by the last sendmmsg
+            int batch_sent = 0;
+            int64_t sentUs = ALooper::GetNowUs();
+
+            // the encoder is above the pacing rate, send all rather than delay more
+            bool paced = mPacer.isEnabled() && !isRTPQueueOverdue();
 
             if (rtp_generation == mRTPGeneration) {
                 while (!mRTPPacketQueue.empty()) {
+                    // packets gathered by the last sendmmsg are already on the wire
+                    if (paced && batch_sent == 0) {
+                        mPacer.updateBudget(ALooper::GetNowUs());
+
+                        if (!mPacer.canSend()) {
+                            msg->post(mPacer.getWaitUs());
+                            mSendRTPEventPending = true;
+                            break;
+                        }
+                    }
+
                     if (mConfigParam.rtp_packet_bandwidth == 0) {
                         // ToDo
                         // Need check whether UA will set right vaule to me
@@ -482,7 +553,39 @@ void RTPSender::onMessageReceived(const sp<AMessage>& msg) {
                     }
 
                     int write_size = 0;
-                    write_size = mRTPSocketWrapper->writeSock(rtpPacket);
+
+                    if (!mZeroCopyTx) {
+                        write_size = mRTPSocketWrapper->writeSock(rtpPacket);
+                    } else {
+                        if (batch_sent == 0) {
+                            int max_count = SOCKETWRAPPER_TX_BATCH;
+
+                            if (paced) {
+                                // only the packets within the budget
+                                size_t billed = 0;
+                                max_count = 0;
+
+                                for (List<sp<ABuffer> >::iterator it = mRTPPacketQueue.begin();
+                                     it != mRTPPacketQueue.end() &&
+                                     max_count < SOCKETWRAPPER_TX_BATCH && mPacer.canSend(billed);
+                                     ++it, ++max_count) {
+                                    billed += getRTPPacketSize(*it);
+                                }
+                            }
+
+                            batch_sent = sendRTPPacketBatch(max_count);
+
+                            if (batch_sent < 0) {
+                                write_size = batch_sent;
+                                batch_sent = 0;
+                            }
+                        }
+
+                        if (batch_sent > 0) {
+                            write_size = getRTPPacketSize(rtpPacket);
+                            batch_sent--;
+                        }
+                    }
 
                     if (write_size < 0) {
                         ALOGW("kWhatSendRTPPacket,writeSock fail err(%d)(%s)", write_size,
@@ -505,13 +608,27 @@ void RTPSender::onMessageReceived(const sp<AMessage>& msg) {
                             CHECK(write_size > 0);
                             break;
                         }
-                    } else if ((uint32_t)write_size != (rtpPacket->size())) {
+                    } else if ((uint32_t)write_size != getRTPPacketSize(rtpPacket)) {
                         ALOGE("kWhatSendRTPPacket,writeSock write partial data:%d/%zu", write_size,
-                              rtpPacket->size());
+                              getRTPPacketSize(rtpPacket));
                     }
 
                     int32_t seqNum = rtpPacket->int32Data();
 
+                    // keep for Generic NACK, the seqNum on wire is the low 16 bits
+                    if (write_size > 0 && mSendHistory.getWindowUs() > 0) {
+                        mSendHistory.insert(rtpPacket, seqNum & 0xffff, sentUs);
+                    }
+
+                    if (write_size > 0) {
+                        mPacer.onPacketSent(write_size);
+
+                        // the feedback is keyed by the transport wide seq when negotiated
+                        int32_t transportSeq = seqNum & 0xffff;
+                        rtp_meta->findInt32("transport_seq", &transportSeq);
+                        mCongestionController->onPacketSent(transportSeq, write_size, sentUs);
+                    }
+
                     if (loop_once == false) {
                         firstSeq = seqNum;
                         loop_once = true;
@@ -549,13 +666,22 @@ void RTPSender::onMessageReceived(const sp<AMessage>& msg) {
 
                     if (mRTPFd >= 0) {
                         size_t real_write = write(mRTPFd, rtpPacket->data(), rtpPacket->size());
+                        sp<ABuffer> payload;
+
+                        if (rtp_meta->findBuffer("payload", &payload)) {
+                            size_t payload_offset = 0;
+                            rtp_meta->findSize("payload_offset", &payload_offset);
+                            real_write += write(mRTPFd, payload->data() + payload_offset,
+                                                payload_size);
+                        }
+
                         ALOGV("write to file,real_write(%zu)", real_write);
                     }
 
 #endif
                 }
 
-                ALOGD("kWhatSendRTPPacket,dequeue rtp packet(seqNum:%d-%d)", firstSeq,
+                ALOGV("kWhatSendRTPPacket,dequeue rtp packet(seqNum:%d-%d)", firstSeq,
                       mAdaInfo->getLastRTPSeqNum());
             } else {
                 ALOGW("kWhatSendRTPPacket overdue");
@@ -589,6 +715,7 @@ void RTPSender::onMessageReceived(const sp<AMessage>& msg) {
 
             sp<AMessage> response = new AMessage;
             response->setInt32("err", err);
+            response->setInt64("rtt_us", err == OK ? mLastRTTUs : -1);
 
             response->postReply(replyID);
             break;
@@ -632,6 +759,13 @@ void RTPSender::onMessageReceived(const sp<AMessage>& msg) {
 
             break;
         }
+        case kWhatProcessTransportFeedback: {
+            sp<ABuffer> fb_fci;
+            msg->findBuffer("fb_fci", &fb_fci);
+            onProcessTransportFeedback(fb_fci);
+
+            break;
+        }
 
         case kWhatSetCVOinfo: {
             int32_t rotation = 0;
@@ -712,6 +846,10 @@ status_t RTPSender::onSetConfigParams(rtp_rtcp_config_t* pRTPNegotiatedParams) {
     // m_extmap_CVO_id = 0;
     // m_rtp_ext_header_len = 0;
 
+    // transport wide seq is only sent when negotiated this time
+    m_extmap_TWCC_supported = 0;
+    m_extmap_TWCC_id = 0;
+
     mConfigParam.rtp_header_extension_num = pRTPNegotiatedParams->rtp_header_extension_num;
 
     if (mConfigParam.rtp_header_extension_num > 0) {
@@ -738,6 +876,12 @@ status_t RTPSender::onSetConfigParams(rtp_rtcp_config_t* pRTPNegotiatedParams) {
             m_extmap_CVO_supported = 1;
             m_extmap_CVO_id = mConfigParam.rtp_ext_map[j].extension_id;
         }
+
+        if (!strcmp(RTPTransportFeedback::kExtensionURI,
+                    mConfigParam.rtp_ext_map[j].extension_uri)) {
+            m_extmap_TWCC_supported = 1;
+            m_extmap_TWCC_id = mConfigParam.rtp_ext_map[j].extension_id;
+        }
     }
 
     mConfigParam.rtcp_sender_bandwidth = pRTPNegotiatedParams->rtcp_sender_bandwidth;      // in bps
@@ -777,6 +921,9 @@ status_t RTPSender::onSetConfigParams(rtp_rtcp_config_t* pRTPNegotiatedParams) {
     mConfigParam.network_info.MBR_UL = (pRTPNegotiatedParams->network_info).MBR_UL;
     mAdaInfo->setMBRUL(mConfigParam.network_info.MBR_UL);
     ALOGD("\t MBR_UL = %d kbps", mConfigParam.network_info.MBR_UL);
+    mCongestionController->setMaxBitrate(getMaxBitrate());
+    // until the first adjustment the encoder runs up to the negotiated bitrate
+    mPacer.setTargetBitrate(getMaxBitrate());
 
     ALOGI("mLooper check");
     return OK;
@@ -800,6 +947,10 @@ status_t RTPSender::onUpdateConfigParams(rtp_rtcp_config_t* pRTPNegotiatedParams
     // m_extmap_CVO_id = 0;
     // m_rtp_ext_header_len = 0;
 
+    // transport wide seq is only sent when negotiated this time
+    m_extmap_TWCC_supported = 0;
+    m_extmap_TWCC_id = 0;
+
     mConfigParam.rtp_header_extension_num = pRTPNegotiatedParams->rtp_header_extension_num;
 
     if (mConfigParam.rtp_header_extension_num > 0) {
@@ -828,6 +979,12 @@ status_t RTPSender::onUpdateConfigParams(rtp_rtcp_config_t* pRTPNegotiatedParams
             m_extmap_CVO_supported = 1;
             m_extmap_CVO_id = mConfigParam.rtp_ext_map[j].extension_id;
         }
+
+        if (!strcmp(RTPTransportFeedback::kExtensionURI,
+                    mConfigParam.rtp_ext_map[j].extension_uri)) {
+            m_extmap_TWCC_supported = 1;
+            m_extmap_TWCC_id = mConfigParam.rtp_ext_map[j].extension_id;
+        }
     }
 
     mConfigParam.rtcp_sender_bandwidth = pRTPNegotiatedParams->rtcp_sender_bandwidth;
@@ -881,6 +1038,9 @@ status_t RTPSender::onUpdateConfigParams(rtp_rtcp_config_t* pRTPNegotiatedParams
     mConfigParam.network_info.interface_type = (pRTPNegotiatedParams->network_info).interface_type;
     mConfigParam.network_info.MBR_UL = (pRTPNegotiatedParams->network_info).MBR_UL;
     mAdaInfo->setMBRUL(mConfigParam.network_info.MBR_UL);
+    mCongestionController->setMaxBitrate(getMaxBitrate());
+    // until the first adjustment the encoder runs up to the negotiated bitrate
+    mPacer.setTargetBitrate(getMaxBitrate());
 
     return OK;
 }
@@ -950,6 +1110,13 @@ status_t RTPSender::onStop() {
 
     /************reset some adaptation related params************/
     mAdaInfo->resetOnStop();
+    mCongestionController->reset();
+    mPacer.reset();
+
+    // release the accus held by the history
+    mSendHistory.clear();
+    ALOGI("%s,NACK resent %u packets, %" PRIu64 " bytes", __FUNCTION__, mResentCount,
+          mResentBytes);
 
     return OK;
 }
@@ -1106,7 +1273,7 @@ status_t RTPSender::queueSingleNALUnitPacket(const sp<ABuffer> accessUnit) {
           __FUNCTION__, mAccuReceived, size, timeUs, rtpTime, ccw_rotation, camera_facing, flip);
 
     // only single NAL in one RTP packet support
-    while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true /* startCodeFollows */) == OK) {
+    while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true /* startCodeFollows */) == OK) {
         // ToDo:
         // check NAL type
         // if net work is bad, we can drop NAL with low priority
@@ -1217,7 +1384,7 @@ status_t RTPSender::queueFUorSTAPPacket(const sp<ABuffer> accessUnit) {
     sp<AMessage> rtp_meta;
     size_t payload_size = 0;
 
-    while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true /* startCodeFollows */) == OK) {
+    while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true /* startCodeFollows */) == OK) {
         // ToDo:
         // check NAL type
         // if net work is bad, we can drop NAL with low priority
@@ -1462,7 +1629,7 @@ status_t RTPSender::queueFUorSTAPPacket_HEVC(const sp<ABuffer> accessUnit) {
     sp<AMessage> rtp_meta;
     size_t payload_size = 0;
 
-    while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true /* startCodeFollows */) == OK) {
+    while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true /* startCodeFollows */) == OK) {
         // ToDo:
         // check NAL type
         // if net work is bad, we can drop NAL with low priority
@@ -1711,7 +1878,8 @@ status_t RTPSender::queueFragmentNALUnitPacket(const sp<ABuffer> accessUnit, siz
     while (srcOffset < nalSize) {
         if (!out.get()) {
             // create next RTP packet
-            out = new ABuffer(mMTUSize);
+            // only the headers live in it if payload is not copied
+            out = new ABuffer(mZeroCopyTx ? kRTPHeaderBufferSize : mMTUSize);
             memset(out->data(), 0, out->size());
             out->setRange(0, 0);
 
@@ -1730,7 +1898,7 @@ status_t RTPSender::queueFragmentNALUnitPacket(const sp<ABuffer> accessUnit, siz
             outBytesUsed = out->size();
         }
 
-        size_t copy = out->capacity() - outBytesUsed - 2;
+        size_t copy = mMTUSize - outBytesUsed - 2;
 
         if (copy > nalSize - srcOffset) {
             copy = nalSize - srcOffset;
@@ -1753,11 +1921,20 @@ status_t RTPSender::queueFragmentNALUnitPacket(const sp<ABuffer> accessUnit, siz
             isEndFU = true;
         }
 
-        memcpy(&dst[2], nalStart + srcOffset, copy);
+        size_t header_copy = copy;
+
+        if (mZeroCopyTx) {
+            rtp_meta->setBuffer("payload", accessUnit);
+            rtp_meta->setSize("payload_offset", nalStart + srcOffset - accessUnit->data());
+            header_copy = 0;
+        } else {
+            memcpy(&dst[2], nalStart + srcOffset, copy);
+        }
+
         payload_size += copy;
         srcOffset += copy;
 
-        out->setRange(out->offset(), out->size() + copy + 2);
+        out->setRange(out->offset(), out->size() + header_copy + 2);
         ALOGV("FU-A(%zu),packet offset(%zu),size(%zu)", num_nal_FU_A, out->offset(), out->size());
         // revise offset to rtp header
         int32_t rtpOffset = 0;
@@ -1847,7 +2024,8 @@ status_t RTPSender::queueFragmentNALUnitPacket_HEVC(const sp<ABuffer> accessUnit
     while (srcOffset < nalSize) {
         if (!out.get()) {
             // create next RTP packet
-            out = new ABuffer(mMTUSize);
+            // only the headers live in it if payload is not copied
+            out = new ABuffer(mZeroCopyTx ? kRTPHeaderBufferSize : mMTUSize);
             memset(out->data(), 0, out->size());
             out->setRange(0, 0);
 
@@ -1866,7 +2044,7 @@ status_t RTPSender::queueFragmentNALUnitPacket_HEVC(const sp<ABuffer> accessUnit
             outBytesUsed = out->size();
         }
 
-        size_t copy = out->capacity() - outBytesUsed - 3;
+        size_t copy = mMTUSize - outBytesUsed - 3;
 
         if (copy > nalSize - srcOffset) {
             copy = nalSize - srcOffset;
@@ -1894,11 +2072,20 @@ status_t RTPSender::queueFragmentNALUnitPacket_HEVC(const sp<ABuffer> accessUnit
             isEndFU = true;
         }
 
-        memcpy(&dst[3], nalStart + srcOffset, copy);
+        size_t header_copy = copy;
+
+        if (mZeroCopyTx) {
+            rtp_meta->setBuffer("payload", accessUnit);
+            rtp_meta->setSize("payload_offset", nalStart + srcOffset - accessUnit->data());
+            header_copy = 0;
+        } else {
+            memcpy(&dst[3], nalStart + srcOffset, copy);
+        }
+
         payload_size += copy;
         srcOffset += copy;
 
-        out->setRange(out->offset(), out->size() + copy + 3);
+        out->setRange(out->offset(), out->size() + header_copy + 3);
         ALOGD("FU-A(%zu),packet offset(%zu),size(%zu)", num_nal_FU_A, out->offset(), out->size());
         // revise offset to rtp header
         int32_t rtpOffset = 0;
@@ -1963,6 +2150,81 @@ void RTPSender::postSendRTPMessage() {
     mSendRTPEventPending = true;
 }
 
+// whether the queued packets span more media time than the pacer may hold them
+bool RTPSender::isRTPQueueOverdue() {
+    if (mRTPPacketQueue.size() < 2) {
+        return false;
+    }
+
+    int64_t beginTimeUs = 0;
+    int64_t endTimeUs = 0;
+    ((*mRTPPacketQueue.begin())->meta())->findInt64("timeUs", &beginTimeUs);
+    ((*(--mRTPPacketQueue.end()))->meta())->findInt64("timeUs", &endTimeUs);
+
+    if (endTimeUs - beginTimeUs > RTPPacer::kMaxQueueDurationUs) {
+        ALOGW("%s,rtp queue size(%zu) duration(%" PRId64 " us),send without pacing", __FUNCTION__,
+              mRTPPacketQueue.size(), endTimeUs - beginTimeUs);
+        return true;
+    }
+
+    return false;
+}
+
+// gather at most maxCount packets at the head of mRTPPacketQueue into one sendmmsg
+// return the number of packets sent, or -errno if the first one failed
+int RTPSender::sendRTPPacketBatch(int maxCount) {
+    Sock_iopacket_t packets[SOCKETWRAPPER_TX_BATCH];
+    int count = 0;
+
+    if (maxCount > SOCKETWRAPPER_TX_BATCH) {
+        maxCount = SOCKETWRAPPER_TX_BATCH;
+    }
+
+    for (List<sp<ABuffer> >::iterator it = mRTPPacketQueue.begin();
+         it != mRTPPacketQueue.end() && count < maxCount; ++it, ++count) {
+        fillIoPacket(*it, &packets[count]);
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+
+    return mRTPSocketWrapper->writeSockBatch(packets, count);
+}
+
+// headers from rtpPacket, payload from the accu for zero copy FU packets
+void RTPSender::fillIoPacket(const sp<ABuffer>& rtpPacket, Sock_iopacket_t* packet) {
+    packet->iov[0].iov_base = rtpPacket->data();
+    packet->iov[0].iov_len = rtpPacket->size();
+    packet->iovcnt = 1;
+
+    sp<AMessage> rtp_meta = rtpPacket->meta();
+    sp<ABuffer> payload;
+
+    if (rtp_meta->findBuffer("payload", &payload)) {
+        size_t payload_offset = 0;
+        size_t payload_size = 0;
+        rtp_meta->findSize("payload_offset", &payload_offset);
+        rtp_meta->findSize("payload_size", &payload_size);
+
+        packet->iov[1].iov_base = payload->data() + payload_offset;
+        packet->iov[1].iov_len = payload_size;
+        packet->iovcnt = 2;
+    }
+}
+
+// headers + payload kept in the accu for zero copy FU packets
+size_t RTPSender::getRTPPacketSize(const sp<ABuffer>& rtpPacket) {
+    sp<AMessage> rtp_meta = rtpPacket->meta();
+    size_t payload_size = 0;
+
+    if (rtp_meta->contains("payload")) {
+        rtp_meta->findSize("payload_size", &payload_size);
+    }
+
+    return rtpPacket->size() + payload_size;
+}
+
 void RTPSender::queueRTPPacket(sp<ABuffer> rtpPacket) {
     ATRACE_CALL();
     // if(m_isFirstRTPPacket){
@@ -1998,7 +2260,8 @@ void RTPSender::queueRTPPacket(sp<ABuffer> rtpPacket) {
               mRTPPacketQueue.size(), frame_start, frame_boundary);
         uint32_t target = 0;
         uint32_t durationUs = requestRTPQueueDuration();
-        bool isAdjust = mAdaInfo->checkFallBack(&target, durationUs);
+        bool isAdjust =
+                mCongestionController->onQueueDelay(durationUs, ALooper::GetNowUs(), &target);
 
         if (isAdjust == true) {
             notifyAdjustEncBR(target);
@@ -2107,6 +2370,15 @@ status_t RTPSender::addRTPExtHeader(sp<ABuffer> rtpPacket) {
         header_byte_type = ONE_BYTE_HEADER;
     }
 
+    if (m_extmap_TWCC_supported > 0) {
+        if (rtp_ext_header_len == 0) {
+            rtp_ext_header_len += 4;  // extension header
+        }
+
+        rtp_ext_header_len += 3;  // extension element:transport wide seq
+        header_byte_type = ONE_BYTE_HEADER;
+    }
+
     // other extension element: such as gps
     /*
     size_t gps = 0;
@@ -2135,6 +2407,8 @@ status_t RTPSender::addRTPExtHeader(sp<ABuffer> rtpPacket) {
             dst[1] = 0XDE;
         }
 
+        size_t element_offset = 4;
+
         // ToDo:we know we support sendrecv for CVO
         // avoid peer set wrong direction capability, we will not filter cvo info as direction
         // if CVO not support by peer, it can just ignore this extension
@@ -2178,6 +2452,19 @@ status_t RTPSender::addRTPExtHeader(sp<ABuffer> rtpPacket) {
             cvo_element = cvo_element & 0x0F;  // set the first four bit to 0
 
             dst[5] = cvo_element;
+            element_offset += 2;
+        }
+
+        // transport wide seq of every packet, the peer reports their arrival time
+        if (m_extmap_TWCC_supported > 0) {
+            uint16_t transport_seq = mTransportSeqNum++;
+
+            dst[element_offset] = m_extmap_TWCC_id << 4 | 0x01;  // id =m_extmap_TWCC_id; L= 1
+            dst[element_offset + 1] = (transport_seq >> 8) & 0xff;
+            dst[element_offset + 2] = transport_seq & 0xff;
+            element_offset += 3;
+
+            meta->setInt32("transport_seq", transport_seq);
         }
 
         // if has other extension element
@@ -2221,6 +2508,12 @@ void RTPSender::onAddSenderInfo(const sp<ABuffer>& buffer) {
 
     mAdaInfo->addSenderInfo(data);
 
+    // peer echoes the middle 32 bits of our NTP timestamp as LSR
+    mSRNtpMid[mSRHistoryIndex] =
+            ((uint32_t)data[2] << 24) | (data[3] << 16) | (data[4] << 8) | data[5];
+    mSRSentTimeUs[mSRHistoryIndex] = ALooper::GetNowUs();
+    mSRHistoryIndex = (mSRHistoryIndex + 1) % kSRHistorySize;
+
     buffer->setRange(buffer->offset(), buffer->size() + 20);
 
     return;
@@ -2251,10 +2544,12 @@ status_t RTPSender::onProcessReportBlock(const sp<ABuffer>& packet) {
         sigInfo.canExpand = ifRiseBitrateBaseSignal(&sigInfo.ratio);
     }
 
+    mLastRTTUs = calculateRoundTripTime(data);
+
     uint32_t target = 0;
     bool needForceI = false;
-    mAdaInfo->processReportBlock(data, contain_TMMBR, sigInfo, &target, &needForceI);
-    if (target != 0 && sigInfo.canExpand == true) {
+    if (mCongestionController->onReportBlock(data, contain_TMMBR, mLastRTTUs, sigInfo,
+                                             ALooper::GetNowUs(), &target, &needForceI)) {
         notifyAdjustEncBR(target);
         mLastReduceSignal = ImsSignal::Signal_STRENGTH_NONE_OR_UNKNOWN;
     }
@@ -2268,6 +2563,32 @@ status_t RTPSender::onProcessReportBlock(const sp<ABuffer>& packet) {
     return OK;
 }
 
+// RFC 3550 6.4.1: RTT = arrival time of the report block - LSR - DLSR,
+// use the local time the SR was sent instead of converting arrival time to NTP
+int64_t RTPSender::calculateRoundTripTime(const uint8_t* reportBlock) {
+    uint32_t lsr = ((uint32_t)reportBlock[12] << 24) | (reportBlock[13] << 16) |
+                   (reportBlock[14] << 8) | reportBlock[15];
+    uint32_t dlsr = ((uint32_t)reportBlock[16] << 24) | (reportBlock[17] << 16) |
+                    (reportBlock[18] << 8) | reportBlock[19];
+
+    if (lsr == 0) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < kSRHistorySize; i++) {
+        if (mSRSentTimeUs[i] == 0 || mSRNtpMid[i] != lsr) {
+            continue;
+        }
+
+        // DLSR is in unit of 1/65536 s
+        int64_t rttUs = ALooper::GetNowUs() - mSRSentTimeUs[i] - ((int64_t)dlsr * 1000000ll >> 16);
+        ALOGD("%s,rtt=%" PRId64 " us(dlsr=%u)", __FUNCTION__, rttUs, dlsr);
+        return rttUs > 0 ? rttUs : 0;
+    }
+
+    return -1;
+}
+
 void RTPSender::onProcessFIR(uint8_t seqNum) {
     ALOGI("%s +", __FUNCTION__);
 
@@ -2296,6 +2617,11 @@ void RTPSender::onProcessGenericNACK(const sp<ABuffer> nack_fcis) {
         return;
     }
 
+    // resend the lost packets from history, intra refresh only for the ones aged out
+    if (mSendHistory.getWindowUs() > 0 && resendNACKedPackets(nack_fcis)) {
+        return;
+    }
+
     if (mAdaInfo->processGenericNACK(nack_fcis->data(), nack_fcis->size()) == true) {
         sp<AMessage> refreshPointNotify = mNotify->dup();
         refreshPointNotify->setInt32("what", kWhatForceIntraPicture);
@@ -2305,6 +2631,72 @@ void RTPSender::onProcessGenericNACK(const sp<ABuffer> nack_fcis) {
     return;
 }
 
+// RFC 4585 6.2.1: each FCI is PID(16 bits) + BLP(16 bits)
+// return true if all the lost packets are resent or resent recently
+bool RTPSender::resendNACKedPackets(const sp<ABuffer>& nack_fcis) {
+    const uint8_t* data = nack_fcis->data();
+    size_t size = nack_fcis->size();
+    int64_t nowUs = ALooper::GetNowUs();
+    int32_t resent = 0;
+    int32_t skipped = 0;
+    int32_t missed = 0;
+
+    for (size_t offset = 0; offset + 4 <= size; offset += 4) {
+        uint16_t pid = (data[offset] << 8) | data[offset + 1];
+        uint16_t blp = (data[offset + 2] << 8) | data[offset + 3];
+
+        for (int32_t i = -1; i < 16; i++) {
+            if (i >= 0 && !(blp & (1 << i))) {
+                continue;
+            }
+
+            uint16_t seqNum = pid + (i + 1);
+            sp<ABuffer> rtpPacket;
+            RTPSendHistory::LookupResult result =
+                    mSendHistory.lookup(seqNum, nowUs, &rtpPacket);
+
+            if (result == RTPSendHistory::RESENT_RECENTLY) {
+                skipped++;
+            } else if (result == RTPSendHistory::NOT_FOUND) {
+                missed++;
+            } else if (resendRTPPacket(rtpPacket) > 0) {
+                resent++;
+                mResentCount++;
+                mResentBytes += getRTPPacketSize(rtpPacket);
+            } else {
+                missed++;
+            }
+        }
+    }
+
+    ALOGI("%s,resent %d,skipped %d,missed %d", __FUNCTION__, resent, skipped, missed);
+    return missed == 0;
+}
+
+// retransmission with the same SSRC and seqNum, receiver drops it if duplicated
+int RTPSender::resendRTPPacket(const sp<ABuffer>& rtpPacket) {
+    Sock_iopacket_t packet;
+    int write_size = 0;
+
+    fillIoPacket(rtpPacket, &packet);
+
+    if (packet.iovcnt == 1) {
+        write_size = mRTPSocketWrapper->writeSock(rtpPacket);
+    } else {
+        write_size = mRTPSocketWrapper->writeSockBatch(&packet, 1);
+    }
+
+    if (write_size < 0) {
+        ALOGW("%s,seqNum(%d) write fail err(%d)", __FUNCTION__, rtpPacket->int32Data() & 0xffff,
+              write_size);
+    } else {
+        // sent ahead of the queue, but still takes its share of the pacing rate
+        mPacer.onPacketSent(write_size);
+    }
+
+    return write_size;
+}
+
 void RTPSender::onProcessTMMBR(const sp<ABuffer> tmmbr_fci) {
     ALOGV("%s +", __FUNCTION__);
 
@@ -2341,7 +2733,8 @@ void RTPSender::onProcessTMMBR(const sp<ABuffer> tmmbr_fci) {
         sigInfo.canExpand = ifRiseBitrateBaseSignal(&sigInfo.ratio);
     }
 
-    bool isAdjust = mAdaInfo->processTMMBR(tmmbr_fci->data(), &target, durationUs, sigInfo);
+    bool isAdjust = mCongestionController->onTMMBR(tmmbr_fci->data(), durationUs, sigInfo,
+                                                   ALooper::GetNowUs(), &target);
 
     if (isAdjust == true) {
         notifyAdjustEncBR(target);
@@ -2380,7 +2773,7 @@ void RTPSender::updateStatisticInfo(sp<ABuffer> rtpPacket) {
     size_t payload_size = 0;
     rtp_meta->findSize("payload_size", &payload_size);
 
-    mAdaInfo->updateStatisticInfo(timeUs, payload_size, rtpPacket->size());
+    mAdaInfo->updateStatisticInfo(timeUs, payload_size, getRTPPacketSize(rtpPacket));
 
     return;
 }
@@ -2396,12 +2789,39 @@ void RTPSender::updateEncBitRate(const sp<ABuffer> accessUnit) {
     return;
 }
 
+void RTPSender::onProcessTransportFeedback(const sp<ABuffer> fb_fci) {
+    if (!mStarted) {
+        return;
+    }
+
+    Vector<RTPCongestionController::PacketFeedback> feedbacks;
+
+    if (!RTPTransportFeedback::parseFCI(fb_fci->data(), fb_fci->size(), &feedbacks) ||
+        feedbacks.isEmpty()) {
+        return;
+    }
+
+    uint32_t target = 0;
+    bool isAdjust = mCongestionController->onPacketFeedback(
+            feedbacks.array(), feedbacks.size(), ALooper::GetNowUs(), &target);
+
+    ALOGV("%s,%zu packets from transport seq(%u),adjust(%d) target(%u)", __FUNCTION__,
+          feedbacks.size(), feedbacks[0].mSeqNum, isAdjust, target);
+
+    if (isAdjust == true) {
+        notifyAdjustEncBR(target);
+    }
+}
+
 void RTPSender::notifyAdjustEncBR(uint32_t uiNewBR) {
     if (!mStarted) {
         ALOGW("%s,Not Started!", __FUNCTION__);
         return;
     }
 
+    // pace at the new rate right away, the encoder follows within a frame or two
+    mPacer.setTargetBitrate(uiNewBR);
+
     sp<AMessage> notify = mNotify->dup();
     notify->setInt32("what", kWhatAdjustEncBitRate);
     notify->setInt32("netBitRate", uiNewBR);
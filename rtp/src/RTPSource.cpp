@@ -67,6 +67,9 @@ RTPSource::RTPSource(uint32_t srcId, rtp_rtcp_config_t* pConfigPram, int32_t iTr
     }
 
     mClockRate = pConfigPram->sample_rate;
+    mJitterEstimator.setClockRate(mClockRate);
+    mReleaseStarted = false;
+    mLastGapUs = -1;
     // mRRintervalUs = 5000000l;
     // ToDo:need set mRRintervalUs according pConfigParam
 
@@ -95,9 +98,24 @@ RTPSource::RTPSource(uint32_t srcId, rtp_rtcp_config_t* pConfigPram, int32_t iTr
 
     ALOGD("%s,mAS =%d kbps,mMBR_DL=%d kbps,mSupportTMMBR=%d", __FUNCTION__,
           pConfigPram->rtp_packet_bandwidth, pConfigPram->network_info.MBR_DL, mSupportTMMBR);
+
+    // a NACKed packet is waited until the jitter buffer depth, which covers one
+    // retransmission up to this delay, then left to PLI
+    char nack_deadline_param[PROPERTY_VALUE_MAX];
+    memset(nack_deadline_param, 0, sizeof(nack_deadline_param));
+    snprintf(nack_deadline_param, sizeof(nack_deadline_param), "%d",
+             kDefaultMaxRetransmissionDelayMs);
+    property_get("vendor.vt.imsma.rtp_nack_deadline_ms", nack_deadline_param, nack_deadline_param);
+    int32_t nack_deadline_ms = atoi(nack_deadline_param);
+    mMaxRetransmissionDelayUs = nack_deadline_ms > 0 ? nack_deadline_ms * 1000ll : 0;
+    mNackTracker.setDeadlineUs(mJitterEstimator.getTargetDelayUs());
+
+    updateGenericNACKSupport(pConfigPram);
 }
 RTPSource::~RTPSource() {
-    ALOGI("%s", __FUNCTION__);
+    ALOGI("%s,nack requested %u, recovered %u, given up %u", __FUNCTION__,
+          mNackTracker.getRequestedCount(), mNackTracker.getRecoveredCount(),
+          mNackTracker.getGivenUpCount());
 
     delete mAdaInfo;
 }
@@ -105,10 +123,10 @@ static uint32_t AbsDiff(uint32_t seq1, uint32_t seq2) {
     return seq1 > seq2 ? seq1 - seq2 : seq2 - seq1;
 }
 
-void RTPSource::processRTPPacket(const sp<ABuffer>& buffer) {
+void RTPSource::processRTPPacket(const sp<ABuffer>& buffer, RTPPacketInfo* info) {
     ALOGV("%s", __FUNCTION__);
 
-    if (queuePacket(buffer) && mAssembler != NULL) {
+    if (queuePacket(buffer, info) && mAssembler != NULL) {
         mAssembler->onPacketReceived(this);
     }
 }
@@ -134,6 +152,13 @@ bool RTPSource::GetdebugInfo(bool needNotify, int32_t* uiEncBitRate, uint32_t Op
     bool isTrigger = false;
     uint32_t lostcount = getLostCount();
     uint32_t IDamageCount = getIDamageCount();
+
+    ATRACE_INT64("RTR:Src:jbDepthUs", getJitterBufferDepthUs());
+    ATRACE_INT("RTR:Src:lateLoss", getLateLossPermille());
+    ALOGV("%s,jitter buffer depth %" PRId64 " us(jitter %" PRId64 " us), late loss %u/1000",
+          __FUNCTION__, getJitterBufferDepthUs(), mJitterEstimator.getJitterUs(),
+          getLateLossPermille());
+
     bool ret = mAdaInfo->GetdebugInfo(needNotify, uiEncBitRate, lostcount, IDamageCount, NotifyInfo,
                                       &count, &isTrigger, Operator);
 
@@ -187,14 +212,15 @@ bool RTPSource::GetdebugInfo(bool needNotify, int32_t* uiEncBitRate, uint32_t Op
     return ret;
 }
 
-bool RTPSource::queuePacket(const sp<ABuffer>& buffer) {
+bool RTPSource::queuePacket(const sp<ABuffer>& buffer, RTPPacketInfo* info) {
     uint32_t orig_seqNum = (uint32_t)buffer->int32Data();
 
-    updateStatisticInfo(buffer);
+    updateStatisticInfo(buffer, info);
     mAdaInfo->setReceivePacketFlag();
 
     if (mAdaInfo->getFrameCount() == 0) {
         mFirstPacketRecvTimeUs = ALooper::GetNowUs();
+        mReleaseStarted = false;
 
         if (!mHighestSeqNumberSet) {
             mHighestSeqNumber = orig_seqNum;
@@ -203,7 +229,7 @@ bool RTPSource::queuePacket(const sp<ABuffer>& buffer) {
         mFirstPacketSeqNum = orig_seqNum;
 
         mAdaInfo->selfIncFrameCount();
-        mQueue.push_back(buffer);
+        mQueue.insert(buffer, *info);
         ALOGI("%s,first recv packet seqNum:%u", __FUNCTION__, orig_seqNum);
         return false;
     }
@@ -211,6 +237,17 @@ bool RTPSource::queuePacket(const sp<ABuffer>& buffer) {
     mAdaInfo->selfIncFrameCount();
 
     uint32_t seqNum = extendSeqNumber(orig_seqNum, mHighestSeqNumber);
+    int64_t iPacketRecvTimeUs = ALooper::GetNowUs();
+
+    if ((int32_t)(seqNum - mHighestSeqNumber) > 1) {
+        mLastGapUs = iPacketRecvTimeUs;
+    }
+
+    updatePlayoutTarget(iPacketRecvTimeUs);
+
+    if (mSupportGenericNACK) {
+        mNackTracker.onPacketReceived(seqNum, mHighestSeqNumber, iPacketRecvTimeUs);
+    }
 
     if (seqNum > mHighestSeqNumber) {
         mHighestSeqNumber = seqNum;
@@ -220,57 +257,46 @@ bool RTPSource::queuePacket(const sp<ABuffer>& buffer) {
 
     ATRACE_INT64("RTR:Src:queExtSeqN", (int64_t)seqNum);
 
-    List<sp<ABuffer> >::iterator it = mQueue.begin();
+    RTPReorderQueue::InsertResult result = mQueue.insert(buffer, *info);
 
-    while (it != mQueue.end() && (uint32_t)(*it)->int32Data() < seqNum) {
-        ++it;
-    }
-
-    if (it != mQueue.end() && (uint32_t)(*it)->int32Data() == seqNum) {
+    if (result == RTPReorderQueue::DUPLICATE) {
         ALOGW("Discarding duplicate buffer");
         return false;
+    } else if (result == RTPReorderQueue::TOO_OLD) {
+        ALOGW("Discarding too late buffer(seqNum:%u)", seqNum);
+        mJitterEstimator.onLatePacket();
+        return false;
     }
 
-    mQueue.insert(it, buffer);
     /*ALOGD("%s,SeqNum(orig:%d,extended:%d),jitter buf size(%d)",\
         __FUNCTION__,orig_seqNum,seqNum,mQueue.size());*/
 
-    // ToDo:
-    // wait for 50ms for the right first seqNum
-    // need tune on real network to adjust this timeout value
-    // or change to mNumBuffersReceived < threshold
-    int64_t iPacketRecvTimeUs = ALooper::GetNowUs();
-
-    if ((iPacketRecvTimeUs - mFirstPacketRecvTimeUs) < 50000) {
+    // wait for the right first seqNum as long as the jitter buffer depth,
+    // poll() releases the packets if no more packet comes
+    if (!mReleaseStarted) {
         if (seqNum < mFirstPacketSeqNum) {
             mFirstPacketSeqNum = seqNum;
         }
 
-        ALOGD("waiting(%" PRId64 " us) for the least seq:%ud",
-              iPacketRecvTimeUs - mFirstPacketRecvTimeUs, mFirstPacketSeqNum);
-        return false;
+        if ((iPacketRecvTimeUs - mFirstPacketRecvTimeUs) < getReorderWaitUs()) {
+            ALOGD("waiting(%" PRId64 " us) for the least seq:%ud",
+                  iPacketRecvTimeUs - mFirstPacketRecvTimeUs, mFirstPacketSeqNum);
+            return false;
+        }
+
+        mReleaseStarted = true;
     }
 
     return true;
 }
 
-void RTPSource::updateStatisticInfo(const sp<ABuffer> buffer) {
-    sp<AMessage> meta = buffer->meta();
-
-    int32_t iRtpTime = 0;
-    meta->findInt32("rtp-time", &iRtpTime);
-
-    calculateArrivalJitter(buffer);
-
-    int32_t iRtpOH = 0;
-    int32_t iRtpSize = 0;
-    meta->findInt32("rtp_size", &iRtpSize);
-    meta->findInt32("rtp_overhead", &iRtpOH);
+void RTPSource::updateStatisticInfo(const sp<ABuffer> buffer, RTPPacketInfo* info) {
+    calculateArrivalJitter(info);
 
     uint32_t lostcount = getLostCount();
     uint32_t uiNetSize = buffer->size();
-    bool isTrigger =
-            mAdaInfo->updateStatisticInfo(iRtpOH, iRtpSize, uiNetSize, lostcount, iRtpTime);
+    bool isTrigger = mAdaInfo->updateStatisticInfo(info->mRtpOverhead, info->mRtpSize, uiNetSize,
+                                                   lostcount, (int32_t)info->mRtpTime);
 
     if (isTrigger == true) {
         NotifyTMMBR();
@@ -370,18 +396,17 @@ status_t RTPSource::addReceiverReportBlock(const sp<ABuffer>& buffer) {
 }
 
 // ToDo: wrong value will happen if rtptime overflow
-void RTPSource::calculateArrivalJitter(const sp<ABuffer>& buffer) {
+void RTPSource::calculateArrivalJitter(RTPPacketInfo* info) {
     // calculate interarrival jitter
     int32_t iArrivalJitter = 0;
 
-    uint32_t uiRtpTimeStamp = 0;
-    sp<AMessage> meta_pack = buffer->meta();
-    CHECK(meta_pack->findInt32("rtp-time", (int32_t*)&uiRtpTimeStamp));
+    uint32_t uiRtpTimeStamp = info->mRtpTime;
 
     int64_t iPacketRecvTimeUs = ALooper::GetNowUs();
-    meta_pack->setInt64("recv-time", iPacketRecvTimeUs);
+    info->mRecvTimeUs = iPacketRecvTimeUs;
 
     mAdaInfo->calculateArrivalJitter(uiRtpTimeStamp, iPacketRecvTimeUs, mClockRate);
+    mJitterEstimator.onPacketArrived(uiRtpTimeStamp, iPacketRecvTimeUs);
 
     return;
 }
@@ -435,6 +460,7 @@ void ARTPSource::updateExpectedTimeoutUs(const int64_t& duration)
 
 void RTPSource::flushQueue() {
     mQueue.clear();
+    mNackTracker.clear();
 
     if (mAssembler != NULL) {
         mAssembler->flushQueue();
@@ -445,6 +471,10 @@ void RTPSource::start() {
 
     mHighestSeqNumberSet = false;
 
+    mJitterEstimator.reset();
+    mReleaseStarted = false;
+    mLastGapUs = -1;
+
     flushQueue();
 
     if (mAssembler != NULL) {
@@ -515,6 +545,7 @@ void RTPSource::processTMMBN(sp<ABuffer> tmmbn_fci) {
 void RTPSource::updateConfigParams(rtp_rtcp_config_t* pConfigPram) {
     ALOGD("%s", __FUNCTION__);
     mClockRate = pConfigPram->sample_rate;
+    mJitterEstimator.setClockRate(mClockRate);
 
     mSupportTMMBR = false;
 
@@ -537,6 +568,122 @@ void RTPSource::updateConfigParams(rtp_rtcp_config_t* pConfigPram) {
     }
 
     ALOGD("%s,mSupportTMMBR=%d", __FUNCTION__, mSupportTMMBR);
+
+    updateGenericNACKSupport(pConfigPram);
+}
+
+void RTPSource::updateGenericNACKSupport(rtp_rtcp_config_t* pConfigPram) {
+    mSupportGenericNACK = false;
+
+    // "a=rtcp-fb:xx nack" without param is Generic NACK too
+    for (uint8_t i = 0; i < pConfigPram->rtcp_fb_param_num; i++) {
+        uint16_t fb_id = (pConfigPram->rtcp_fb_type[i]).rtcp_fb_id;
+        uint16_t fb_param = (pConfigPram->rtcp_fb_type[i]).rtcp_fb_param;
+
+        if ((fb_id == IMSMA_NACK) &&
+            ((fb_param == IMSMA_GENERIC_NACK) || (fb_param == IMSMA_NONE))) {
+            mSupportGenericNACK = true;
+            break;
+        }
+    }
+
+    if (mAssembler == NULL || mMaxRetransmissionDelayUs == 0) {
+        mSupportGenericNACK = false;
+    }
+
+    if (!mSupportGenericNACK) {
+        mNackTracker.clear();
+    }
+
+    ALOGD("%s,mSupportGenericNACK=%d,max retransmission delay=%" PRId64 " us", __FUNCTION__,
+          mSupportGenericNACK, mMaxRetransmissionDelayUs);
+}
+
+void RTPSource::updatePlayoutTarget(int64_t nowUs) {
+    int64_t retransmitUs = 0;
+
+    // keep the depth low on clean links, cover one NACK round trip once losses show up
+    if (mSupportGenericNACK && mLastGapUs >= 0 && nowUs - mLastGapUs < kLossMemoryUs) {
+        retransmitUs = mNackTracker.getRTTUs() * 5 / 4 + RTPNackTracker::kReorderHoldUs;
+
+        if (retransmitUs > mMaxRetransmissionDelayUs) {
+            retransmitUs = mMaxRetransmissionDelayUs;
+        }
+    }
+
+    mJitterEstimator.setRetransmissionDelayUs(retransmitUs);
+    mNackTracker.setDeadlineUs(mJitterEstimator.getTargetDelayUs());
+}
+
+// time the held packets should be released, -1 if nothing is waiting
+int64_t RTPSource::getReleaseTimeUs() {
+    if (!mReleaseStarted) {
+        return mQueue.empty() ? -1 : mFirstPacketRecvTimeUs + getReorderWaitUs();
+    }
+
+    if (mAssembler == NULL || isRetransmissionPending()) {
+        return -1;
+    }
+
+    int64_t failureTimeUs = mAssembler->getFirstFailureTimeUs();
+
+    // RTPAssembler skips the missing packet when waited longer than the depth
+    return failureTimeUs < 0 ? -1 : failureTimeUs + getReorderWaitUs() + 1;
+}
+
+sp<ABuffer> RTPSource::poll(int64_t* nextCheckUs) {
+    *nextCheckUs = -1;
+
+    int64_t nowUs = ALooper::GetNowUs();
+    int64_t releaseUs = getReleaseTimeUs();
+    bool release = releaseUs >= 0 && releaseUs <= nowUs;
+
+    if (release && !mReleaseStarted) {
+        ALOGD("%s,no more packet in %" PRId64 " us, start from seq:%u", __FUNCTION__,
+              getReorderWaitUs(), mFirstPacketSeqNum);
+        mReleaseStarted = true;
+    }
+
+    // the assembler is waiting for the given up packets, let it skip them now
+    if (mSupportGenericNACK && mNackTracker.removeExpired(nowUs) > 0) {
+        release = true;
+    }
+
+    if (release && mAssembler != NULL) {
+        mAssembler->onPacketReceived(this);
+    }
+
+    sp<ABuffer> nack_fci;
+    int64_t eventUs = -1;
+
+    if (mSupportGenericNACK) {
+        nack_fci = mNackTracker.buildFCIs(nowUs);
+        eventUs = mNackTracker.nextEventUs();
+    }
+
+    releaseUs = getReleaseTimeUs();
+
+    if (releaseUs >= 0 && (eventUs < 0 || releaseUs < eventUs)) {
+        eventUs = releaseUs;
+    }
+
+    if (eventUs >= 0) {
+        *nextCheckUs = eventUs > nowUs ? eventUs - nowUs : 0;
+    }
+
+    return nack_fci;
+}
+
+bool RTPSource::isRetransmissionPending() {
+    if (!mSupportGenericNACK || mQueue.empty()) {
+        return false;
+    }
+
+    return mNackTracker.isPendingBefore((uint32_t)mQueue.front()->int32Data(), ALooper::GetNowUs());
+}
+
+void RTPSource::updateRoundTripTime(int64_t rttUs) {
+    mNackTracker.setRTTUs(rttUs);
 }
 
 const sp<ABuffer> RTPSource::getNewTMMBRInfo() {
@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//#define LOG_NDEBUG 0
+#define LOG_TAG "[VT][RTP]RTPTransportFeedback"
+#include <utils/Log.h>
+
+#include "RTPTransportFeedback.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+namespace imsma {
+
+const char* const RTPTransportFeedback::kExtensionURI =
+        "http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01";
+
+static const int64_t kReferenceTimeUnitUs = 64000ll;
+static const int64_t kDeltaUnitUs = 250ll;
+static const uint32_t kMaxRunLength = 0x1fff;
+
+RTPTransportFeedback::RTPTransportFeedback() {
+    mArrivalTimeUs = new int64_t[kHistorySize];
+    reset();
+}
+
+RTPTransportFeedback::~RTPTransportFeedback() {
+    delete[] mArrivalTimeUs;
+}
+
+// static
+uint8_t RTPTransportFeedback::getExtensionId(const rtp_rtcp_config_t* config) {
+    for (uint32_t j = 0; j < config->rtp_header_extension_num; j++) {
+        if (!strcmp(kExtensionURI, config->rtp_ext_map[j].extension_uri)) {
+            return config->rtp_ext_map[j].extension_id;
+        }
+    }
+
+    return 0;
+}
+
+void RTPTransportFeedback::reset() {
+    for (uint32_t i = 0; i < kHistorySize; i++) {
+        mArrivalTimeUs[i] = -1;
+    }
+
+    mStarted = false;
+    mNextSeq = 0;
+    mHighestSeq = 0;
+    mLastReferenceTime = 0;
+    mFeedbackCount = 0;
+}
+
+int64_t RTPTransportFeedback::extendSeq(uint16_t seq) const {
+    return mHighestSeq + (int16_t)(seq - (uint16_t)mHighestSeq);
+}
+
+void RTPTransportFeedback::onPacketArrived(uint16_t transportSeq, int64_t arrivalTimeUs) {
+    if (!mStarted) {
+        mStarted = true;
+        mNextSeq = transportSeq;
+        mHighestSeq = transportSeq;
+    }
+
+    int64_t seq = extendSeq(transportSeq);
+
+    // already reported, as lost
+    if (seq < mNextSeq) {
+        return;
+    }
+
+    if (seq > mHighestSeq) {
+        int64_t first = mHighestSeq + 1;
+
+        if (seq - first >= kHistorySize) {
+            first = seq - kHistorySize + 1;
+        }
+
+        for (int64_t s = first; s < seq; s++) {
+            mArrivalTimeUs[s & (kHistorySize - 1)] = -1;
+        }
+
+        mHighestSeq = seq;
+
+        // the receiver side feedback timer is late, report the recent ones only
+        if (mHighestSeq - mNextSeq >= kHistorySize) {
+            ALOGW("%s,skip %" PRId64 " packets not reported", __FUNCTION__,
+                  mHighestSeq - kHistorySize + 1 - mNextSeq);
+            mNextSeq = mHighestSeq - kHistorySize + 1;
+        }
+    }
+
+    mArrivalTimeUs[seq & (kHistorySize - 1)] = arrivalTimeUs;
+}
+
+sp<ABuffer> RTPTransportFeedback::buildFCI() {
+    if (!mStarted || mNextSeq > mHighestSeq) {
+        return NULL;
+    }
+
+    uint32_t count = mHighestSeq - mNextSeq + 1;
+
+    if (count > kMaxStatusCount) {
+        count = kMaxStatusCount;
+    }
+
+    // reference time from the first packet received in this FCI
+    int64_t referenceTime = mLastReferenceTime;
+
+    for (uint32_t i = 0; i < count; i++) {
+        int64_t arrivalUs = mArrivalTimeUs[(mNextSeq + i) & (kHistorySize - 1)];
+
+        if (arrivalUs >= 0) {
+            referenceTime = arrivalUs / kReferenceTimeUnitUs;
+            break;
+        }
+    }
+
+    mLastReferenceTime = referenceTime;
+
+    uint8_t status[kMaxStatusCount];
+    int16_t deltas[kMaxStatusCount];
+    int64_t prevUs = referenceTime * kReferenceTimeUnitUs;
+
+    for (uint32_t i = 0; i < count; i++) {
+        int64_t arrivalUs = mArrivalTimeUs[(mNextSeq + i) & (kHistorySize - 1)];
+        status[i] = kStatusNotReceived;
+
+        if (arrivalUs < 0) {
+            continue;
+        }
+
+        int64_t diffUs = arrivalUs - prevUs;
+        // round to the nearest 250us
+        int64_t ticks = (diffUs >= 0 ? diffUs + kDeltaUnitUs / 2 : diffUs - kDeltaUnitUs / 2) /
+                        kDeltaUnitUs;
+
+        if (ticks >= 0 && ticks <= 0xff) {
+            status[i] = kStatusSmallDelta;
+        } else if (ticks >= INT16_MIN && ticks <= INT16_MAX) {
+            status[i] = kStatusLargeDelta;
+        } else {
+            // too far from the previous one to be expressed, report as lost
+            continue;
+        }
+
+        deltas[i] = ticks;
+        // accumulate the rounded value, so the rounding error does not drift
+        prevUs += ticks * kDeltaUnitUs;
+    }
+
+    // header 8 + at most 2 bytes chunk per 7 packets + at most 2 bytes delta per packet
+    sp<ABuffer> fci = new ABuffer(8 + (count + 6) / 7 * 2 + count * 2);
+    uint8_t* data = fci->data();
+
+    uint16_t baseSeq = (uint16_t)mNextSeq;
+    data[0] = baseSeq >> 8;
+    data[1] = baseSeq & 0xff;
+    data[2] = count >> 8;
+    data[3] = count & 0xff;
+    data[4] = (referenceTime >> 16) & 0xff;
+    data[5] = (referenceTime >> 8) & 0xff;
+    data[6] = referenceTime & 0xff;
+    data[7] = mFeedbackCount++;
+
+    size_t offset = 8;
+    uint32_t i = 0;
+
+    while (i < count) {
+        uint32_t run = 1;
+
+        while (i + run < count && status[i + run] == status[i] && run < kMaxRunLength) {
+            run++;
+        }
+
+        uint16_t chunk = 0;
+
+        if (run >= 14) {
+            // run length chunk: 0 | status(2) | run length(13)
+            chunk = (status[i] << 13) | run;
+            i += run;
+        } else {
+            bool oneBit = true;
+
+            for (uint32_t j = i; j < i + 14 && j < count; j++) {
+                if (status[j] == kStatusLargeDelta) {
+                    oneBit = false;
+                    break;
+                }
+            }
+
+            if (oneBit) {
+                // status vector chunk of 14 1-bit symbols: 1 | 0 | symbols(14)
+                chunk = 0x8000;
+
+                for (uint32_t j = 0; j < 14 && i + j < count; j++) {
+                    chunk |= status[i + j] << (13 - j);
+                }
+
+                i += 14;
+            } else {
+                // status vector chunk of 7 2-bit symbols: 1 | 1 | symbols(14)
+                chunk = 0xc000;
+
+                for (uint32_t j = 0; j < 7 && i + j < count; j++) {
+                    chunk |= status[i + j] << (12 - 2 * j);
+                }
+
+                i += 7;
+            }
+        }
+
+        data[offset++] = chunk >> 8;
+        data[offset++] = chunk & 0xff;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (status[i] == kStatusSmallDelta) {
+            data[offset++] = (uint8_t)deltas[i];
+        } else if (status[i] == kStatusLargeDelta) {
+            data[offset++] = ((uint16_t)deltas[i]) >> 8;
+            data[offset++] = ((uint16_t)deltas[i]) & 0xff;
+        }
+    }
+
+    fci->setRange(0, offset);
+    mNextSeq += count;
+
+    ALOGV("%s,base seq %u, %u packets, %zu bytes", __FUNCTION__, baseSeq, count, offset);
+
+    return fci;
+}
+
+// static
+bool RTPTransportFeedback::parseFCI(const uint8_t* data, size_t size,
+                                    Vector<RTPCongestionController::PacketFeedback>* feedbacks) {
+    if (size < 8) {
+        ALOGE("%s,fci too short(%zu)", __FUNCTION__, size);
+        return false;
+    }
+
+    uint16_t baseSeq = (data[0] << 8) | data[1];
+    uint32_t count = (data[2] << 8) | data[3];
+    int64_t referenceTime = (data[4] << 16) | (data[5] << 8) | data[6];
+
+    uint8_t status[kMaxRunLength + 1];
+    uint32_t statusCount = 0;
+    size_t offset = 8;
+
+    if (count > kMaxRunLength + 1) {
+        ALOGE("%s,too many packets(%u)", __FUNCTION__, count);
+        return false;
+    }
+
+    while (statusCount < count) {
+        if (offset + 2 > size) {
+            ALOGE("%s,chunks truncated", __FUNCTION__);
+            return false;
+        }
+
+        uint16_t chunk = (data[offset] << 8) | data[offset + 1];
+        offset += 2;
+
+        if ((chunk & 0x8000) == 0) {
+            uint8_t symbol = (chunk >> 13) & 0x03;
+            uint32_t run = chunk & kMaxRunLength;
+
+            for (uint32_t j = 0; j < run && statusCount < count; j++) {
+                status[statusCount++] = symbol;
+            }
+        } else if ((chunk & 0x4000) == 0) {
+            for (uint32_t j = 0; j < 14 && statusCount < count; j++) {
+                status[statusCount++] = (chunk >> (13 - j)) & 0x01;
+            }
+        } else {
+            for (uint32_t j = 0; j < 7 && statusCount < count; j++) {
+                status[statusCount++] = (chunk >> (12 - 2 * j)) & 0x03;
+            }
+        }
+    }
+
+    int64_t arrivalUs = referenceTime * kReferenceTimeUnitUs;
+
+    for (uint32_t i = 0; i < count; i++) {
+        RTPCongestionController::PacketFeedback feedback;
+        feedback.mSeqNum = baseSeq + i;
+        feedback.mArrivalTimeUs = -1;
+
+        if (status[i] == kStatusSmallDelta) {
+            if (offset + 1 > size) {
+                ALOGE("%s,deltas truncated", __FUNCTION__);
+                return false;
+            }
+
+            arrivalUs += data[offset] * kDeltaUnitUs;
+            offset += 1;
+            feedback.mArrivalTimeUs = arrivalUs;
+        } else if (status[i] == kStatusLargeDelta) {
+            if (offset + 2 > size) {
+                ALOGE("%s,deltas truncated", __FUNCTION__);
+                return false;
+            }
+
+            arrivalUs += (int16_t)((data[offset] << 8) | data[offset + 1]) * kDeltaUnitUs;
+            offset += 2;
+            feedback.mArrivalTimeUs = arrivalUs >= 0 ? arrivalUs : -1;
+        } else if (status[i] != kStatusNotReceived) {
+            ALOGE("%s,reserved status", __FUNCTION__);
+            return false;
+        }
+
+        feedbacks->push(feedback);
+    }
+
+    return true;
+}
+
+}  // namespace imsma
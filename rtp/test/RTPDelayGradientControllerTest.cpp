@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+
+#include "RTPDelayGradientController.h"
+
+namespace imsma {
+
+static const uint32_t kMaxBitrate = 2000000;
+static const int64_t kFrameIntervalUs = 33333;
+static const uint32_t kPacketSize = 1200;
+static const int64_t kOneWayDelayUs = 40000;
+// transport feedback interval of the receiver
+static const int64_t kFeedbackIntervalUs = 100000;
+// drop tail bottleneck queue
+static const int64_t kMaxQueueDelayUs = 500000;
+// a frame later than this after capture is a visible stall
+static const int64_t kStallDelayUs = 400000;
+
+// bottleneck capacity from startUs on
+struct TracePoint {
+    int64_t startUs;
+    uint32_t capacity;
+};
+
+struct ReplayResult {
+    // from the last capacity change until the target reaches 80% of the capacity, -1 if never
+    int64_t rampUpUs;
+    double meanQueueDelayMs;
+    double p95QueueDelayMs;
+    double stallRate;
+    double utilization;
+    uint32_t finalTarget;
+};
+
+static uint32_t capacityAt(const std::vector<TracePoint>& trace, int64_t timeUs) {
+    uint32_t capacity = trace[0].capacity;
+    for (size_t i = 0; i < trace.size(); i++) {
+        if (trace[i].startUs <= timeUs) {
+            capacity = trace[i].capacity;
+        }
+    }
+    return capacity;
+}
+
+// an encoder at the target bit rate behind one bottleneck link, the receiver reports
+// per packet arrival times every kFeedbackIntervalUs
+static ReplayResult replayTrace(const std::vector<TracePoint>& trace, int64_t durationUs) {
+    RTPDelayGradientController controller;
+    controller.setMaxBitrate(kMaxBitrate);
+
+    struct Packet {
+        uint16_t seqNum;
+        int64_t sendTimeUs;
+        int64_t arrivalTimeUs;  // -1 if dropped at the bottleneck
+        int64_t reportTimeUs;   // when the receiver has seen it or its loss
+    };
+    std::vector<Packet> packets;
+    size_t reported = 0;
+    uint16_t seqNum = 0;
+
+    // the encoder starts at the max bit rate, as the controller assumes
+    uint32_t target = kMaxBitrate;
+    int64_t linkFreeUs = 0;
+    int64_t nextFeedbackUs = kFeedbackIntervalUs;
+    int64_t lastChangeUs = trace.back().startUs;
+    int64_t rampUpUs = -1;
+    uint64_t deliveredBits = 0;
+    double capacityBits = 0;
+    std::vector<double> queueDelaysMs;
+    uint32_t frames = 0;
+    uint32_t stalls = 0;
+
+    for (int64_t nowUs = 0; nowUs < durationUs; nowUs += kFrameIntervalUs) {
+        // feedback sent by the receiver one way delay ago
+        while (nextFeedbackUs + kOneWayDelayUs <= nowUs) {
+            std::vector<RTPCongestionController::PacketFeedback> feedbacks;
+            while (reported < packets.size() && packets[reported].reportTimeUs <= nextFeedbackUs) {
+                RTPCongestionController::PacketFeedback feedback;
+                feedback.mSeqNum = packets[reported].seqNum;
+                feedback.mArrivalTimeUs = packets[reported].arrivalTimeUs;
+                feedbacks.push_back(feedback);
+                reported++;
+            }
+            uint32_t newTarget = 0;
+            if (!feedbacks.empty() &&
+                controller.onPacketFeedback(feedbacks.data(), feedbacks.size(), nowUs,
+                                            &newTarget)) {
+                target = newTarget;
+            }
+            nextFeedbackUs += kFeedbackIntervalUs;
+        }
+
+        uint32_t capacity = capacityAt(trace, nowUs);
+        capacityBits += (double)capacity * kFrameIntervalUs / 1000000;
+        if (rampUpUs < 0 && nowUs >= lastChangeUs && target >= capacity * 8 / 10) {
+            rampUpUs = nowUs - lastChangeUs;
+        }
+
+        // one frame, sent at once as RTPSender does without pacing
+        uint32_t frameBytes = target / 8 * kFrameIntervalUs / 1000000;
+        int64_t frameArrivalUs = -1;
+        for (uint32_t sent = 0; sent < frameBytes; sent += kPacketSize) {
+            uint32_t size = std::min(kPacketSize, frameBytes - sent);
+            Packet packet;
+            packet.seqNum = seqNum++;
+            packet.sendTimeUs = nowUs;
+            controller.onPacketSent(packet.seqNum, size, nowUs);
+
+            int64_t startUs = std::max(nowUs, linkFreeUs);
+            if (startUs - nowUs > kMaxQueueDelayUs) {
+                packet.arrivalTimeUs = -1;
+                packet.reportTimeUs = startUs + kOneWayDelayUs;
+                frameArrivalUs = durationUs;
+            } else {
+                linkFreeUs = startUs + (int64_t)size * 8 * 1000000 / capacityAt(trace, startUs);
+                packet.arrivalTimeUs = linkFreeUs + kOneWayDelayUs;
+                packet.reportTimeUs = packet.arrivalTimeUs;
+                deliveredBits += size * 8;
+                queueDelaysMs.push_back((linkFreeUs - nowUs) / 1000.0);
+                frameArrivalUs = std::max(frameArrivalUs, packet.arrivalTimeUs);
+            }
+            // FIFO, a dropped packet is reported with the next one
+            if (!packets.empty() && packet.reportTimeUs < packets.back().reportTimeUs) {
+                packet.reportTimeUs = packets.back().reportTimeUs;
+            }
+            packets.push_back(packet);
+        }
+        frames++;
+        if (frameArrivalUs - nowUs > kStallDelayUs) {
+            stalls++;
+        }
+    }
+
+    ReplayResult result;
+    result.rampUpUs = rampUpUs;
+    double sum = 0;
+    for (size_t i = 0; i < queueDelaysMs.size(); i++) {
+        sum += queueDelaysMs[i];
+    }
+    result.meanQueueDelayMs = queueDelaysMs.empty() ? 0 : sum / queueDelaysMs.size();
+    std::sort(queueDelaysMs.begin(), queueDelaysMs.end());
+    result.p95QueueDelayMs =
+            queueDelaysMs.empty() ? 0 : queueDelaysMs[queueDelaysMs.size() * 95 / 100];
+    result.stallRate = (double)stalls / frames;
+    result.utilization = deliveredBits / capacityBits;
+    result.finalTarget = target;
+    return result;
+}
+
+static void printResult(const char* name, const ReplayResult& result) {
+    printf("%s: ramp-up %lld ms, queue delay mean %.1f ms p95 %.1f ms, stall rate %.3f, "
+           "utilization %.2f, final target %u bps\n",
+           name, (long long)(result.rampUpUs / 1000), result.meanQueueDelayMs,
+           result.p95QueueDelayMs, result.stallRate, result.utilization, result.finalTarget);
+}
+
+TEST(RTPDelayGradientControllerTest, ConstantLinkSettlesBelowCapacity) {
+    std::vector<TracePoint> trace = {{0, 1000000}};
+
+    ReplayResult result = replayTrace(trace, 30000000);
+    printResult("constant 1 Mbps", result);
+
+    // the start at twice the link fills the queue, then the delay gradient keeps it short
+    EXPECT_LE(result.finalTarget, 1000000u);
+    EXPECT_GE(result.utilization, 0.8);
+    EXPECT_LT(result.meanQueueDelayMs, 100.0);
+    EXPECT_LT(result.stallRate, 0.1);
+}
+
+TEST(RTPDelayGradientControllerTest, StepDownDrainsQueue) {
+    std::vector<TracePoint> trace = {{0, 1500000}, {15000000, 500000}};
+
+    ReplayResult result = replayTrace(trace, 40000000);
+    printResult("1.5 Mbps -> 500 kbps", result);
+
+    EXPECT_LE(result.finalTarget, 500000u);
+    EXPECT_LT(result.meanQueueDelayMs, 100.0);
+    EXPECT_LT(result.stallRate, 0.1);
+}
+
+TEST(RTPDelayGradientControllerTest, StepUpRampsUp) {
+    std::vector<TracePoint> trace = {{0, 400000}, {10000000, 1500000}};
+
+    ReplayResult result = replayTrace(trace, 40000000);
+    printResult("400 kbps -> 1.5 Mbps", result);
+
+    // the loss based bit rate caps the ramp-up at 5% per second
+    ASSERT_GE(result.rampUpUs, 0);
+    EXPECT_LT(result.rampUpUs, 30000000);
+    EXPECT_LT(result.meanQueueDelayMs, 100.0);
+}
+
+TEST(RTPDelayGradientControllerTest, FluctuatingLink) {
+    // a cell edge, capacity swinging every 3 s
+    std::vector<TracePoint> trace;
+    for (int i = 0; i < 10; i++) {
+        trace.push_back({i * 3000000ll, (uint32_t)(i % 2 == 0 ? 1200000 : 600000)});
+    }
+
+    ReplayResult result = replayTrace(trace, 30000000);
+    printResult("1.2 Mbps <-> 600 kbps", result);
+
+    EXPECT_GE(result.utilization, 0.6);
+    EXPECT_LT(result.meanQueueDelayMs, 150.0);
+    EXPECT_LT(result.stallRate, 0.2);
+}
+
+}  // namespace imsma
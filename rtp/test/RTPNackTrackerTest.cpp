@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <map>
+#include <vector>
+
+#include "RTPNackTracker.h"
+
+namespace imsma {
+
+static const int64_t kDeadlineUs = 1000000ll;
+static const int64_t kHoldUs = RTPNackTracker::kReorderHoldUs;
+static const uint32_t kMaxRetries = RTPNackTracker::kMaxRetries;
+
+static uint32_t fciPid(const sp<ABuffer>& fcis, size_t i) {
+    const uint8_t* data = fcis->data() + i * 4;
+    return (data[0] << 8) | data[1];
+}
+
+static uint16_t fciBlp(const sp<ABuffer>& fcis, size_t i) {
+    const uint8_t* data = fcis->data() + i * 4;
+    return (data[2] << 8) | data[3];
+}
+
+TEST(RTPNackTrackerTest, RequestsHoleAfterReorderHold) {
+    RTPNackTracker tracker;
+    tracker.setDeadlineUs(kDeadlineUs);
+
+    // 11 and 12 are missing
+    tracker.onPacketReceived(13, 10, 0);
+    EXPECT_EQ(2u, tracker.size());
+    EXPECT_EQ(kHoldUs, tracker.nextEventUs());
+
+    EXPECT_TRUE(tracker.buildFCIs(kHoldUs - 1) == NULL);
+
+    sp<ABuffer> fcis = tracker.buildFCIs(kHoldUs);
+    ASSERT_TRUE(fcis != NULL);
+    ASSERT_EQ(4u, fcis->size());
+    EXPECT_EQ(11u, fciPid(fcis, 0));
+    EXPECT_EQ(0x0001, fciBlp(fcis, 0));
+    EXPECT_EQ(2u, tracker.getRequestedCount());
+}
+
+TEST(RTPNackTrackerTest, SplitsFarHolesIntoFCIs) {
+    RTPNackTracker tracker;
+    tracker.setDeadlineUs(kDeadlineUs);
+
+    tracker.onPacketReceived(101, 99, 0);
+    tracker.onPacketReceived(121, 119, 0);
+
+    sp<ABuffer> fcis = tracker.buildFCIs(kHoldUs);
+    ASSERT_TRUE(fcis != NULL);
+    ASSERT_EQ(8u, fcis->size());
+    EXPECT_EQ(100u, fciPid(fcis, 0));
+    EXPECT_EQ(0, fciBlp(fcis, 0));
+    EXPECT_EQ(120u, fciPid(fcis, 1));
+    EXPECT_EQ(0, fciBlp(fcis, 1));
+}
+
+TEST(RTPNackTrackerTest, RetriesEveryRTTUpToMax) {
+    RTPNackTracker tracker;
+    tracker.setDeadlineUs(kDeadlineUs);
+    tracker.setRTTUs(50000);
+
+    tracker.onPacketReceived(2, 0, 0);
+
+    int64_t nowUs = kHoldUs;
+    for (uint32_t i = 0; i < kMaxRetries; i++) {
+        EXPECT_TRUE(tracker.buildFCIs(nowUs) != NULL);
+        EXPECT_TRUE(tracker.buildFCIs(nowUs + 50000 - 1) == NULL);
+        nowUs += 50000;
+    }
+
+    // no more request, kept until the deadline
+    EXPECT_TRUE(tracker.buildFCIs(nowUs) == NULL);
+    EXPECT_EQ(kDeadlineUs, tracker.nextEventUs());
+    EXPECT_EQ(kMaxRetries, tracker.getRequestedCount());
+}
+
+TEST(RTPNackTrackerTest, CountsRecoveredPacket) {
+    RTPNackTracker tracker;
+    tracker.setDeadlineUs(kDeadlineUs);
+
+    tracker.onPacketReceived(4, 0, 0);  // 1, 2 and 3 are missing
+    tracker.buildFCIs(kHoldUs);
+
+    tracker.onPacketReceived(2, 4, 10000);
+    EXPECT_EQ(2u, tracker.size());
+    EXPECT_EQ(1u, tracker.getRecoveredCount());
+    EXPECT_TRUE(tracker.isPendingBefore(4, 10000));
+    EXPECT_FALSE(tracker.isPendingBefore(1, 10000));
+}
+
+TEST(RTPNackTrackerTest, GivesUpAtDeadline) {
+    RTPNackTracker tracker;
+    tracker.setDeadlineUs(kDeadlineUs);
+
+    tracker.onPacketReceived(3, 0, 0);
+    EXPECT_EQ(0u, tracker.removeExpired(kDeadlineUs - 1));
+    EXPECT_EQ(2u, tracker.removeExpired(kDeadlineUs));
+    EXPECT_EQ(0u, tracker.size());
+    EXPECT_EQ(2u, tracker.getGivenUpCount());
+    EXPECT_EQ(-1, tracker.nextEventUs());
+}
+
+TEST(RTPNackTrackerTest, LeavesLargeGapToKeyFrame) {
+    RTPNackTracker tracker;
+    tracker.setDeadlineUs(kDeadlineUs);
+
+    tracker.onPacketReceived(3, 0, 0);
+    tracker.onPacketReceived(3 + RTPNackTracker::kMaxMissing + 2, 3, 0);
+    EXPECT_EQ(0u, tracker.size());
+    EXPECT_EQ(2u, tracker.getGivenUpCount());
+}
+
+TEST(RTPNackTrackerTest, SkipsHoleWhenRTTExceedsDeadline) {
+    RTPNackTracker tracker;
+    tracker.setDeadlineUs(kDeadlineUs);
+    tracker.setRTTUs(kDeadlineUs);
+
+    tracker.onPacketReceived(3, 0, 0);
+    EXPECT_EQ(0u, tracker.size());
+}
+
+// a video call over a lossy link, driven like RTPSource drives the tracker:
+// every arrival goes to onPacketReceived, the NACK timer expires and builds
+// FCIs every ms, the sender resends each requested packet once per NACK
+struct LossSimResult {
+    uint32_t lossyFrames;       // frames with a packet lost on the first send
+    uint32_t incompleteFrames;  // frames still missing a packet at the deadline, each costs a PLI
+    uint32_t nackedPackets;
+};
+
+static const uint32_t kSimFrames = 600;
+static const uint32_t kSimPacketsPerFrame = 8;
+static const int64_t kSimFrameIntervalUs = 33333;
+static const uint32_t kSimFirstSeqNum = 1000;
+
+static void simDecodeFCIs(const sp<ABuffer>& fcis, std::vector<uint32_t>* seqNums) {
+    for (size_t i = 0; i < fcis->size() / 4; i++) {
+        uint32_t pid = fciPid(fcis, i);
+        uint16_t blp = fciBlp(fcis, i);
+        seqNums->push_back(pid);
+        for (uint32_t bit = 0; bit < 16; bit++) {
+            if (blp & (1 << bit)) {
+                seqNums->push_back(pid + bit + 1);
+            }
+        }
+    }
+}
+
+// lossPercent applies to media, NACKs and retransmissions alike
+static LossSimResult simulateLossyLink(int lossPercent, int64_t rttUs, int64_t deadlineUs) {
+    const uint32_t count = kSimFrames * kSimPacketsPerFrame;
+    RTPNackTracker tracker;
+    tracker.setDeadlineUs(deadlineUs);
+    tracker.setRTTUs(rttUs);
+
+    // arrival time -> index, up to 3 ms of jitter reorders close packets
+    std::multimap<int64_t, uint32_t> inFlight;
+    std::vector<int64_t> arrivalUs(count, -1);
+    std::vector<bool> firstLost(count, false);
+    srand(lossPercent * 1000 + (int)(rttUs / 1000));
+
+    for (uint32_t i = 0; i < count; i++) {
+        int64_t sendUs = (i / kSimPacketsPerFrame) * kSimFrameIntervalUs +
+                         (i % kSimPacketsPerFrame) * 1000;
+        if (rand() % 100 < lossPercent) {
+            firstLost[i] = true;
+        } else {
+            inFlight.insert(std::make_pair(sendUs + rttUs / 2 + rand() % 3000, i));
+        }
+    }
+
+    LossSimResult result = {0, 0, 0};
+    uint32_t highestSeqNum = kSimFirstSeqNum - 1;
+    int64_t endUs = kSimFrames * kSimFrameIntervalUs + deadlineUs + rttUs;
+    for (int64_t nowUs = 0; nowUs <= endUs; nowUs += 1000) {
+        while (!inFlight.empty() && inFlight.begin()->first <= nowUs) {
+            int64_t timeUs = inFlight.begin()->first;
+            uint32_t index = inFlight.begin()->second;
+            inFlight.erase(inFlight.begin());
+
+            uint32_t seqNum = kSimFirstSeqNum + index;
+            if (arrivalUs[index] < 0) {
+                arrivalUs[index] = timeUs;
+            }
+            tracker.onPacketReceived(seqNum, highestSeqNum, timeUs);
+            if ((int32_t)(seqNum - highestSeqNum) > 0) {
+                highestSeqNum = seqNum;
+            }
+        }
+
+        tracker.removeExpired(nowUs);
+        sp<ABuffer> fcis = tracker.buildFCIs(nowUs);
+        if (fcis == NULL || rand() % 100 < lossPercent) {
+            continue;
+        }
+
+        std::vector<uint32_t> seqNums;
+        simDecodeFCIs(fcis, &seqNums);
+        for (size_t i = 0; i < seqNums.size(); i++) {
+            result.nackedPackets++;
+            if (rand() % 100 >= lossPercent) {
+                inFlight.insert(
+                        std::make_pair(nowUs + rttUs + rand() % 3000, seqNums[i] - kSimFirstSeqNum));
+            }
+        }
+    }
+
+    for (uint32_t frame = 0; frame < kSimFrames; frame++) {
+        bool lossy = false;
+        bool complete = true;
+        // the jitter buffer holds a frame for the deadline after it is due to arrive
+        int64_t playUs = frame * kSimFrameIntervalUs + rttUs / 2 + deadlineUs;
+        for (uint32_t i = frame * kSimPacketsPerFrame; i < (frame + 1) * kSimPacketsPerFrame;
+             i++) {
+            lossy = lossy || firstLost[i];
+            complete = complete && arrivalUs[i] >= 0 && arrivalUs[i] <= playUs;
+        }
+        result.lossyFrames += lossy ? 1 : 0;
+        result.incompleteFrames += complete ? 0 : 1;
+    }
+
+    // each recovered frame is a key frame request avoided
+    printf("loss %d%%, rtt %lld ms, deadline %lld ms: %u of %u lossy frames recovered, %u packets "
+           "NACKed\n",
+           lossPercent, (long long)(rttUs / 1000), (long long)(deadlineUs / 1000),
+           result.lossyFrames - result.incompleteFrames, result.lossyFrames, result.nackedPackets);
+    return result;
+}
+
+TEST(RTPNackTrackerTest, SimulatedLossRecoveredBeforeDeadline) {
+    const int lossPercents[] = {1, 3, 5, 10};
+    const int64_t rttsUs[] = {40000, 100000, 200000};
+    for (size_t i = 0; i < sizeof(lossPercents) / sizeof(lossPercents[0]); i++) {
+        for (size_t j = 0; j < sizeof(rttsUs) / sizeof(rttsUs[0]); j++) {
+            LossSimResult result = simulateLossyLink(lossPercents[i], rttsUs[j], 500000);
+            EXPECT_GT(result.lossyFrames, 0u);
+            // one of the requests in time and its retransmission get through
+            EXPECT_LE(result.incompleteFrames * 10, result.lossyFrames)
+                    << "loss " << lossPercents[i] << "% rtt " << rttsUs[j] << " us";
+        }
+    }
+}
+
+TEST(RTPNackTrackerTest, SimulatedLossNotRequestedWhenRTTExceedsDeadline) {
+    LossSimResult result = simulateLossyLink(3, 600000, 500000);
+
+    // no retransmission could make it, the jitter buffer falls back to a key frame
+    EXPECT_EQ(0u, result.nackedPackets);
+    EXPECT_EQ(result.lossyFrames, result.incompleteFrames);
+}
+
+}  // namespace imsma
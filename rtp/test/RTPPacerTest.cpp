@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "RTPPacer.h"
+
+namespace imsma {
+
+static const uint32_t kTargetBitrate = 2000000;
+static const int64_t kFrameIntervalUs = 33333;
+static const uint32_t kPacketSize = 1200;
+// an I frame of a 1080p stream is about ten P frames
+static const uint32_t kIFrameScale = 10;
+static const uint32_t kIFrameInterval = 30;
+
+struct SentPacket {
+    int64_t sentUs;
+    uint32_t size;
+};
+
+struct PacedResult {
+    std::vector<SentPacket> sent;
+    // packets leaving at the same time
+    uint32_t maxBurstPackets;
+    int64_t maxIFrameDrainUs;
+};
+
+// the kWhatSendRTPPacket loop of RTPSender on a virtual clock, the looper message
+// posted with getWaitUs() is delivered up to lateUs late
+static PacedResult replayFrames(RTPPacer* pacer, uint32_t frames, int64_t lateUs) {
+    PacedResult result;
+    std::deque<uint32_t> queue;
+    result.maxBurstPackets = 0;
+    result.maxIFrameDrainUs = 0;
+    srand(1);
+
+    uint32_t frameBytes = kTargetBitrate / 8 * kFrameIntervalUs / 1000000;
+    int64_t nowUs = 0;
+    int64_t wakeUpUs = -1;
+    int64_t iFrameStartUs = -1;
+    uint32_t burst = 0;
+    int64_t burstUs = -1;
+
+    for (uint32_t frame = 0; frame < frames || !queue.empty();) {
+        int64_t frameUs = frame * kFrameIntervalUs;
+
+        // onQueueAccessUnit, the whole frame is queued at once
+        if (frame < frames && (wakeUpUs < 0 || frameUs <= wakeUpUs)) {
+            nowUs = std::max(nowUs, frameUs);
+            uint32_t bytes = frame % kIFrameInterval == 0 ? frameBytes * kIFrameScale : frameBytes;
+            for (uint32_t queued = 0; queued < bytes; queued += kPacketSize) {
+                queue.push_back(std::min(kPacketSize, bytes - queued));
+            }
+            if (frame % kIFrameInterval == 0) {
+                iFrameStartUs = nowUs;
+            }
+            frame++;
+        } else {
+            nowUs = wakeUpUs;
+        }
+        wakeUpUs = -1;
+
+        while (!queue.empty()) {
+            if (pacer->isEnabled()) {
+                pacer->updateBudget(nowUs);
+                if (!pacer->canSend()) {
+                    wakeUpUs = nowUs + pacer->getWaitUs() + (lateUs > 0 ? rand() % lateUs : 0);
+                    break;
+                }
+            }
+            SentPacket packet = {nowUs, queue.front()};
+            queue.pop_front();
+            pacer->onPacketSent(packet.size);
+            result.sent.push_back(packet);
+
+            burst = nowUs == burstUs ? burst + 1 : 1;
+            burstUs = nowUs;
+            result.maxBurstPackets = std::max(result.maxBurstPackets, burst);
+        }
+
+        if (queue.empty() && iFrameStartUs >= 0) {
+            result.maxIFrameDrainUs = std::max(result.maxIFrameDrainUs, nowUs - iFrameStartUs);
+            iFrameStartUs = -1;
+        }
+    }
+    return result;
+}
+
+// most bits sent in any window of windowUs
+static uint64_t maxWindowBits(const std::vector<SentPacket>& sent, int64_t windowUs) {
+    uint64_t maxBits = 0;
+    uint64_t bits = 0;
+    size_t begin = 0;
+    for (size_t end = 0; end < sent.size(); end++) {
+        bits += sent[end].size * 8;
+        while (sent[end].sentUs - sent[begin].sentUs >= windowUs) {
+            bits -= sent[begin].size * 8;
+            begin++;
+        }
+        maxBits = std::max(maxBits, bits);
+    }
+    return maxBits;
+}
+
+TEST(RTPPacerTest, DisabledWithoutTargetBitrate) {
+    RTPPacer pacer;
+    EXPECT_FALSE(pacer.isEnabled());
+    pacer.updateBudget(0);
+    pacer.onPacketSent(kPacketSize);
+    EXPECT_TRUE(pacer.canSend());
+    EXPECT_EQ(0, pacer.getWaitUs());
+
+    pacer.setTargetBitrate(kTargetBitrate);
+    pacer.setPacingFactor(0);
+    EXPECT_FALSE(pacer.isEnabled());
+}
+
+TEST(RTPPacerTest, IdleBudgetCappedToMaxBurst) {
+    RTPPacer pacer;
+    pacer.setTargetBitrate(kTargetBitrate);
+    pacer.updateBudget(0);
+    // a long idle gives no more than kMaxBurstUs at the pacing rate
+    pacer.updateBudget(10000000);
+
+    uint64_t sentBits = 0;
+    while (pacer.canSend()) {
+        pacer.onPacketSent(kPacketSize);
+        sentBits += kPacketSize * 8;
+    }
+    uint64_t maxBurstBits = (uint64_t)pacer.getPacingRate() * RTPPacer::kMaxBurstUs / 1000000;
+    EXPECT_LE(sentBits, maxBurstBits + kPacketSize * 8);
+    int64_t minWaitUs = RTPPacer::kMinWaitUs;
+    EXPECT_GE(pacer.getWaitUs(), minWaitUs);
+}
+
+// packets of the replayed stream are spaced at the pacing rate, an I frame
+// no longer leaves as one burst
+TEST(RTPPacerTest, BurstSpacing) {
+    const uint32_t frames = 300;
+    const int64_t lateUs = 500;
+
+    RTPPacer unpaced;
+    PacedResult before = replayFrames(&unpaced, frames, lateUs);
+
+    RTPPacer pacer;
+    pacer.setTargetBitrate(kTargetBitrate);
+    ASSERT_TRUE(pacer.isEnabled());
+    PacedResult after = replayFrames(&pacer, frames, lateUs);
+    ASSERT_EQ(before.sent.size(), after.sent.size());
+
+    uint32_t rate = pacer.getPacingRate();
+    uint64_t burstBits = (uint64_t)rate * RTPPacer::kMaxBurstUs / 1000000 + kPacketSize * 8;
+    const int64_t windows[] = {1000, 5000, 20000, 100000};
+    for (size_t i = 0; i < sizeof(windows) / sizeof(windows[0]); i++) {
+        uint64_t bits = maxWindowBits(after.sent, windows[i]);
+        // token bucket bound, the burst budget plus the debt of one packet
+        EXPECT_LE(bits, burstBits + (uint64_t)rate * windows[i] / 1000000)
+                << "window " << windows[i] << " us";
+        printf("window %lld ms: unpaced %llu bits, paced %llu bits\n",
+               (long long)(windows[i] / 1000),
+               (unsigned long long)maxWindowBits(before.sent, windows[i]),
+               (unsigned long long)bits);
+    }
+
+    // the I frame is spread at the pacing rate left over by the P frames queued behind it,
+    // not much longer
+    uint64_t iFrameBits = (uint64_t)kTargetBitrate * kFrameIntervalUs / 1000000 * kIFrameScale;
+    int64_t iFrameDrainUs = iFrameBits * 1000000 / (rate - kTargetBitrate);
+    EXPECT_LE(after.maxIFrameDrainUs, iFrameDrainUs + kFrameIntervalUs);
+    EXPECT_LT(after.maxBurstPackets, before.maxBurstPackets);
+
+    printf("pacing rate %u bps: max burst %u -> %u packets, I frame drain %lld -> %lld ms\n",
+           rate, before.maxBurstPackets, after.maxBurstPackets,
+           (long long)(before.maxIFrameDrainUs / 1000), (long long)(after.maxIFrameDrainUs / 1000));
+}
+
+}  // namespace imsma
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "RTPSendHistory.h"
+
+namespace imsma {
+
+static const int64_t kWindowUs = 1000000ll;
+
+static sp<ABuffer> makePacket(uint16_t seqNum) {
+    sp<ABuffer> packet = new ABuffer(12);
+    packet->data()[2] = seqNum >> 8;
+    packet->data()[3] = seqNum & 0xff;
+    return packet;
+}
+
+TEST(RTPSendHistoryTest, FindsSentPacket) {
+    RTPSendHistory history;
+    history.setWindowUs(kWindowUs);
+
+    sp<ABuffer> sent = makePacket(100);
+    history.insert(sent, 100, 0);
+
+    sp<ABuffer> found;
+    EXPECT_EQ(RTPSendHistory::FOUND, history.lookup(100, 1000, &found));
+    EXPECT_EQ(sent.get(), found.get());
+    EXPECT_EQ(RTPSendHistory::NOT_FOUND, history.lookup(101, 1000, &found));
+}
+
+TEST(RTPSendHistoryTest, ThrottlesRepeatedNack) {
+    RTPSendHistory history;
+    history.setWindowUs(kWindowUs);
+    history.insert(makePacket(7), 7, 0);
+
+    sp<ABuffer> found;
+    EXPECT_EQ(RTPSendHistory::FOUND, history.lookup(7, 10000, &found));
+    EXPECT_EQ(RTPSendHistory::RESENT_RECENTLY,
+              history.lookup(7, 10000 + RTPSendHistory::kMinResendIntervalUs - 1, &found));
+    EXPECT_EQ(RTPSendHistory::FOUND,
+              history.lookup(7, 10000 + RTPSendHistory::kMinResendIntervalUs, &found));
+}
+
+TEST(RTPSendHistoryTest, AgesOutOfWindow) {
+    RTPSendHistory history;
+    history.setWindowUs(kWindowUs);
+    history.insert(makePacket(7), 7, 0);
+
+    sp<ABuffer> found;
+    EXPECT_EQ(RTPSendHistory::NOT_FOUND, history.lookup(7, kWindowUs + 1, &found));
+    // the payload is released, it is not found later either
+    EXPECT_EQ(RTPSendHistory::NOT_FOUND, history.lookup(7, 0, &found));
+}
+
+TEST(RTPSendHistoryTest, OverwrittenSlotIsNotFound) {
+    RTPSendHistory history;
+    history.setWindowUs(kWindowUs);
+
+    uint16_t seqNum = 65535 - RTPSendHistory::kCapacity / 2;
+    uint16_t laterSeqNum = seqNum + RTPSendHistory::kCapacity;  // wraps around 65535
+    history.insert(makePacket(seqNum), seqNum, 0);
+    history.insert(makePacket(laterSeqNum), laterSeqNum, 0);
+
+    sp<ABuffer> found;
+    EXPECT_EQ(RTPSendHistory::NOT_FOUND, history.lookup(seqNum, 0, &found));
+    EXPECT_EQ(RTPSendHistory::FOUND, history.lookup(laterSeqNum, 0, &found));
+}
+
+TEST(RTPSendHistoryTest, ClearForgetsAll) {
+    RTPSendHistory history;
+    history.setWindowUs(kWindowUs);
+    history.insert(makePacket(0), 0, 0);
+    history.clear();
+
+    sp<ABuffer> found;
+    EXPECT_EQ(RTPSendHistory::NOT_FOUND, history.lookup(0, 0, &found));
+}
+
+}  // namespace imsma
@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <utils/Timers.h>
+
+#include "RTPTransportFeedback.h"
+
+namespace imsma {
+
+typedef RTPCongestionController::PacketFeedback PacketFeedback;
+
+// deltas are reported in 250us
+static const int64_t kDeltaUnitUs = 250ll;
+static const uint32_t kMaxStatusCount = RTPTransportFeedback::kMaxStatusCount;
+
+static bool roundTrip(RTPTransportFeedback* feedback, Vector<PacketFeedback>* feedbacks) {
+    sp<ABuffer> fci = feedback->buildFCI();
+
+    if (fci == NULL) {
+        return false;
+    }
+
+    return RTPTransportFeedback::parseFCI(fci->data(), fci->size(), feedbacks);
+}
+
+TEST(RTPTransportFeedbackTest, NothingToReport) {
+    RTPTransportFeedback feedback;
+    EXPECT_TRUE(feedback.buildFCI() == NULL);
+
+    feedback.onPacketArrived(1, 1000000);
+    EXPECT_TRUE(feedback.buildFCI() != NULL);
+    EXPECT_TRUE(feedback.buildFCI() == NULL);
+}
+
+TEST(RTPTransportFeedbackTest, RoundTripsSmallAndLargeDeltas) {
+    RTPTransportFeedback feedback;
+    // small, zero, large, and negative (reordered) deltas
+    const int64_t arrivalUs[] = {1000000, 1010000, 1010000, 1200000, 1150000, 1150250};
+    const size_t count = sizeof(arrivalUs) / sizeof(arrivalUs[0]);
+
+    for (size_t i = 0; i < count; i++) {
+        feedback.onPacketArrived(500 + i, arrivalUs[i]);
+    }
+
+    Vector<PacketFeedback> feedbacks;
+    ASSERT_TRUE(roundTrip(&feedback, &feedbacks));
+    ASSERT_EQ(count, feedbacks.size());
+
+    // arrival times are relative to the reference time, compare the deltas
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(500 + i, feedbacks[i].mSeqNum);
+        EXPECT_NEAR(arrivalUs[i] - arrivalUs[0],
+                    feedbacks[i].mArrivalTimeUs - feedbacks[0].mArrivalTimeUs, kDeltaUnitUs / 2);
+    }
+}
+
+TEST(RTPTransportFeedbackTest, ReportsLostPackets) {
+    RTPTransportFeedback feedback;
+    feedback.onPacketArrived(10, 1000000);
+    feedback.onPacketArrived(13, 1030000);
+
+    Vector<PacketFeedback> feedbacks;
+    ASSERT_TRUE(roundTrip(&feedback, &feedbacks));
+    ASSERT_EQ(4u, feedbacks.size());
+    EXPECT_GE(feedbacks[0].mArrivalTimeUs, 0);
+    EXPECT_EQ(-1, feedbacks[1].mArrivalTimeUs);
+    EXPECT_EQ(-1, feedbacks[2].mArrivalTimeUs);
+    EXPECT_NEAR(30000, feedbacks[3].mArrivalTimeUs - feedbacks[0].mArrivalTimeUs,
+                kDeltaUnitUs / 2);
+
+    // a late arrival of a packet reported lost is not reported again
+    feedback.onPacketArrived(11, 1040000);
+    EXPECT_TRUE(feedback.buildFCI() == NULL);
+}
+
+TEST(RTPTransportFeedbackTest, RunLengthAcrossSeqWrap) {
+    RTPTransportFeedback feedback;
+    const uint32_t count = 100;
+
+    for (uint32_t i = 0; i < count; i++) {
+        feedback.onPacketArrived((uint16_t)(65500 + i), 2000000 + i * 1000);
+    }
+
+    sp<ABuffer> fci = feedback.buildFCI();
+    ASSERT_TRUE(fci != NULL);
+    // header, one run length chunk, one byte per small delta
+    EXPECT_EQ(8u + 2u + count, fci->size());
+
+    Vector<PacketFeedback> feedbacks;
+    ASSERT_TRUE(RTPTransportFeedback::parseFCI(fci->data(), fci->size(), &feedbacks));
+    ASSERT_EQ(count, feedbacks.size());
+    EXPECT_EQ(65500, feedbacks[0].mSeqNum);
+    EXPECT_EQ((uint16_t)(65500 + count - 1), feedbacks[count - 1].mSeqNum);
+    EXPECT_EQ((int64_t)(count - 1) * 1000,
+              feedbacks[count - 1].mArrivalTimeUs - feedbacks[0].mArrivalTimeUs);
+}
+
+TEST(RTPTransportFeedbackTest, SplitsLongReport) {
+    RTPTransportFeedback feedback;
+    const uint32_t count = kMaxStatusCount + 10;
+
+    for (uint32_t i = 0; i < count; i++) {
+        feedback.onPacketArrived(i, 1000000 + i * 1000);
+    }
+
+    Vector<PacketFeedback> feedbacks;
+    ASSERT_TRUE(roundTrip(&feedback, &feedbacks));
+    EXPECT_EQ(kMaxStatusCount, feedbacks.size());
+
+    feedbacks.clear();
+    ASSERT_TRUE(roundTrip(&feedback, &feedbacks));
+    ASSERT_EQ(10u, feedbacks.size());
+    EXPECT_EQ(kMaxStatusCount, feedbacks[0].mSeqNum);
+}
+
+TEST(RTPTransportFeedbackTest, RejectsTruncatedFCI) {
+    RTPTransportFeedback feedback;
+    feedback.onPacketArrived(1, 1000000);
+    feedback.onPacketArrived(2, 1300000);
+
+    sp<ABuffer> fci = feedback.buildFCI();
+    ASSERT_TRUE(fci != NULL);
+
+    Vector<PacketFeedback> feedbacks;
+    EXPECT_FALSE(RTPTransportFeedback::parseFCI(fci->data(), 7, &feedbacks));
+    EXPECT_FALSE(RTPTransportFeedback::parseFCI(fci->data(), 9, &feedbacks));
+    EXPECT_FALSE(RTPTransportFeedback::parseFCI(fci->data(), fci->size() - 1, &feedbacks));
+}
+
+// IPv4 and UDP headers of each datagram
+static const size_t kUdpOverhead = 28;
+// RTCP RTPFB header with both SSRCs, as RTPController adds it
+static const size_t kRtcpHeaderSize = 12;
+static const size_t kRtpPacketSize = 1200;
+
+static int openLoopbackSocket(struct sockaddr_in* addr) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    memset(addr, 0, sizeof(*addr));
+    addr->sin_family = AF_INET;
+    addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(*addr);
+    if (bind(fd, (struct sockaddr*)addr, len) < 0 ||
+        getsockname(fd, (struct sockaddr*)addr, &len) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+struct LoopbackResult {
+    uint32_t sent;
+    uint32_t lost;
+    uint32_t reported;
+    uint32_t reportedLost;
+    uint64_t mediaBytes;
+    uint64_t feedbackBytes;
+    uint32_t feedbackPackets;
+    nsecs_t codecNs;
+};
+
+// media from the sender socket to the receiver socket, feedback back every kFeedbackIntervalUs
+// of the stream time, both through the loopback interface
+static bool runLoopback(int sender, int receiver, const struct sockaddr_in& senderAddr,
+                        const struct sockaddr_in& receiverAddr, uint32_t bitrate,
+                        int64_t durationUs, LoopbackResult* result) {
+    RTPTransportFeedback feedback;
+    memset(result, 0, sizeof(*result));
+    srand(bitrate);
+
+    int64_t intervalUs = (int64_t)kRtpPacketSize * 8 * 1000000 / bitrate;
+    int64_t nextFeedbackUs = RTPTransportFeedback::kFeedbackIntervalUs;
+    uint8_t packet[kRtpPacketSize];
+    uint8_t rtcp[1500];
+    memset(packet, 0, sizeof(packet));
+
+    for (uint32_t i = 0; (int64_t)i * intervalUs < durationUs; i++) {
+        // up to 2 ms of jitter on a 1% lossy link
+        int64_t arrivalUs = i * intervalUs + rand() % 2000;
+        uint16_t transportSeq = (uint16_t)i;
+        result->sent++;
+        if (rand() % 100 == 0) {
+            result->lost++;
+        } else {
+            packet[0] = transportSeq >> 8;
+            packet[1] = transportSeq & 0xff;
+            if (sendto(sender, packet, sizeof(packet), 0, (const struct sockaddr*)&receiverAddr,
+                       sizeof(receiverAddr)) != (ssize_t)sizeof(packet) ||
+                recv(receiver, packet, sizeof(packet), 0) != (ssize_t)sizeof(packet)) {
+                return false;
+            }
+            result->mediaBytes += sizeof(packet) + kUdpOverhead;
+
+            nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+            feedback.onPacketArrived((packet[0] << 8) | packet[1], arrivalUs);
+            result->codecNs += systemTime(SYSTEM_TIME_MONOTONIC) - start;
+        }
+
+        if (arrivalUs < nextFeedbackUs) {
+            continue;
+        }
+        nextFeedbackUs += RTPTransportFeedback::kFeedbackIntervalUs;
+
+        while (true) {
+            nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
+            sp<ABuffer> fci = feedback.buildFCI();
+            result->codecNs += systemTime(SYSTEM_TIME_MONOTONIC) - start;
+            if (fci == NULL) {
+                break;
+            }
+
+            size_t padding = (4 - (fci->size() & 0x03)) & 0x03;
+            size_t size = kRtcpHeaderSize + fci->size() + padding;
+            memset(rtcp, 0, size);
+            memcpy(rtcp + kRtcpHeaderSize, fci->data(), fci->size());
+            if (sendto(receiver, rtcp, size, 0, (const struct sockaddr*)&senderAddr,
+                       sizeof(senderAddr)) != (ssize_t)size ||
+                recv(sender, rtcp, sizeof(rtcp), 0) != (ssize_t)size) {
+                return false;
+            }
+            result->feedbackBytes += size + kUdpOverhead;
+            result->feedbackPackets++;
+
+            Vector<PacketFeedback> feedbacks;
+            start = systemTime(SYSTEM_TIME_MONOTONIC);
+            bool parsed = RTPTransportFeedback::parseFCI(rtcp + kRtcpHeaderSize, fci->size(),
+                                                         &feedbacks);
+            result->codecNs += systemTime(SYSTEM_TIME_MONOTONIC) - start;
+            if (!parsed) {
+                return false;
+            }
+            for (size_t j = 0; j < feedbacks.size(); j++) {
+                result->reported++;
+                result->reportedLost += feedbacks[j].mArrivalTimeUs < 0 ? 1 : 0;
+            }
+        }
+    }
+    return true;
+}
+
+TEST(RTPTransportFeedbackTest, LoopbackOverheadBenchmark) {
+    struct sockaddr_in senderAddr;
+    struct sockaddr_in receiverAddr;
+    int sender = openLoopbackSocket(&senderAddr);
+    int receiver = openLoopbackSocket(&receiverAddr);
+    ASSERT_GE(sender, 0);
+    ASSERT_GE(receiver, 0);
+
+    const int64_t durationUs = 20000000ll;
+    const uint32_t bitrates[] = {300000, 1000000, 4000000};
+    for (size_t i = 0; i < sizeof(bitrates) / sizeof(bitrates[0]); i++) {
+        LoopbackResult result;
+        ASSERT_TRUE(runLoopback(sender, receiver, senderAddr, receiverAddr, bitrates[i],
+                                durationUs, &result));
+
+        // every packet but the ones after the last feedback is reported once
+        EXPECT_LE(result.reported, result.sent);
+        EXPECT_GE(result.reported + bitrates[i] / (kRtpPacketSize * 8) / 10 + 1, result.sent);
+        EXPECT_LE(result.reportedLost, result.lost);
+        double overhead = (double)result.feedbackBytes / result.mediaBytes;
+        EXPECT_LT(overhead, 0.05) << bitrates[i] << " bps";
+
+        printf("transport feedback at %u bps: %u packets, %u feedbacks, %.1f kbps feedback, "
+               "%.2f%% of media, codec %.1f ns/packet\n",
+               bitrates[i], result.sent, result.feedbackPackets,
+               result.feedbackBytes * 8 * 1000.0 / durationUs, overhead * 100,
+               (double)result.codecNs / result.sent);
+    }
+
+    close(sender);
+    close(receiver);
+}
+
+}  // namespace imsma
@@ -113,7 +113,7 @@ void markIDRInfo(const char* mime, bool withStartCode, const sp<ABuffer>& buffer
 
     if (isH264) {
         if (withStartCode) {
-            while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
+            while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
                 if (nalSize == 0u) {
                     ALOGW("skipping empty nal unit from potentially malformed bitstream");
                     continue;
@@ -133,7 +133,7 @@ void markIDRInfo(const char* mime, bool withStartCode, const sp<ABuffer>& buffer
         }
     } else if (isHEVC) {
         if (withStartCode) {  // can be more than 1 NAL
-            while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
+            while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
                 if (nalSize == 0u) {
                     ALOGW("skipping empty nal unit from potentially malformed bitstream");
                     continue;
@@ -832,6 +832,28 @@ FLUSHNOW:
     List<sp<ABuffer>>::iterator it;
     it = mVideoDLQueue.begin();
 
+    // the RTP assemblers keep room for the start code before the NAL,
+    // a frame of one NAL is passed on without copying it
+    if (mVideoDLQueue.size() == 1 && (*it)->offset() >= 4) {
+        sp<ABuffer> nal = *it;
+        uint8_t* frameData = nal->data() - 4;
+        memcpy(frameData, startCodec, 4);
+
+        sp<ABuffer> finalABuf = new ABuffer(frameData, nal->size() + 4);
+        // the frame data belongs to nal
+        finalABuf->meta()->setObject("nal", nal);
+        copyMeta(nal->meta(), finalABuf->meta());
+
+        mVideoDLQueue.clear();
+
+        if (!markEOF) {
+            mVideoDLQueue.push_back(accessUnit);
+        }
+
+        accessUnit = finalABuf;
+        return false;
+    }
+
     while (it != mVideoDLQueue.end()) {
         totalSize += (*it)->size();
         it++;
@@ -1141,7 +1163,7 @@ bool Sink::convertToMeta(bool isVideo, sp<AMessage> meta) {
             sp<ABuffer> picParamSet = NULL;
             int32_t findBoth = 0;
 
-            while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
+            while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
                 if ((nalStart[0] & 0x1f) == 7) {
                     seqParamSet = new ABuffer(nalSize + 4);
                     memcpy(seqParamSet->data(), nalStart - 4,
@@ -1199,7 +1221,7 @@ bool Sink::convertToMeta(bool isVideo, sp<AMessage> meta) {
             int32_t findBoth = 0;
             //HEVC has 3 nal to feed to decoder, we just use csd-0 to feed
 
-            while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
+            while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
                 if ((nalStart[0] & 0x1f) == 7) {
                      seqParamSet = new ABuffer(nalSize + 4);
                      memcpy(seqParamSet->data(), nalStart - 4, nalSize + 4);//send to codec with
@@ -1263,7 +1285,7 @@ bool Sink::findAndParseCsdNAL(sp<ABuffer>& accessUnit, bool withStartCode, int32
     sp<ABuffer> seqParamSet = NULL;
 
     if (withStartCode) {  // can be more than 1 NAL
-        while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
+        while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
             if ((nalStart[0] & 0x1f) == 7) {
                 seqParamSet = new ABuffer(nalSize);
                 memcpy(seqParamSet->data(), nalStart, nalSize);
@@ -1310,7 +1332,8 @@ bool Sink::findAndParseCsdNALHEVC(sp<ABuffer>& accessUnit, bool withStartCode, i
     *height = -1;
 
     sp<ABuffer> nalWoPreventionByte = ABuffer::CreateAsCopy(accessUnit->data(), accessUnit->size());
-    RemovePreventionByte(nalWoPreventionByte->data(), nalWoPreventionByte->size());
+    nalWoPreventionByte->setRange(
+            0, RemovePreventionBytes(nalWoPreventionByte->data(), nalWoPreventionByte->size()));
 
     const uint8_t* data = nalWoPreventionByte->data();
     size_t size = nalWoPreventionByte->size();
@@ -1320,7 +1343,7 @@ bool Sink::findAndParseCsdNALHEVC(sp<ABuffer>& accessUnit, bool withStartCode, i
     sp<ABuffer> seqParamSet = NULL;
 
     if (withStartCode) {  // can be more than 1 NAL
-        while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
+        while (GetNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
             if (((nalStart[0] >> 1) & 0x3f) == SPS_NAL_TYPE) {
                 seqParamSet = new ABuffer(nalSize);
                 memcpy(seqParamSet->data(), nalStart, nalSize);
@@ -14,10 +14,14 @@
 
 #include <sys/un.h>
 #include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/epoll.h>
+#include <stdlib.h>
 
 #include "NetdClient.h"
 
 #include "SocketWrapper.h"
+#include <media/stagefright/foundation/AMessage.h>
 
 #define ATRACE_TAG ATRACE_TAG_VIDEO
 #include <utils/Trace.h>
@@ -30,16 +34,83 @@ using namespace android;
 using android::status_t;
 
 #define UDP_CONNECT 1
+#define MAX_MTU_SIZE 4096
 
 static uint16_t u16at(const uint8_t* data) { return data[0] << 8 | data[1]; }
 
 static uint16_t getRtpSN(const sp<ABuffer>& buf) { return u16at(&((buf->data())[2])); }
 
+struct SocketBufferPool::PooledBuffer : public ABuffer {
+    PooledBuffer(const sp<SocketBufferPool>& pool, uint8_t* block)
+        : ABuffer(block, pool->blockSize()), mPool(pool), mBlock(block) {}
+
+  protected:
+    virtual ~PooledBuffer() { mPool->recycle(mBlock); }
+
+  private:
+    sp<SocketBufferPool> mPool;
+    uint8_t* mBlock;
+};
+
+SocketBufferPool::SocketBufferPool(size_t blockSize) {
+    mBlockSize = blockSize;
+    mHitCount.store(0);
+    mMissCount.store(0);
+
+    for (int i = 0; i < SOCKETWRAPPER_POOL_SIZE; i++) {
+        mBlocks[i].store(NULL);
+    }
+}
+
+SocketBufferPool::~SocketBufferPool() {
+    for (int i = 0; i < SOCKETWRAPPER_POOL_SIZE; i++) {
+        free(mBlocks[i].exchange(NULL));
+    }
+}
+
+sp<ABuffer> SocketBufferPool::acquire() {
+    uint8_t* block = NULL;
+
+    for (int i = 0; i < SOCKETWRAPPER_POOL_SIZE && block == NULL; i++) {
+        block = mBlocks[i].exchange(NULL);
+    }
+
+    if (block != NULL) {
+        mHitCount.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        block = (uint8_t*)malloc(mBlockSize);
+
+        if (block == NULL) {
+            return NULL;
+        }
+
+        mMissCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return new PooledBuffer(this, block);
+}
+
+void SocketBufferPool::recycle(uint8_t* block) {
+    for (int i = 0; i < SOCKETWRAPPER_POOL_SIZE; i++) {
+        uint8_t* expected = NULL;
+
+        if (mBlocks[i].compare_exchange_strong(expected, block)) {
+            return;
+        }
+    }
+
+    /* pool is full */
+    free(block);
+}
+
 /* constructor */
 SocketWrapper::SocketWrapper() {
     SOCKETWRAPPER_LOGI("%s:enter", __FUNCTION__);
     memset(&mParam, 0, sizeof(Sock_param_t));
+    memset(&mPeerAddr, 0, sizeof(mPeerAddr));
+    mPeerAddrLen = 0;
     mRxCb = NULL;
+    mRxBatchCb = NULL;
 
     /* for thread wakeup */
     int pipefd[2];
@@ -62,7 +133,12 @@ SocketWrapper::SocketWrapper() {
     mWriteCount = 0;
     mWriteFail = 0;
     mReceiveCount = 0;
+    mReceiveDrop = 0;
     mError = false;
+
+    mOverflowBuf = NULL;
+    mOverflowSize = 0;
+    setRxBufferSize(SOCKETWRAPPER_DEFAULT_MTU);
 }
 
 /* destructor */
@@ -90,6 +166,8 @@ SocketWrapper::~SocketWrapper() {
 
     close(mReadPipe);
     close(mWritePipe);
+
+    free(mOverflowBuf);
 }
 
 int SocketWrapper::setParam(Sock_param_t param) {
@@ -104,6 +182,7 @@ int SocketWrapper::setParam(Sock_param_t param) {
                                mParam.peer_port, param.peer_port);
             mParam.peer_port = param.peer_port;
             memcpy(mParam.peer_address, param.peer_address, sizeof(param.peer_address));
+            buildPeerAddr();
             setUdpConnect();
         }
 
@@ -132,6 +211,16 @@ int SocketWrapper::setParam(Sock_param_t param) {
 
     memcpy(&mParam, &param, sizeof(Sock_param_t));
 
+    if (mParam.mtu != 0 && mParam.mtu != mBufferPool->blockSize()) {
+        if (m_bStarted) {
+            /* the receive thread owns the pool and the overflow buffer */
+            SOCKETWRAPPER_LOGW("%s: keep mtu %zu while receiving, ignore %u", __FUNCTION__,
+                               mBufferPool->blockSize(), mParam.mtu);
+        } else {
+            setRxBufferSize(mParam.mtu);
+        }
+    }
+
     /* create socket if not exist and connect to socket */
     setSock();
 
@@ -170,6 +259,7 @@ int SocketWrapper::setRxCallBack(void* cookie, Sock_RxCB_t rx_cb) {
             pthread_join(m_Tid, NULL);
 
             mRxCb = NULL;
+            mRxBatchCb = NULL;
         } else {
             SOCKETWRAPPER_LOGI("thread already stopped");
         }
@@ -189,6 +279,27 @@ int SocketWrapper::setRxCallBack(void* cookie, Sock_RxCB_t rx_cb) {
     return 0;
 }
 
+int SocketWrapper::setRxBatchCallBack(void* cookie, Sock_RxBatchCB_t rx_batch_cb) {
+    SOCKETWRAPPER_LOGI("%s:enter cookie=%p", __FUNCTION__, cookie);
+
+    if (rx_batch_cb == NULL) {
+        return setRxCallBack(NULL, NULL);
+    }
+
+    SOCKETWRAPPER_LOGI("%s:rx_batch_cb!=NULL, m_bStarted=%d", __FUNCTION__, m_bStarted);
+
+    if (m_bStarted == false) {
+        m_bStarted = true;
+        mCookie = cookie;
+        mRxBatchCb = rx_batch_cb;
+        pthread_create(&m_Tid, NULL, SocketWrapper::receiveThread, this);
+    } else {
+        SOCKETWRAPPER_ASSERT(0, "rx_batch_cb!=NULL, but thread already started");
+    }
+
+    return 0;
+}
+
 int SocketWrapper::writeSock(const sp<ABuffer>& buffer) {
     // SOCKETWRAPPER_LOGI("%s:enter fd=%d",__FUNCTION__, mParam.sockfd);
     int fd = mParam.sockfd;
@@ -204,55 +315,19 @@ int SocketWrapper::writeSock(const sp<ABuffer>& buffer) {
 #ifdef UDP_CONNECT
     ret = send(fd, buffer->data(), buffer->size(), MSG_NOSIGNAL);
 #else
-    struct sockaddr_storage remote_addr;
-    struct sockaddr_in* addr_ptr = NULL;
-    struct sockaddr_in6* addr6_ptr = NULL;
-    socklen_t addr_len = sizeof(struct sockaddr_storage);
-
     SOCKETWRAPPER_ASSERT(fd >= 0, "mParam.fd(%d) < 0", fd);
     SOCKETWRAPPER_ASSERT(buffer->data() != NULL, "buffer->data() = NULL");
     SOCKETWRAPPER_ASSERT(buffer->size() > 0, "buffer->size()(%d) <= 0", (int)buffer->size());
 
-    memset((char*)&remote_addr, 0, sizeof(remote_addr));
-
-    switch (mParam.protocol_version) {
-        case VoLTE_Event_IPv4:
-            addr_ptr = (struct sockaddr_in*)&remote_addr;
-            addr_ptr->sin_family = AF_INET;
-            addr_ptr->sin_port = htons(mParam.peer_port);
-            memcpy((char*)&(addr_ptr->sin_addr), mParam.peer_address, sizeof(addr_ptr->sin_addr));
-            addr_len = sizeof(struct sockaddr_in);
-            break;
-        case VoLTE_Event_IPv6:
-            addr6_ptr = (struct sockaddr_in6*)&remote_addr;
-            addr6_ptr->sin6_family = AF_INET6;
-            addr6_ptr->sin6_port = htons(mParam.peer_port);
-            memcpy((char*)&(addr6_ptr->sin6_addr), mParam.peer_address,
-                   sizeof(addr6_ptr->sin6_addr));
-            addr_len = sizeof(struct sockaddr_in6);
-            break;
-        default:
-            SOCKETWRAPPER_ASSERT(0, "%s: uknow domain %d", __FUNCTION__, mParam.protocol_version);
-            break;
-    }
-
-    ret = sendto(fd, buffer->data(), buffer->size(), MSG_NOSIGNAL, (struct sockaddr*)&remote_addr,
-                 addr_len);
+    ret = sendto(fd, buffer->data(), buffer->size(), MSG_NOSIGNAL, (struct sockaddr*)&mPeerAddr,
+                 mPeerAddrLen);
 #endif
 
     if (ret < 0) {
-        mWriteFail++;
         error_no = errno;
         SOCKETWRAPPER_LOGE("%s: socket write failed %s(%d)", __FUNCTION__, strerror(error_no),
                            error_no);
-
-        if (!(error_no == EMSGSIZE || error_no == EAGAIN || error_no == EWOULDBLOCK ||
-              error_no == EPERM || error_no == ECONNREFUSED || error_no == ENETUNREACH ||
-              error_no == EINVAL)) {
-            SOCKETWRAPPER_ASSERT(0, "unexpect error_no=%d", error_no);
-        } else {
-            return error_no * (-1);
-        }
+        return handleWriteError(error_no);
     }
 
     mWriteCount++;
@@ -262,8 +337,57 @@ int SocketWrapper::writeSock(const sp<ABuffer>& buffer) {
     return ret;
 }
 
+int SocketWrapper::writeSockBatch(const Sock_iopacket_t* packets, int count) {
+    int fd = mParam.sockfd;
+    struct mmsghdr msgs[SOCKETWRAPPER_TX_BATCH];
+
+    if (mError == true) {
+        return count;
+    }
+
+    SOCKETWRAPPER_ASSERT(count > 0 && count <= SOCKETWRAPPER_TX_BATCH, "count(%d) invalid", count);
+    memset(msgs, 0, sizeof(msgs[0]) * count);
+
+    for (int i = 0; i < count; i++) {
+        msgs[i].msg_hdr.msg_iov = (struct iovec*)packets[i].iov;
+        msgs[i].msg_hdr.msg_iovlen = packets[i].iovcnt;
+#ifndef UDP_CONNECT
+        msgs[i].msg_hdr.msg_name = &mPeerAddr;
+        msgs[i].msg_hdr.msg_namelen = mPeerAddrLen;
+#endif
+    }
+
+    int ret = sendmmsg(fd, msgs, count, MSG_NOSIGNAL);
+
+    if (ret < 0) {
+        int error_no = errno;
+        SOCKETWRAPPER_LOGE("%s: socket write failed %s(%d)", __FUNCTION__, strerror(error_no),
+                           error_no);
+        return handleWriteError(error_no);
+    }
+
+    for (int i = 0; i < ret; i++) {
+        mWriteCount++;
+        mSendDataUasage += msgs[i].msg_len;
+    }
+
+    return ret;
+}
+
+/* return -errno for the errors the caller can handle */
+int SocketWrapper::handleWriteError(int error_no) {
+    mWriteFail++;
+
+    if (!(error_no == EMSGSIZE || error_no == EAGAIN || error_no == EWOULDBLOCK ||
+          error_no == EPERM || error_no == ECONNREFUSED || error_no == ENETUNREACH ||
+          error_no == EINVAL)) {
+        SOCKETWRAPPER_ASSERT(0, "unexpect error_no=%d", error_no);
+    }
+
+    return error_no * (-1);
+}
+
 /**** private ****/
-#define MAX_MTU_SIZE 4096
 int SocketWrapper::dumpAddr(struct sockaddr* addr_ptr) {
     SOCKETWRAPPER_LOGI("%s:enter", __FUNCTION__);
     char addr_str[256] = {0};
@@ -291,12 +415,158 @@ int SocketWrapper::dumpAddr(struct sockaddr* addr_ptr) {
     return 0;
 }
 
-int SocketWrapper::readSock(int fd, const sp<ABuffer>& buffer) {
+/* must be called before the receive thread starts, setParam() skips it while m_bStarted */
+void SocketWrapper::setRxBufferSize(uint32_t mtu) {
+    if (mtu > MAX_MTU_SIZE) {
+        mtu = MAX_MTU_SIZE;
+    }
+
+    SOCKETWRAPPER_LOGI("%s:mtu=%u", __FUNCTION__, mtu);
+    mBufferPool = new SocketBufferPool(mtu);
+
+    free(mOverflowBuf);
+    mOverflowSize = MAX_MTU_SIZE - mtu;
+    mOverflowBuf =
+            mOverflowSize > 0 ? (uint8_t*)malloc(mOverflowSize * SOCKETWRAPPER_RX_BATCH) : NULL;
+
+    if (mOverflowBuf == NULL) {
+        /* datagrams larger than mtu are truncated instead */
+        mOverflowSize = 0;
+    }
+}
+
+/* discard the next datagram of fd when there is no buffer to receive it */
+void SocketWrapper::dropDatagram(int fd) {
+    if (recv(fd, NULL, 0, MSG_DONTWAIT | MSG_TRUNC) >= 0) {
+        SOCKETWRAPPER_LOGW("%s: out of memory, drop a datagram", __FUNCTION__);
+        mReceiveDrop++;
+    }
+}
+
+void SocketWrapper::dumpDebugInfo(struct timeval* last_time) {
+    struct timeval this_time;
+    gettimeofday(&this_time, (struct timezone*)NULL);
+
+    if (last_time->tv_sec == 0) {
+        *last_time = this_time;
+    } else if (this_time.tv_sec - last_time->tv_sec > 1) {
+        SOCKETWRAPPER_LOGI(
+                "IMSSOCK DEBUG fd(%d) writeCount(%u) writeFail(%u) writeSize(%lld) "
+                "receiveCount(%u) receiveSize(%lld) receiveDrop(%u) poolHit(%u) poolMiss(%u)",
+                mParam.sockfd, mWriteCount, mWriteFail, (long long)mSendDataUasage,
+                mReceiveCount, (long long)mrecvDataUasage, mReceiveDrop,
+                mBufferPool->mHitCount.load(), mBufferPool->mMissCount.load());
+        *last_time = this_time;
+    }
+}
+
+/* drain up to count datagrams with one recvmmsg, return the number received */
+int SocketWrapper::readSockBatch(int fd, sp<ABuffer>* buffers, int count) {
+    struct mmsghdr msgs[SOCKETWRAPPER_RX_BATCH];
+    struct iovec iovs[SOCKETWRAPPER_RX_BATCH][2];
+
+    SOCKETWRAPPER_ASSERT(count <= SOCKETWRAPPER_RX_BATCH, "count(%d) > batch size", count);
+    memset(msgs, 0, sizeof(msgs[0]) * count);
+
+    for (int i = 0; i < count; i++) {
+        if (buffers[i].get() == NULL) {
+            buffers[i] = mBufferPool->acquire();
+        }
+
+        if (buffers[i].get() == NULL) {
+            /* receive into the buffers got so far */
+            count = i;
+            break;
+        }
+
+        iovs[i][0].iov_base = buffers[i]->base();
+        iovs[i][0].iov_len = buffers[i]->capacity();
+        iovs[i][1].iov_base = mOverflowBuf + i * mOverflowSize;
+        iovs[i][1].iov_len = mOverflowSize;
+        msgs[i].msg_hdr.msg_iov = iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = (mOverflowSize > 0) ? 2 : 1;
+    }
+
+    if (count == 0) {
+        dropDatagram(fd);
+        return 0;
+    }
+
+    int ret = recvmmsg(fd, msgs, count, MSG_DONTWAIT, NULL);
+    int64_t recvTimeUs = ns2us(systemTime(SYSTEM_TIME_MONOTONIC));
+
+    if (ret < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            SOCKETWRAPPER_LOGE("%s: socket read failed %s(%d)", __FUNCTION__, strerror(errno),
+                               errno);
+        }
+
+        return ret;
+    }
+
+    /* received buffers are packed to the front, the dropped ones stay behind for reuse */
+    int received = 0;
+
+    for (int i = 0; i < ret; i++) {
+        size_t len = msgs[i].msg_len;
+        size_t capacity = buffers[i]->capacity();
+
+        if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) {
+            SOCKETWRAPPER_LOGW("%s: datagram truncated to %zu, MAX_MTU_SIZE(%d)", __FUNCTION__,
+                               len, MAX_MTU_SIZE);
+        }
+
+        if (len > capacity) {
+            sp<ABuffer> large = new ABuffer(len);
+
+            if (large->data() == NULL) {
+                SOCKETWRAPPER_LOGW("%s: out of memory, drop a datagram of %zu", __FUNCTION__,
+                                   len);
+                mReceiveDrop++;
+                continue;
+            }
+
+            memcpy(large->data(), buffers[i]->base(), capacity);
+            memcpy(large->data() + capacity, mOverflowBuf + i * mOverflowSize, len - capacity);
+            buffers[i] = large;
+        }
+
+        buffers[i]->setRange(0, len);
+        buffers[i]->meta()->setInt64(SOCKETWRAPPER_META_RECV_TIME_US, recvTimeUs);
+        mrecvDataUasage += len;
+        mReceiveCount++;
+
+        if (received != i) {
+            sp<ABuffer> dropped = buffers[received];
+            buffers[received] = buffers[i];
+            buffers[i] = dropped;
+        }
+
+        received++;
+    }
+
+    return received;
+}
+
+int SocketWrapper::readSock(int fd, sp<ABuffer>& buffer) {
     // SOCKETWRAPPER_LOGI("%s:enter",__FUNCTION__);
     int ret = 0;
+    size_t capacity = buffer->capacity();
+
+    /* datagram larger than mtu spills into mOverflowBuf instead of being truncated */
+    struct iovec iov[2];
+    iov[0].iov_base = buffer->data();
+    iov[0].iov_len = capacity;
+    iov[1].iov_base = mOverflowBuf;
+    iov[1].iov_len = mOverflowSize;
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = (mOverflowSize > 0) ? 2 : 1;
 
 #ifdef CONNECT_UDP
-    ret = recv(fd, (char*)buffer->data(), buffer->size(), 0);
+    ret = recvmsg(fd, &msg, 0);
 #else
     struct sockaddr_storage remote_addr, local_addr;
     struct sockaddr* raddr_ptr = NULL;
@@ -310,22 +580,40 @@ int SocketWrapper::readSock(int fd, const sp<ABuffer>& buffer) {
     raddr_ptr = (struct sockaddr*)&remote_addr;
     laddr_ptr = (struct sockaddr*)&local_addr;
 
-    ret = recvfrom(fd, (char*)buffer->data(), buffer->size(), 0, raddr_ptr, (socklen_t*)&addr_len);
+    msg.msg_name = raddr_ptr;
+    msg.msg_namelen = addr_len;
+    ret = recvmsg(fd, &msg, 0);
 #endif
+    int64_t recvTimeUs = ns2us(systemTime(SYSTEM_TIME_MONOTONIC));
 
     if (ret < 0) {
         // No asser since sockfd may be closed by imsma_rtp and SocketBind
         SOCKETWRAPPER_LOGE("%s: socket read failed %s(%d)", __FUNCTION__, strerror(errno), errno);
         return ret;
-    } else if ((unsigned int)ret > buffer->size()) {
-        /* check if buffer size is enough */
-        SOCKETWRAPPER_ASSERT(((unsigned int)ret <= buffer->size()),
-                             "ret(%d) > buffer_size(%d), MAX_MTU_SIZE(%d)", ret,
-                             (int)buffer->size(), MAX_MTU_SIZE);
-        return -1;
+    }
+
+    if (msg.msg_flags & MSG_TRUNC) {
+        SOCKETWRAPPER_LOGW("%s: datagram truncated to %d, MAX_MTU_SIZE(%d)", __FUNCTION__, ret,
+                           MAX_MTU_SIZE);
+    }
+
+    if ((unsigned int)ret > capacity) {
+        /* rare case, move the whole datagram to a dedicated buffer */
+        sp<ABuffer> large = new ABuffer(ret);
+
+        if (large->data() == NULL) {
+            SOCKETWRAPPER_LOGW("%s: out of memory, drop a datagram of %d", __FUNCTION__, ret);
+            mReceiveDrop++;
+            return 0;
+        }
+
+        memcpy(large->data(), buffer->data(), capacity);
+        memcpy(large->data() + capacity, mOverflowBuf, ret - capacity);
+        buffer = large;
     }
 
     buffer->setRange(0, ret);
+    buffer->meta()->setInt64(SOCKETWRAPPER_META_RECV_TIME_US, recvTimeUs);
     mrecvDataUasage += ret;
     mReceiveCount++;
 
@@ -393,39 +681,41 @@ int SocketWrapper::createSock(void) {
     return sockfd;
 }
 
-void SocketWrapper::setUdpConnect(void) {
-    SOCKETWRAPPER_LOGI("%s:enter", __FUNCTION__);
-
-    struct sockaddr_storage remote_addr;
+void SocketWrapper::buildPeerAddr(void) {
     struct sockaddr_in* addr_ptr;
     struct sockaddr_in6* addr6_ptr;
-    socklen_t addr_len;
 
-    /* connect the UDP socket, so that we can use send/recv instead of sendto/recvfrom */
-#ifdef CONNECT_UDP
+    memset(&mPeerAddr, 0, sizeof(mPeerAddr));
 
     switch (mParam.protocol_version) {
         case VoLTE_Event_IPv4:
-            addr_ptr = (struct sockaddr_in*)&remote_addr;
+            addr_ptr = (struct sockaddr_in*)&mPeerAddr;
             addr_ptr->sin_family = AF_INET;
             addr_ptr->sin_port = htons(mParam.peer_port);
             memcpy((char*)&(addr_ptr->sin_addr), mParam.peer_address, sizeof(addr_ptr->sin_addr));
-            addr_len = sizeof(struct sockaddr_in);
+            mPeerAddrLen = sizeof(struct sockaddr_in);
             break;
         case VoLTE_Event_IPv6:
-            addr6_ptr = (struct sockaddr_in6*)&remote_addr;
+            addr6_ptr = (struct sockaddr_in6*)&mPeerAddr;
             addr6_ptr->sin6_family = AF_INET6;
             addr6_ptr->sin6_port = htons(mParam.peer_port);
             memcpy((char*)&(addr6_ptr->sin6_addr), mParam.peer_address,
                    sizeof(addr6_ptr->sin6_addr));
-            addr_len = sizeof(struct sockaddr_in6);
+            mPeerAddrLen = sizeof(struct sockaddr_in6);
             break;
         default:
             SOCKETWRAPPER_ASSERT(0, "%s: uknow domain %d", __FUNCTION__, mParam.protocol_version);
             break;
     }
+}
 
-    if (connect(mParam.sockfd, (struct sockaddr*)&remote_addr, addr_len) < 0) {
+void SocketWrapper::setUdpConnect(void) {
+    SOCKETWRAPPER_LOGI("%s:enter", __FUNCTION__);
+
+    /* connect the UDP socket, so that we can use send/recv instead of sendto/recvfrom */
+#ifdef CONNECT_UDP
+
+    if (connect(mParam.sockfd, (struct sockaddr*)&mPeerAddr, mPeerAddrLen) < 0) {
         // SOCKETWRAPPER_ASSERT(0, "%s: socket connect failed %s(%d)", __FUNCTION__,
         // strerror(errno), errno); tester maybe hot plug sim card, so we set ERROR flag instead of
         // trigger exception
@@ -450,6 +740,8 @@ int SocketWrapper::setSock(void) {
         socklen_t addr_len;
     */
 
+    buildPeerAddr();
+
     /* create socket if it is not exist */
     if (mParam.sockfd < 0) {
         SOCKETWRAPPER_LOGI("socket is not exist, create myself! ");
@@ -628,11 +920,16 @@ void* SocketWrapper::receiveThread(void* pParam) {
     SOCKETWRAPPER_LOGI("%s:enter", __FUNCTION__);
     struct timeval timeout;
     // struct timeval begin_time,end_time;
-    uint32_t diff_time;
-    struct timeval last_time, this_time;
+    struct timeval last_time;
     last_time.tv_sec = 0;
     pSelf->mReceiveCount = 0;
 
+    if (pSelf->mRxBatchCb != NULL) {
+        receiveBatchLoop(pSelf);
+        SOCKETWRAPPER_LOGI("%s:leave ERROR=%d", __FUNCTION__, pSelf->mError);
+        return 0;
+    }
+
     while ((pSelf->m_bStarted) && (pSelf->mError == false)) {
         timeout.tv_sec = 0;
         timeout.tv_usec = 1000 * 100 * 5;  // 500ms
@@ -648,19 +945,7 @@ void* SocketWrapper::receiveThread(void* pParam) {
             max_fd = sockfd;
         }
 
-        gettimeofday(&this_time, (struct timezone*)NULL);
-
-        if (last_time.tv_sec == 0) {
-            last_time = this_time;
-        } else if (this_time.tv_sec - last_time.tv_sec > 1) {
-            SOCKETWRAPPER_LOGI(
-                    "IMSSOCK DEBUG fd(%d) writeCount(%u) writeFail(%u) writeSize(%lld) "
-                    "receiveCount(%u) receiveSize(%lld)",
-                    pSelf->mParam.sockfd, pSelf->mWriteCount, pSelf->mWriteFail,
-                    (long long)(pSelf->mSendDataUasage), pSelf->mReceiveCount,
-                    (long long)(pSelf->mrecvDataUasage));
-            last_time = this_time;
-        }
+        pSelf->dumpDebugInfo(&last_time);
 
         // gettimeofday(&begin_time, (struct timezone *) NULL);
 
@@ -674,8 +959,14 @@ void* SocketWrapper::receiveThread(void* pParam) {
         if (ret > 0) {
             /* check if sockfd is in readfds set which makes select() wakeup */
             if (FD_ISSET(sockfd, &readfds)) {
-                sp<ABuffer> buffer = new ABuffer(MAX_MTU_SIZE);
-                ret = pSelf->readSock(sockfd, buffer);
+                sp<ABuffer> buffer = pSelf->mBufferPool->acquire();
+
+                if (buffer.get() == NULL) {
+                    pSelf->dropDatagram(sockfd);
+                    ret = 0;
+                } else {
+                    ret = pSelf->readSock(sockfd, buffer);
+                }
 
                 /* return buffer size */
                 if (ret > 0) {
@@ -705,3 +996,79 @@ void* SocketWrapper::receiveThread(void* pParam) {
     SOCKETWRAPPER_LOGI("%s:leave ERROR=%d", __FUNCTION__, pSelf->mError);
     return 0;
 }
+
+void SocketWrapper::receiveBatchLoop(SocketWrapper* pSelf) {
+    int sockfd = pSelf->mParam.sockfd;
+    struct epoll_event ev;
+    struct epoll_event events[2];
+    struct timeval last_time;
+    last_time.tv_sec = 0;
+
+    SOCKETWRAPPER_LOGI("%s:enter", __FUNCTION__);
+
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (epfd < 0) {
+        SOCKETWRAPPER_LOGE("%s:epoll_create1 fail %s(%d)", __FUNCTION__, strerror(errno), errno);
+        return;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = sockfd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, sockfd, &ev);
+    ev.data.fd = pSelf->mReadPipe;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, pSelf->mReadPipe, &ev);
+
+    sp<ABuffer> buffers[SOCKETWRAPPER_RX_BATCH];
+
+    while ((pSelf->m_bStarted) && (pSelf->mError == false)) {
+        pSelf->dumpDebugInfo(&last_time);
+
+        int ret = epoll_wait(epfd, events, 2, 500);  // 500ms
+
+        if (ret < 0) {
+            if (errno != EINTR) {
+                SOCKETWRAPPER_LOGE("%s:%s(%d)", __FUNCTION__, strerror(errno), errno);
+            }
+
+            continue;
+        }
+
+        for (int i = 0; i < ret; i++) {
+            if (events[i].data.fd == pSelf->mReadPipe) {
+                char buffer[80];
+                SOCKETWRAPPER_LOGI("%s:wakeup by pipe", __FUNCTION__);
+                /* clean read pipe */
+                read(pSelf->mReadPipe, buffer, sizeof(buffer));
+                continue;
+            }
+
+            /* drain the socket, a short batch means it is empty */
+            int count = SOCKETWRAPPER_RX_BATCH;
+
+            while (count == SOCKETWRAPPER_RX_BATCH && pSelf->m_bStarted) {
+                count = pSelf->readSockBatch(sockfd, buffers, SOCKETWRAPPER_RX_BATCH);
+
+                if (count <= 0) {
+                    break;
+                }
+
+                for (int j = 0; j < count; j++) {
+                    buffers[j]->setInt32Data((int32_t)getRtpSN(buffers[j]));
+                }
+
+                if (pSelf->mRxBatchCb != NULL) {
+                    pSelf->mRxBatchCb(pSelf->mCookie, buffers, count);
+                }
+
+                /* handed over to the callback, get fresh ones next round */
+                for (int j = 0; j < count; j++) {
+                    buffers[j].clear();
+                }
+            }
+        }
+    }
+
+    close(epfd);
+}
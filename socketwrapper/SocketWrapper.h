@@ -22,6 +22,9 @@
 #include <utils/RefBase.h>
 #include <utils/threads.h>
 #include <assert.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <atomic>
 
 #define CONNECT_UDP
 
@@ -54,6 +57,12 @@ enum VoLTE_Event_IP_Version_e {
     }
 
 typedef int (*Sock_RxCB_t)(void* cookie, const sp<ABuffer>& buffer);
+/* all datagrams drained by one recvmmsg, in arrival order */
+typedef int (*Sock_RxBatchCB_t)(void* cookie, const sp<ABuffer>* buffers, int count);
+
+/* int64 in the meta() of received buffers, when the datagram left the socket,
+ * in the same clock as ALooper::GetNowUs() */
+#define SOCKETWRAPPER_META_RECV_TIME_US "recv-time-us"
 
 typedef struct Sock_param {
     /*IPv4 or IPv6*/
@@ -69,6 +78,7 @@ typedef struct Sock_param {
 
     uint32_t sendBufferSize;    /* 0 for ignore */
     uint32_t receiveBufferSize; /* 0 for ignore */
+    uint32_t mtu;               /* 0 for SOCKETWRAPPER_DEFAULT_MTU */
 
     uint32_t network_id;
     char ifname[16];
@@ -81,6 +91,43 @@ typedef struct Sock_param {
     uint16_t peer_port;
 } Sock_param_t;
 
+#define SOCKETWRAPPER_DEFAULT_MTU 1500
+#define SOCKETWRAPPER_POOL_SIZE 64
+#define SOCKETWRAPPER_RX_BATCH 16
+#define SOCKETWRAPPER_TX_BATCH 32
+
+/* one datagram gathered from up to 2 segments, such as rtp header + payload */
+typedef struct Sock_iopacket {
+    struct iovec iov[2];
+    int iovcnt;
+} Sock_iopacket_t;
+
+/* recycle the receive data blocks, the block goes back to the pool
+ * when the last sp<> of the ABuffer wrapping it is released.
+ * acquire() is only called from the receive thread, release may come from any thread.
+ * acquire() returns NULL when a new block can't be allocated */
+class SocketBufferPool : public RefBase {
+  public:
+    SocketBufferPool(size_t blockSize);
+    sp<ABuffer> acquire();
+    size_t blockSize() const { return mBlockSize; }
+
+    // for debug, updated by acquire() and read by dumpDebugInfo()
+    std::atomic<unsigned int> mHitCount;
+    std::atomic<unsigned int> mMissCount;
+
+  protected:
+    virtual ~SocketBufferPool();
+
+  private:
+    struct PooledBuffer;
+
+    void recycle(uint8_t* block);
+
+    size_t mBlockSize;
+    std::atomic<uint8_t*> mBlocks[SOCKETWRAPPER_POOL_SIZE];
+};
+
 class SocketWrapper : public RefBase {
   public:
     SocketWrapper();
@@ -88,22 +135,41 @@ class SocketWrapper : public RefBase {
     int setParam(Sock_param_t param);
     int getParam(Sock_param_t* param);
     int setRxCallBack(void* cookie, Sock_RxCB_t rx_cb);
+    /* epoll + recvmmsg receive mode, stop it with setRxCallBack(NULL, NULL) */
+    int setRxBatchCallBack(void* cookie, Sock_RxBatchCB_t rx_batch_cb);
     int writeSock(const sp<ABuffer>& buffer);
+    /* send with one sendmmsg, return the number of packets sent or -errno of the first one */
+    int writeSockBatch(const Sock_iopacket_t* packets, int count);
 
   private:
-    int readSock(int fd, const sp<ABuffer>& buffer);
+    int readSock(int fd, sp<ABuffer>& buffer);
+    int readSockBatch(int fd, sp<ABuffer>* buffers, int count);
+    void setRxBufferSize(uint32_t mtu);
+    void dropDatagram(int fd);
+    void dumpDebugInfo(struct timeval* last_time);
     int setSock(void);
     int createSock(void);
     int dumpAddr(struct sockaddr* addr_ptr);
     void setUdpConnect(void);
+    void buildPeerAddr(void);
+    int handleWriteError(int error_no);
 
     Sock_param_t mParam;
+    /* built from mParam when peer changes, not per packet */
+    struct sockaddr_storage mPeerAddr;
+    socklen_t mPeerAddrLen;
     Sock_RxCB_t mRxCb;
+    Sock_RxBatchCB_t mRxBatchCb;
     void* mCookie;
     bool m_bStarted;
     bool m_bSelfCreate;
     pthread_t m_Tid;
     static void* receiveThread(void* pParam);
+    static void receiveBatchLoop(SocketWrapper* pSelf);
+    sp<SocketBufferPool> mBufferPool;
+    /* tail of datagrams larger than mtu, one slice of mOverflowSize per batch entry */
+    uint8_t* mOverflowBuf;
+    size_t mOverflowSize;
     /* for thread wakeup */
     int mReadPipe;
     int mWritePipe;
@@ -115,5 +181,6 @@ class SocketWrapper : public RefBase {
     unsigned int mWriteCount;
     unsigned int mWriteFail;
     unsigned int mReceiveCount;
+    unsigned int mReceiveDrop;
 };
 #endif /* __SOCKETWRAPPER_H__ */
@@ -26,6 +26,7 @@
 #include <unistd.h>
 #include "IVcodecCap.h"
 #include "VcodecCap.h"
+#include "comutils.h"
 
 #include "EncodeCap.h"
 #include "VcodecCap_genHeader.h"
@@ -568,30 +569,27 @@ static int32_t getH264CodecParam(video_profile_t profile, video_level_t level,
 }
 
 int32_t searchStartCode(int32_t startpos, VAL_ULONG_T u4BSStartVA, VAL_ULONG_T u4BSSize) {
-    uint32_t pos = startpos;
-    char* pBSStartVA = (char*)u4BSStartVA;
-    for (; pos < u4BSSize - 5; pos++) {
-        if (pBSStartVA[pos] == 0x00 && pBSStartVA[pos + 1] == 0x00 && pBSStartVA[pos + 2] == 0x00 &&
-            pBSStartVA[pos + 3] == 0x01) {
-            // VDO_LOGI("%d,%d,%d,%d", pBSStartVA[pos], pBSStartVA[pos + 1], pBSStartVA[pos + 2],
-            // pBSStartVA[pos + 3]);
-            return pos;
+    const uint8_t* pBSStartVA = (const uint8_t*)u4BSStartVA;
+
+    if (u4BSSize < 5 || (VAL_ULONG_T)startpos >= u4BSSize - 5) {
+        return 0;
+    }
+
+    // 0x00 0x00 0x00 0x01 starting before u4BSSize - 5
+    const uint8_t* p = pBSStartVA + startpos + 1;
+    const uint8_t* end = pBSStartVA + u4BSSize - 2;
+
+    while ((p = FindNALStartCode(p, end - p)) != end) {
+        if (p[-1] == 0x00) {
+            return p - 1 - pBSStartVA;
         }
+        p++;
     }
     return 0;
 }
 
 void removePreventionByte(uint8_t* profile_tier_level, uint8_t size) {
-    int32_t pos = 0;
-    for (; pos < size - 2;) {
-        if (profile_tier_level[pos] == 0x00 && profile_tier_level[pos + 1] == 0x00 &&
-            profile_tier_level[pos + 2] == 0x03) {
-            memmove(profile_tier_level + pos + 2, profile_tier_level + pos + 3, size - (pos + 3));
-            pos += 2;
-        } else {
-            pos++;
-        }
-    }
+    RemovePreventionBytes(profile_tier_level, size);
 }
 
 static int32_t genHEVCParameterSets(VENC_DRV_HEVC_VIDEO_PROFILE_T eProfile,